@@ -34,6 +34,7 @@ public class ModioAPI : ModuleRules
                 "Json",
 				"JsonUtilities",
 				"RuntimeFilesDownloader",
+				"RuntimeArchiver",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -29,6 +29,9 @@ void UAsyncAction_DownloadActiveModfileForPlatform::DownloadProgress(int64 Downl
 
 void UAsyncAction_DownloadActiveModfileForPlatform::DownloadCompleted(EDownloadToStorageResult DownloadResult)
 {
+	ModioConnection->ReleaseCacheSpace(DownloadMessage.Modfile.Mod_ID, ReservedCacheBytes);
+	ReservedCacheBytes = 0;
+
 	switch (DownloadResult)
 	{
 		case EDownloadToStorageResult::Success:
@@ -95,6 +98,17 @@ void UAsyncAction_DownloadActiveModfileForPlatform::Activate()
 		return;
 	}
 
+	FString ReserveMessage;
+	if (!ModioConnection->ReserveCacheSpace(Modfile.Mod_ID, Modfile.Filesize, ReserveMessage))
+	{
+		DownloadMessage.Result = EModioAPI_DownloadResult::DownloadResult_InsufficientSpace;
+		DownloadMessage.ErrorMessage = ReserveMessage;
+		Error.Broadcast(DownloadMessage);
+		return;
+	}
+
+	ReservedCacheBytes = Modfile.Filesize;
+
 	FString FileDownloadURL = ModioConnection->GetApiPath() + ModioConnection->EndpointGames + "/" + FString::FromInt(ModioConnection->ModioGameID) + ModioConnection->EndpointMods + "/" + FString::FromInt(Modfile.Mod_ID) + ModioConnection->EndpointFiles + "/" + FString::FromInt(Modfile.ID) + ModioConnection->EndpointDownload;
 	FString FileDownloadPath = ModioConnection->GetModfileDirectoryPathForModfile(Modfile.Mod_ID, Modfile.ID) + Modfile.Filename;
 
@@ -0,0 +1,726 @@
+/*
+Copyright © 2023 Arvur GmbH / Robin Hasenbach.
+Released under GNU AGPLv3 License.
+*/
+
+#include "AsyncActions/DownloadModfileUpdate.h"
+#include "RuntimeChunkDownloader.h"
+#include "FileToMemoryDownloader.h"
+#include "Async/Async.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/SecureHash.h"
+
+namespace
+{
+	// Downloaded Segments are requested in Ranges of at most this Size
+	constexpr int64 FetchRangeSize = 8 * 1024 * 1024;
+
+	// Reused Segments smaller than this between downloaded Segments are downloaded along with them, as a separate Request costs more than the Bytes saved
+	constexpr int64 MinReusedSegmentSize = 64 * 1024;
+
+	// Size of the Blocks reused Segments are copied in
+	constexpr int64 CopyBlockSize = 1024 * 1024;
+
+	// The End of the Zip-Archive is requested again if the Central Directory, the Zip64-Records or the Comment didn't fit into it
+	constexpr int32 MaxCentralDirectoryRequests = 4;
+
+	// An Entry is unchanged if everything the Central Directory knows about it matches and it occupies as many Bytes in both Zip-Archives
+	bool IsEntryUnchanged(const FRuntimeArchiverZipCentralDirectory::FEntry& PreviousEntry, const FRuntimeArchiverZipCentralDirectory::FEntry& Entry)
+	{
+		return PreviousEntry.Flags == Entry.Flags
+			&& PreviousEntry.Method == Entry.Method
+			&& PreviousEntry.DosTime == Entry.DosTime
+			&& PreviousEntry.Crc32 == Entry.Crc32
+			&& PreviousEntry.CompressedSize == Entry.CompressedSize
+			&& PreviousEntry.UncompressedSize == Entry.UncompressedSize
+			&& PreviousEntry.GetSpanSize() == Entry.GetSpanSize();
+	}
+
+	// Adds a Segment, merging it into the last one if both are downloaded or both are copied from contiguous Bytes
+	void AddSegment(TArray<FModioAPI_ModfileSegment>& Segments, int64 Offset, int64 Size, int64 SourceOffset, int32 NumOfEntries)
+	{
+		if (Size <= 0)
+		{
+			return;
+		}
+
+		if (Segments.Num() > 0)
+		{
+			FModioAPI_ModfileSegment& LastSegment = Segments.Last();
+			const bool bBothFetched = !LastSegment.IsReused() && SourceOffset == INDEX_NONE;
+			const bool bBothReused = LastSegment.IsReused() && SourceOffset == LastSegment.SourceOffset + LastSegment.Size;
+
+			if (bBothFetched || bBothReused)
+			{
+				LastSegment.Size += Size;
+				LastSegment.NumOfEntries += NumOfEntries;
+				return;
+			}
+		}
+
+		FModioAPI_ModfileSegment Segment;
+		Segment.Offset = Offset;
+		Segment.Size = Size;
+		Segment.SourceOffset = SourceOffset;
+		Segment.NumOfEntries = NumOfEntries;
+		Segments.Add(Segment);
+	}
+
+	// Splits the new Zip-Archive up to EndOffset into Segments copied from the previous Zip-Archive and Segments to download
+	TArray<FModioAPI_ModfileSegment> PlanSegments(const FRuntimeArchiverZipCentralDirectory& PreviousCentralDirectory, const FRuntimeArchiverZipCentralDirectory& CentralDirectory, int64 EndOffset)
+	{
+		TMap<FString, const FRuntimeArchiverZipCentralDirectory::FEntry*> PreviousEntries;
+		for (const FRuntimeArchiverZipCentralDirectory::FEntry& PreviousEntry : PreviousCentralDirectory.GetEntries())
+		{
+			PreviousEntries.Add(PreviousEntry.Name, &PreviousEntry);
+		}
+
+		TArray<FModioAPI_ModfileSegment> EntrySegments;
+		int64 Offset = 0;
+
+		for (const FRuntimeArchiverZipCentralDirectory::FEntry& Entry : CentralDirectory.GetEntries())
+		{
+			// Bytes in front of the Entry that belong to no Entry are always downloaded
+			AddSegment(EntrySegments, Offset, Entry.LocalHeaderOffset - Offset, INDEX_NONE, 0);
+
+			const FRuntimeArchiverZipCentralDirectory::FEntry* const* PreviousEntry = PreviousEntries.Find(Entry.Name);
+			const bool bUnchanged = PreviousEntry && IsEntryUnchanged(**PreviousEntry, Entry);
+
+			AddSegment(EntrySegments, Entry.LocalHeaderOffset, Entry.GetSpanSize(), bUnchanged ? (*PreviousEntry)->LocalHeaderOffset : INDEX_NONE, 1);
+			Offset = Entry.EndOffset;
+		}
+
+		AddSegment(EntrySegments, Offset, CentralDirectory.GetCentralDirectoryOffset() - Offset, INDEX_NONE, 0);
+
+		TArray<FModioAPI_ModfileSegment> MergedSegments;
+
+		for (int32 SegmentIndex = 0; SegmentIndex < EntrySegments.Num(); ++SegmentIndex)
+		{
+			FModioAPI_ModfileSegment Segment = EntrySegments[SegmentIndex];
+			if (Segment.Offset >= EndOffset)
+			{
+				break;
+			}
+
+			// Everything from EndOffset on has been downloaded already
+			Segment.Size = FMath::Min(Segment.Size, EndOffset - Segment.Offset);
+
+			const bool bFollowsFetched = MergedSegments.Num() > 0 && !MergedSegments.Last().IsReused();
+			const bool bPrecedesFetched = !EntrySegments.IsValidIndex(SegmentIndex + 1) || !EntrySegments[SegmentIndex + 1].IsReused();
+
+			if (Segment.IsReused() && Segment.Size < MinReusedSegmentSize && bFollowsFetched && bPrecedesFetched)
+			{
+				Segment.SourceOffset = INDEX_NONE;
+			}
+
+			AddSegment(MergedSegments, Segment.Offset, Segment.Size, Segment.SourceOffset, Segment.NumOfEntries);
+		}
+
+		// Each Range is kept in Memory until it is written, so large downloaded Segments are requested in several Ranges
+		TArray<FModioAPI_ModfileSegment> Segments;
+
+		for (const FModioAPI_ModfileSegment& Segment : MergedSegments)
+		{
+			if (Segment.IsReused())
+			{
+				Segments.Add(Segment);
+				continue;
+			}
+
+			for (int64 RangeOffset = 0; RangeOffset < Segment.Size; RangeOffset += FetchRangeSize)
+			{
+				FModioAPI_ModfileSegment Range;
+				Range.Offset = Segment.Offset + RangeOffset;
+				Range.Size = FMath::Min(FetchRangeSize, Segment.Size - RangeOffset);
+				Range.NumOfEntries = RangeOffset == 0 ? Segment.NumOfEntries : 0;
+				Segments.Add(Range);
+			}
+		}
+
+		return Segments;
+	}
+}
+
+/**
+ * Writes the new Zip-Archive to a partial File next to its Save Path, Segment by Segment and in order, while computing its MD5
+ * Segments are written on a background thread, but never more than one at a time
+ */
+class FModioAPI_ModfileRebuild : public TSharedFromThis<FModioAPI_ModfileRebuild, ESPMode::ThreadSafe>
+{
+public:
+	FModioAPI_ModfileRebuild(const FString& InPreviousFilePath, const FString& InPartialFilePath)
+		: PreviousFilePath(InPreviousFilePath)
+		, PartialFilePath(InPartialFilePath)
+	{
+	}
+
+	bool Open(int64 FileSize, FString& Message)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		PreviousFileHandle.Reset(PlatformFile.OpenRead(*PreviousFilePath));
+		if (!PreviousFileHandle.IsValid())
+		{
+			Message = "Unable to open the previous Zip-Archive!";
+			return false;
+		}
+
+		PartialFileHandle.Reset(PlatformFile.OpenWrite(*PartialFilePath));
+		if (!PartialFileHandle.IsValid())
+		{
+			Message = "Unable to create the partial Zip-Archive!";
+			return false;
+		}
+
+		// Preallocation is only an Optimization, the File grows while it is written otherwise
+		PartialFileHandle->Truncate(FileSize);
+
+		if (!PartialFileHandle->Seek(0))
+		{
+			Message = "Unable to write the partial Zip-Archive!";
+			return false;
+		}
+
+		return true;
+	}
+
+	bool CopySegment(const FModioAPI_ModfileSegment& Segment, FString& Message)
+	{
+		if (!PreviousFileHandle->Seek(Segment.SourceOffset))
+		{
+			Message = "Unable to read the previous Zip-Archive!";
+			return false;
+		}
+
+		TArray<uint8> Block;
+		Block.SetNumUninitialized(FMath::Min(Segment.Size, CopyBlockSize));
+
+		for (int64 RemainingSize = Segment.Size; RemainingSize > 0;)
+		{
+			const int64 BlockSize = FMath::Min(RemainingSize, CopyBlockSize);
+			if (!PreviousFileHandle->Read(Block.GetData(), BlockSize))
+			{
+				Message = "Unable to read the previous Zip-Archive!";
+				return false;
+			}
+
+			if (!WriteData(Block.GetData(), BlockSize, Message))
+			{
+				return false;
+			}
+
+			RemainingSize -= BlockSize;
+		}
+
+		return true;
+	}
+
+	bool WriteData(const uint8* Data, int64 Size, FString& Message)
+	{
+		if (!PartialFileHandle->Write(Data, Size))
+		{
+			Message = "Unable to write the partial Zip-Archive!";
+			return false;
+		}
+
+		Md5.Update(Data, Size);
+		return true;
+	}
+
+	// Verifies the rebuilt Zip-Archive and moves it to the Save Path
+	bool Finish(const FString& ExpectedMd5, const FString& SavePath, FString& Message)
+	{
+		PreviousFileHandle.Reset();
+
+		const bool bFlushed = PartialFileHandle->Flush(true);
+		PartialFileHandle.Reset();
+
+		if (!bFlushed)
+		{
+			Message = "Unable to write the partial Zip-Archive!";
+			return false;
+		}
+
+		uint8 Digest[16];
+		Md5.Final(Digest);
+
+		FString Hash;
+		for (const uint8 Byte : Digest)
+		{
+			Hash += FString::Printf(TEXT("%02x"), Byte);
+		}
+
+		if (!Hash.Equals(ExpectedMd5, ESearchCase::IgnoreCase))
+		{
+			Message = "The rebuilt Zip-Archive doesn't match the MD5 of the Modfile!";
+			return false;
+		}
+
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		if (PlatformFile.FileExists(*SavePath) && !PlatformFile.DeleteFile(*SavePath))
+		{
+			Message = "Unable to replace the existing Zip-Archive!";
+			return false;
+		}
+
+		if (!PlatformFile.MoveFile(*SavePath, *PartialFilePath))
+		{
+			Message = "Unable to move the rebuilt Zip-Archive into place!";
+			return false;
+		}
+
+		return true;
+	}
+
+	// Closes and removes the partial File
+	void Abort()
+	{
+		PreviousFileHandle.Reset();
+		PartialFileHandle.Reset();
+		FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*PartialFilePath);
+	}
+
+private:
+	FString PreviousFilePath;
+	FString PartialFilePath;
+
+	TUniquePtr<IFileHandle> PreviousFileHandle;
+	TUniquePtr<IFileHandle> PartialFileHandle;
+
+	FMD5 Md5;
+};
+
+void UAsyncAction_DownloadModfileUpdate::DownloadStarted()
+{
+	DownloadMessage.ProgressInfo = FModioAPI_DownloadFileProgress();
+	DownloadMessage.ProgressInfo.BytesReceived = -1;
+	DownloadMessage.ProgressInfo.BytesTotal = -1;
+	DownloadMessage.ProgressInfo.Progress = 0;
+	DownloadMessage.ErrorMessage = "Download started!";
+	DownloadMessage.Result = EModioAPI_DownloadResult::DownloadResult_Running;
+	Started.Broadcast(DownloadMessage);
+}
+
+void UAsyncAction_DownloadModfileUpdate::DownloadProgress(int64 DownloadBytesReceived, int64 DownloadBytesTotal)
+{
+	DownloadMessage.ProgressInfo = FModioAPI_DownloadFileProgress();
+	DownloadMessage.ProgressInfo.BytesReceived = DownloadBytesReceived;
+	DownloadMessage.ProgressInfo.BytesTotal = DownloadBytesTotal;
+	DownloadMessage.ProgressInfo.Progress = DownloadBytesTotal <= 0 ? 0 : static_cast<float>(DownloadBytesReceived) / DownloadBytesTotal;
+	DownloadMessage.ErrorMessage = DownloadMessage.bFullDownload ? "Downloading..." : "Downloading changed Entries...";
+	Progress.Broadcast(DownloadMessage);
+}
+
+void UAsyncAction_DownloadModfileUpdate::DownloadCompleted(EModioAPI_DownloadResult DownloadResult, const FString& Message)
+{
+	DownloadMessage.Result = DownloadResult;
+	DownloadMessage.ErrorMessage = Message;
+
+	ChunkDownloader.Reset();
+	Rebuild.Reset();
+	Downloader = nullptr;
+
+	ModioConnection->ReleaseCacheSpace(Modfile.Mod_ID, ReservedCacheBytes);
+	ReservedCacheBytes = 0;
+
+	Completed.Broadcast(DownloadMessage);
+}
+
+FString UAsyncAction_DownloadModfileUpdate::GetChunkURL() const
+{
+	// Ranges are requested directly from the resolved URL, avoiding the Redirect for each of them
+	const FRuntimeChunkDownloadSession& DownloadSession = ChunkDownloader->GetDownloadSession();
+	return DownloadSession.IsResolvedFor(FileDownloadURL) ? DownloadSession.ResolvedURL : FileDownloadURL;
+}
+
+void UAsyncAction_DownloadModfileUpdate::RequestCentralDirectory(int64 TailSize)
+{
+	++NumOfCentralDirectoryRequests;
+
+	TWeakObjectPtr<UAsyncAction_DownloadModfileUpdate> WeakThis(this);
+	const FInt64Vector2 Range(ContentSize - TailSize, ContentSize - TailData.Num() - 1);
+
+	ChunkDownloader->DownloadFileByChunk(GetChunkURL(), 0, "", ContentSize, Range, [](int64 BytesReceived, int64 BytesTotal) {}).Next([WeakThis](FRuntimeChunkDownloaderResult&& Result)
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->CentralDirectoryReceived(Result.Result, MoveTemp(Result.Data));
+		}
+	});
+}
+
+void UAsyncAction_DownloadModfileUpdate::CentralDirectoryReceived(EDownloadToMemoryResult Result, TArray64<uint8>&& Data)
+{
+	if (bCancelled || Result == EDownloadToMemoryResult::Cancelled)
+	{
+		DownloadCompleted(EModioAPI_DownloadResult::DownloadResult_Cancelled, "Download Cancelled!");
+		return;
+	}
+
+	if (Result != EDownloadToMemoryResult::Success && Result != EDownloadToMemoryResult::SucceededByPayload)
+	{
+		StartFullDownload("Unable to download the Central Directory of the Zip-Archive!");
+		return;
+	}
+
+	DownloadMessage.BytesTransferred += Data.Num();
+
+	// The newly received Bytes precede the previously received End of the Zip-Archive
+	Data.Append(TailData);
+	TailData = MoveTemp(Data);
+
+	int64 RequiredTailSize = 0;
+	if (!CentralDirectory.Read(TailData.GetData(), TailData.Num(), ContentSize, RequiredTailSize))
+	{
+		if (RequiredTailSize > TailData.Num() && NumOfCentralDirectoryRequests < MaxCentralDirectoryRequests)
+		{
+			RequestCentralDirectory(RequiredTailSize);
+			return;
+		}
+
+		StartFullDownload("Unable to read the Central Directory of the Zip-Archive! " + CentralDirectory.GetErrorMessage());
+		return;
+	}
+
+	Segments = PlanSegments(PreviousCentralDirectory, CentralDirectory, ContentSize - TailData.Num());
+	NextSegmentIndex = 0;
+	RebuiltBytes = 0;
+
+	for (const FModioAPI_ModfileSegment& Segment : Segments)
+	{
+		if (Segment.IsReused())
+		{
+			DownloadMessage.BlocksReused += Segment.NumOfEntries;
+		}
+	}
+
+	// Entries in the End of the Zip-Archive have been downloaded along with the Central Directory
+	DownloadMessage.BlocksFetched = CentralDirectory.GetEntries().Num() - DownloadMessage.BlocksReused;
+
+	FString Message;
+	Rebuild = MakeShared<FModioAPI_ModfileRebuild, ESPMode::ThreadSafe>(PreviousFilePath, FileDownloadPath + ".part");
+	if (!Rebuild->Open(ContentSize, Message))
+	{
+		Rebuild->Abort();
+		Rebuild.Reset();
+		StartFullDownload(Message);
+		return;
+	}
+
+	RebuildNextSegment();
+}
+
+void UAsyncAction_DownloadModfileUpdate::RebuildNextSegment()
+{
+	if (!Segments.IsValidIndex(NextSegmentIndex))
+	{
+		FinishRebuild();
+		return;
+	}
+
+	const FModioAPI_ModfileSegment Segment = Segments[NextSegmentIndex++];
+
+	TWeakObjectPtr<UAsyncAction_DownloadModfileUpdate> WeakThis(this);
+	TSharedPtr<FModioAPI_ModfileRebuild, ESPMode::ThreadSafe> RebuildPtr = Rebuild;
+
+	if (Segment.IsReused())
+	{
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, RebuildPtr, Segment]()
+		{
+			FString Message;
+			const bool bSuccess = RebuildPtr->CopySegment(Segment, Message);
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Segment, bSuccess, Message]()
+			{
+				if (WeakThis.IsValid())
+				{
+					WeakThis->SegmentRebuilt(Segment.Size, true, bSuccess, Message);
+				}
+			});
+		});
+		return;
+	}
+
+	const int64 SegmentStartBytes = RebuiltBytes;
+	const FInt64Vector2 Range(Segment.Offset, Segment.Offset + Segment.Size - 1);
+
+	ChunkDownloader->DownloadFileByChunk(GetChunkURL(), 0, "", ContentSize, Range, [WeakThis, SegmentStartBytes](int64 BytesReceived, int64 BytesTotal)
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->DownloadProgress(SegmentStartBytes + BytesReceived, WeakThis->ContentSize);
+		}
+	}).Next([WeakThis, RebuildPtr, Segment](FRuntimeChunkDownloaderResult&& Result)
+	{
+		if (!WeakThis.IsValid())
+		{
+			return;
+		}
+
+		if ((Result.Result != EDownloadToMemoryResult::Success && Result.Result != EDownloadToMemoryResult::SucceededByPayload) || Result.Data.Num() != Segment.Size)
+		{
+			WeakThis->SegmentRebuilt(Segment.Size, false, false, Result.Result == EDownloadToMemoryResult::Cancelled ? "Download Cancelled!" : "Unable to download a Range of the Zip-Archive!");
+			return;
+		}
+
+		WeakThis->DownloadMessage.BytesTransferred += Segment.Size;
+
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, RebuildPtr, Segment, Data = MoveTemp(Result.Data)]()
+		{
+			FString Message;
+			const bool bSuccess = RebuildPtr->WriteData(Data.GetData(), Data.Num(), Message);
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Segment, bSuccess, Message]()
+			{
+				if (WeakThis.IsValid())
+				{
+					WeakThis->SegmentRebuilt(Segment.Size, false, bSuccess, Message);
+				}
+			});
+		});
+	});
+}
+
+void UAsyncAction_DownloadModfileUpdate::SegmentRebuilt(int64 SegmentSize, bool bReused, bool bSuccess, const FString& Message)
+{
+	if (bCancelled)
+	{
+		Rebuild->Abort();
+		DownloadCompleted(EModioAPI_DownloadResult::DownloadResult_Cancelled, "Download Cancelled!");
+		return;
+	}
+
+	if (!bSuccess)
+	{
+		Rebuild->Abort();
+		Rebuild.Reset();
+		StartFullDownload(Message);
+		return;
+	}
+
+	RebuiltBytes += SegmentSize;
+	if (bReused)
+	{
+		DownloadMessage.BytesReused += SegmentSize;
+	}
+
+	DownloadProgress(RebuiltBytes, ContentSize);
+	RebuildNextSegment();
+}
+
+void UAsyncAction_DownloadModfileUpdate::FinishRebuild()
+{
+	TWeakObjectPtr<UAsyncAction_DownloadModfileUpdate> WeakThis(this);
+	TSharedPtr<FModioAPI_ModfileRebuild, ESPMode::ThreadSafe> RebuildPtr = Rebuild;
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, RebuildPtr, Tail = MoveTemp(TailData), ExpectedMd5 = Modfile.Filehash.MD5, SavePath = FileDownloadPath]()
+	{
+		FString Message;
+		const bool bSuccess = RebuildPtr->WriteData(Tail.GetData(), Tail.Num(), Message) && RebuildPtr->Finish(ExpectedMd5, SavePath, Message);
+		if (!bSuccess)
+		{
+			RebuildPtr->Abort();
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, bSuccess, Message]()
+		{
+			if (!WeakThis.IsValid())
+			{
+				return;
+			}
+
+			if (!bSuccess)
+			{
+				WeakThis->Rebuild.Reset();
+				WeakThis->StartFullDownload(Message);
+				return;
+			}
+
+			const FModioAPI_DownloadModfileUpdateMessage& UpdateMessage = WeakThis->DownloadMessage;
+			WeakThis->DownloadProgress(WeakThis->ContentSize, WeakThis->ContentSize);
+			WeakThis->DownloadCompleted(EModioAPI_DownloadResult::DownloadResult_CompletedSuccessfully, FString::Printf(TEXT("Download Successful! Reused %d Entries (%lld Bytes), downloaded %d Entries (%lld Bytes transferred)."), UpdateMessage.BlocksReused, UpdateMessage.BytesReused, UpdateMessage.BlocksFetched, UpdateMessage.BytesTransferred));
+		});
+	});
+}
+
+void UAsyncAction_DownloadModfileUpdate::StartFullDownload(const FString& Reason)
+{
+	if (bCancelled)
+	{
+		DownloadCompleted(EModioAPI_DownloadResult::DownloadResult_Cancelled, "Download Cancelled!");
+		return;
+	}
+
+	// Nothing of the previous Zip-Archive ends up in the downloaded one
+	DownloadMessage.bFullDownload = true;
+	DownloadMessage.BlocksReused = 0;
+	DownloadMessage.BlocksFetched = CentralDirectory.GetEntries().Num();
+	DownloadMessage.BytesReused = 0;
+
+	FullDownloadReason = Reason;
+	FullDownloadBytesReceived = 0;
+	ChunkDownloader.Reset();
+
+	OnFullDownloadProgress.BindUObject(this, &UAsyncAction_DownloadModfileUpdate::FullDownloadProgress);
+	OnFullDownloadCompleted.BindUObject(this, &UAsyncAction_DownloadModfileUpdate::FullDownloadCompleted);
+
+	Downloader = UFileToStorageDownloader::DownloadFileToStorage(FileDownloadURL, FileDownloadPath, 0, "", false, OnFullDownloadProgress, OnFullDownloadCompleted);
+}
+
+void UAsyncAction_DownloadModfileUpdate::FullDownloadProgress(int64 DownloadBytesReceived, int64 DownloadBytesTotal, float DownloadProgressRatio)
+{
+	FullDownloadBytesReceived = DownloadBytesReceived;
+	DownloadProgress(DownloadBytesReceived, DownloadBytesTotal);
+}
+
+void UAsyncAction_DownloadModfileUpdate::FullDownloadCompleted(EDownloadToStorageResult DownloadResult)
+{
+	switch (DownloadResult)
+	{
+		case EDownloadToStorageResult::Success:
+		case EDownloadToStorageResult::SucceededByPayload:
+			DownloadMessage.BytesTransferred += FullDownloadBytesReceived;
+			DownloadCompleted(EModioAPI_DownloadResult::DownloadResult_CompletedSuccessfully, "Download Successful! The whole Zip-Archive was downloaded: " + FullDownloadReason);
+			break;
+		case EDownloadToStorageResult::Cancelled:
+			DownloadCompleted(EModioAPI_DownloadResult::DownloadResult_Cancelled, "Download Cancelled!");
+			break;
+		case EDownloadToStorageResult::DownloadFailed:
+		default:
+			DownloadCompleted(EModioAPI_DownloadResult::DownloadResult_CompletedFailed, "Download Failed!");
+			break;
+	}
+}
+
+void UAsyncAction_DownloadModfileUpdate::Cancel()
+{
+	bCancelled = true;
+
+	if (ChunkDownloader.IsValid())
+	{
+		ChunkDownloader->CancelDownload();
+	}
+
+	if (Downloader)
+	{
+		Downloader->CancelDownload();
+	}
+}
+
+void UAsyncAction_DownloadModfileUpdate::Activate()
+{
+	DownloadMessage = FModioAPI_DownloadModfileUpdateMessage();
+	DownloadMessage.Modfile = Modfile;
+	DownloadMessage.ProgressInfo = FModioAPI_DownloadFileProgress();
+	DownloadMessage.Result = EModioAPI_DownloadResult::DownloadResult_CompletedFailed;
+
+	if (!ModioConnection)
+	{
+		DownloadMessage.ErrorMessage = "Modio Connection is invalid / missing!";
+		Error.Broadcast(DownloadMessage);
+		return;
+	}
+
+	if (!ModioConnection->IsInitialized())
+	{
+		DownloadMessage.ErrorMessage = "Modio Connection is not initialized!";
+		Error.Broadcast(DownloadMessage);
+		return;
+	}
+
+	if (Modfile.Mod_ID <= 0)
+	{
+		DownloadMessage.ErrorMessage = "ModID is invalid!";
+		Error.Broadcast(DownloadMessage);
+		return;
+	}
+
+	if (Modfile.ID <= 0)
+	{
+		DownloadMessage.ErrorMessage = "ModfileID is invalid!";
+		Error.Broadcast(DownloadMessage);
+		return;
+	}
+
+	if (PreviousModfile.Mod_ID != Modfile.Mod_ID || PreviousModfile.ID == Modfile.ID)
+	{
+		DownloadMessage.ErrorMessage = "Previous Modfile has to be another Modfile of the same Mod!";
+		Error.Broadcast(DownloadMessage);
+		return;
+	}
+
+	FString ReserveMessage;
+	if (!ModioConnection->ReserveCacheSpace(Modfile.Mod_ID, Modfile.Filesize, ReserveMessage))
+	{
+		DownloadMessage.Result = EModioAPI_DownloadResult::DownloadResult_InsufficientSpace;
+		DownloadMessage.ErrorMessage = ReserveMessage;
+		Error.Broadcast(DownloadMessage);
+		return;
+	}
+
+	ReservedCacheBytes = Modfile.Filesize;
+
+	FileDownloadURL = ModioConnection->GetApiPath() + ModioConnection->EndpointGames + "/" + FString::FromInt(ModioConnection->ModioGameID) + ModioConnection->EndpointMods + "/" + FString::FromInt(Modfile.Mod_ID) + ModioConnection->EndpointFiles + "/" + FString::FromInt(Modfile.ID) + ModioConnection->EndpointDownload;
+	FileDownloadPath = ModioConnection->GetModfileDirectoryPathForModfile(Modfile.Mod_ID, Modfile.ID) + Modfile.Filename;
+
+	DownloadStarted();
+
+	FString Message;
+	if (!ModioConnection->GetModfilePathFromCache(PreviousModfile.Mod_ID, PreviousModfile.ID, PreviousFilePath, Message))
+	{
+		StartFullDownload(Message);
+		return;
+	}
+
+	if (!PreviousCentralDirectory.ReadFromFile(PreviousFilePath))
+	{
+		StartFullDownload("Unable to read the previous Zip-Archive! " + PreviousCentralDirectory.GetErrorMessage());
+		return;
+	}
+
+	// A rebuilt Zip-Archive that can't be verified isn't trusted
+	if (Modfile.Filehash.MD5.IsEmpty())
+	{
+		StartFullDownload("The Modfile has no MD5 to verify a rebuilt Zip-Archive against!");
+		return;
+	}
+
+	TWeakObjectPtr<UAsyncAction_DownloadModfileUpdate> WeakThis(this);
+
+	ChunkDownloader = MakeShared<FRuntimeChunkDownloader>();
+	ChunkDownloader->GetContentSize(FileDownloadURL, 0).Next([WeakThis](int64 FileSize)
+	{
+		if (!WeakThis.IsValid())
+		{
+			return;
+		}
+
+		if (WeakThis->bCancelled)
+		{
+			WeakThis->DownloadCompleted(EModioAPI_DownloadResult::DownloadResult_Cancelled, "Download Cancelled!");
+			return;
+		}
+
+		if (FileSize <= 0 || WeakThis->ChunkDownloader->GetDownloadSession().RefusesRanges())
+		{
+			WeakThis->StartFullDownload("The Zip-Archive can't be downloaded in Ranges!");
+			return;
+		}
+
+		WeakThis->ContentSize = FileSize;
+		WeakThis->RequestCentralDirectory(FMath::Min(FileSize, FRuntimeArchiverZipCentralDirectory::DefaultTailSize));
+	});
+}
+
+UAsyncAction_DownloadModfileUpdate* UAsyncAction_DownloadModfileUpdate::AsyncActionDownloadModfileUpdate(UObject* WorldContextObject, UModioAPIObject* ModioConnection, FString AccessToken, FModioAPI_Modfile PreviousModfile, FModioAPI_Modfile Modfile)
+{
+	// Create Action Instance for Blueprint System
+	UAsyncAction_DownloadModfileUpdate* Action = NewObject<UAsyncAction_DownloadModfileUpdate>();
+	Action->ModioConnection = ModioConnection;
+	Action->AccessToken = AccessToken;
+	Action->PreviousModfile = PreviousModfile;
+	Action->Modfile = Modfile;
+	Action->RegisterWithGameInstance(WorldContextObject);
+
+	return Action;
+}
@@ -0,0 +1,562 @@
+/*
+Copyright © 2023 Arvur GmbH / Robin Hasenbach.
+Released under GNU AGPLv3 License.
+*/
+
+#include "AsyncActions/InstallModfile.h"
+#include "RuntimeChunkDownloader.h"
+#include "FileToMemoryDownloader.h"
+#include "ArchiverZip/RuntimeArchiverZipStreamExtractor.h"
+#include "Async/Async.h"
+#include "Containers/Queue.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "JsonObjectConverter.h"
+#include <atomic>
+
+#if PLATFORM_WINDOWS
+#include "Windows/WindowsHWrapper.h"
+#elif PLATFORM_UNIX || PLATFORM_MAC || PLATFORM_IOS || PLATFORM_ANDROID
+#include <unistd.h>
+#endif
+
+namespace
+{
+	// Size of the Ranges the Modfile is downloaded in. Each downloaded Range is extracted while the next one is being downloaded
+	constexpr int64 InstallChunkSize = 8 * 1024 * 1024;
+
+	// Downloaded Bytes waiting for the Extraction at most before the Download is held back, so a slow Disk doesn't make the Zip-Archive pile up in Memory
+	constexpr int64 MaxPendingInstallBytes = 4 * InstallChunkSize;
+
+	// Size of the Blocks Files are read in for hashing them
+	constexpr int64 HashBlockSize = 1024 * 1024;
+
+	FString HashFile(const FString& FilePath)
+	{
+		TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+		if (!FileHandle.IsValid())
+		{
+			return FString();
+		}
+
+		FSHA1 Sha1;
+		TArray<uint8> Block;
+		Block.SetNumUninitialized(HashBlockSize);
+
+		for (int64 RemainingSize = FileHandle->Size(); RemainingSize > 0;)
+		{
+			const int64 BlockSize = FMath::Min(RemainingSize, HashBlockSize);
+			if (!FileHandle->Read(Block.GetData(), BlockSize))
+			{
+				return FString();
+			}
+
+			Sha1.Update(Block.GetData(), BlockSize);
+			RemainingSize -= BlockSize;
+		}
+
+		Sha1.Final();
+
+		FSHAHash Hash;
+		Sha1.GetHash(Hash.Hash);
+		return Hash.ToString();
+	}
+
+	// Hardlinks keep a File on Disk only once while it is reachable by several Paths. Not every Platform or File System supports them
+	bool LinkFile(const FString& ExistingFilePath, const FString& NewFilePath)
+	{
+		const FString FullExistingFilePath = FPaths::ConvertRelativePathToFull(ExistingFilePath);
+		const FString FullNewFilePath = FPaths::ConvertRelativePathToFull(NewFilePath);
+
+#if PLATFORM_WINDOWS
+		return CreateHardLinkW(*FullNewFilePath, *FullExistingFilePath, nullptr) != 0;
+#elif PLATFORM_UNIX || PLATFORM_MAC || PLATFORM_IOS || PLATFORM_ANDROID
+		return link(TCHAR_TO_UTF8(*FullExistingFilePath), TCHAR_TO_UTF8(*FullNewFilePath)) == 0;
+#else
+		return false;
+#endif
+	}
+
+	// Key identifying a File of an installed Modfile by what is known about it before it is extracted
+	FString MakeKnownFileKey(const FString& Path, uint32 Crc32, int64 Size)
+	{
+		return FString::Printf(TEXT("%s|%08x|%lld"), *Path, Crc32, Size);
+	}
+}
+
+/**
+ * Where the Files of an installed Modfile are deduplicated and which Files of previously installed Modfiles of the same Mod are known
+ */
+struct FModioAPI_InstallContentStore
+{
+	FString ContentStoreDirectory;
+	FString ManifestFilePath;
+	FModioAPI_ModfileManifest Manifest;
+
+	// Key = Known File Key | Value = Hash of the File
+	TMap<FString, FString> KnownFiles;
+
+	FString GetStoredFilePath(const FString& Hash) const
+	{
+		return ContentStoreDirectory + Hash.Left(2) + "/" + Hash;
+	}
+};
+
+/**
+ * Feeds the downloaded Ranges of a Modfile to the Zip-Extractor on a background thread, in the order they were downloaded
+ */
+class FModioAPI_InstallModfilePipeline : public TSharedFromThis<FModioAPI_InstallModfilePipeline, ESPMode::ThreadSafe>
+{
+public:
+	using FOnFinished = TFunction<void(bool, const FString&)>;
+
+	FModioAPI_InstallModfilePipeline(const FString& InInstallDirectory, FModioAPI_InstallContentStore&& InContentStore, FOnFinished&& InOnFinished)
+		: Extractor(InInstallDirectory)
+		, InstallDirectory(FPaths::ConvertRelativePathToFull(InInstallDirectory))
+		, ContentStore(MoveTemp(InContentStore))
+		, OnFinished(MoveTemp(InOnFinished))
+		, PendingBytes(0)
+		, bExtracting(false)
+		, bDownloadFinished(false)
+		, bDownloadSucceeded(false)
+		, bFinished(false)
+		, bContentStoreInstallEnded(false)
+	{
+		// Files linked into the Content Store before the Manifest is written must not be swept in the meantime
+		UModioAPIObject::BeginContentStoreInstall();
+
+		// Unchanged Files are taken from the Content Store after the Download instead of being extracted again
+		Extractor.SetShouldSkipEntry([this](const FString& EntryName, uint32 Crc32, int64 UncompressedSize)
+		{
+			const FString* Hash = ContentStore.KnownFiles.Find(MakeKnownFileKey(EntryName, Crc32, UncompressedSize));
+			return Hash && FPaths::FileExists(ContentStore.GetStoredFilePath(*Hash));
+		});
+	}
+
+	~FModioAPI_InstallModfilePipeline()
+	{
+		EndContentStoreInstall();
+	}
+
+	// Called on the Game-Thread for each downloaded Range
+	void AddChunk(TArray64<uint8>&& ChunkData)
+	{
+		PendingBytes += ChunkData.Num();
+		PendingChunks.Enqueue(MoveTemp(ChunkData));
+		ScheduleExtraction();
+	}
+
+	// Called on the Game-Thread before the next Range is requested
+	bool CanAcceptChunk() const
+	{
+		return PendingBytes < MaxPendingInstallBytes;
+	}
+
+	// Called on the Game-Thread once the Download is over
+	void FinishDownload(bool bSuccess, const FString& Message)
+	{
+		DownloadMessage = Message;
+		bDownloadSucceeded = bSuccess;
+		bDownloadFinished = true;
+		ScheduleExtraction();
+	}
+
+private:
+	// Only one Extraction-Task runs at a time, so the Ranges are extracted in order
+	void ScheduleExtraction()
+	{
+		if (bExtracting.exchange(true))
+		{
+			return;
+		}
+
+		TSharedRef<FModioAPI_InstallModfilePipeline, ESPMode::ThreadSafe> SharedThis = AsShared();
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [SharedThis]()
+		{
+			SharedThis->ExtractPendingChunks();
+		});
+	}
+
+	void ExtractPendingChunks()
+	{
+		do
+		{
+			TArray64<uint8> ChunkData;
+			while (PendingChunks.Dequeue(ChunkData))
+			{
+				if (!Extractor.HasFailed())
+				{
+					Extractor.Append(ChunkData.GetData(), ChunkData.Num());
+				}
+
+				PendingBytes -= ChunkData.Num();
+			}
+
+			if (bDownloadFinished && !bFinished && PendingChunks.IsEmpty())
+			{
+				bFinished = true;
+				CompleteInstall();
+			}
+
+			bExtracting = false;
+		}
+		// A Range may have been added after the Queue was emptied but before the Flag was reset
+		while ((!PendingChunks.IsEmpty() || (bDownloadFinished && !bFinished)) && !bExtracting.exchange(true));
+	}
+
+	void CompleteInstall()
+	{
+		bool bSuccess = false;
+		FString Message;
+
+		if (!bDownloadSucceeded)
+		{
+			Message = DownloadMessage;
+		}
+		else if (Extractor.HasFailed() || !Extractor.Finish())
+		{
+			Message = "Extraction Failed! " + Extractor.GetErrorMessage();
+		}
+		else if (!StoreFiles(Message))
+		{
+			Message = "Storing Files Failed! " + Message;
+		}
+		else
+		{
+			bSuccess = true;
+			Message = FString::Printf(TEXT("Installation Successful! Extracted %d Files (%lld Bytes), %lld Bytes unchanged, %lld Bytes deduplicated."), Extractor.GetExtractedFilePaths().Num(), Extractor.GetNumOfExtractedBytes(), ContentStore.Manifest.SkippedBytes, ContentStore.Manifest.DeduplicatedBytes);
+		}
+
+		// Partially installed Modfiles are removed, so they can't be mistaken for complete ones
+		if (!bSuccess)
+		{
+			IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+			for (const FString& ExtractedFilePath : Extractor.GetExtractedFilePaths())
+			{
+				PlatformFile.DeleteFile(*ExtractedFilePath);
+			}
+			for (const FString& LinkedFilePath : LinkedFilePaths)
+			{
+				PlatformFile.DeleteFile(*LinkedFilePath);
+			}
+		}
+
+		// The Manifest is written or the Files are removed again, a Sweep can't take anything away from the Installation anymore
+		EndContentStoreInstall();
+
+		AsyncTask(ENamedThreads::GameThread, [OnFinished = OnFinished, bSuccess, Message]()
+		{
+			OnFinished(bSuccess, Message);
+		});
+	}
+
+	void EndContentStoreInstall()
+	{
+		if (!bContentStoreInstallEnded)
+		{
+			bContentStoreInstallEnded = true;
+			UModioAPIObject::EndContentStoreInstall();
+		}
+	}
+
+	// Moves the extracted Files into the Content Store, restores the skipped ones from it and writes the Manifest that marks the Modfile as installed
+	bool StoreFiles(FString& Message)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		FModioAPI_ModfileManifest& Manifest = ContentStore.Manifest;
+
+		for (const TPair<FString, FRuntimeArchiverZipStreamExtractor::FExtractedEntry>& Entry : Extractor.GetExtractedEntries())
+		{
+			// Directories are not stored
+			if (Entry.Key.EndsWith(TEXT("/")))
+			{
+				continue;
+			}
+
+			const FString FilePath = FPaths::Combine(InstallDirectory, Entry.Key);
+
+			FModioAPI_ModfileManifestEntry ManifestEntry;
+			ManifestEntry.Path = Entry.Key;
+			ManifestEntry.Size = Entry.Value.UncompressedSize;
+			ManifestEntry.Crc32 = Entry.Value.Crc32;
+
+			if (Entry.Value.bSkipped)
+			{
+				ManifestEntry.Hash = ContentStore.KnownFiles.FindChecked(MakeKnownFileKey(Entry.Key, Entry.Value.Crc32, Entry.Value.UncompressedSize));
+
+				const FString FileDirectory = FPaths::GetPath(FilePath);
+				if (!PlatformFile.DirectoryExists(*FileDirectory) && !PlatformFile.CreateDirectoryTree(*FileDirectory))
+				{
+					Message = "Unable to create Directory '" + FileDirectory + "'!";
+					return false;
+				}
+
+				if (!PlaceStoredFile(ContentStore.GetStoredFilePath(ManifestEntry.Hash), FilePath))
+				{
+					Message = "Unable to restore unchanged File '" + Entry.Key + "' from the Content Store!";
+					return false;
+				}
+
+				Manifest.SkippedBytes += ManifestEntry.Size;
+			}
+			else
+			{
+				ManifestEntry.Hash = HashFile(FilePath);
+				if (ManifestEntry.Hash.IsEmpty())
+				{
+					Message = "Unable to hash File '" + Entry.Key + "'!";
+					return false;
+				}
+
+				const FString StoredFilePath = ContentStore.GetStoredFilePath(ManifestEntry.Hash);
+				if (PlatformFile.FileExists(*StoredFilePath))
+				{
+					// The same Content is already stored, the extracted Copy is replaced by it
+					if (!PlatformFile.DeleteFile(*FilePath) || !PlaceStoredFile(StoredFilePath, FilePath))
+					{
+						Message = "Unable to replace File '" + Entry.Key + "' with its stored Copy!";
+						return false;
+					}
+
+					Manifest.DeduplicatedBytes += ManifestEntry.Size;
+				}
+				else
+				{
+					// Without Hardlinks the File stays where it was extracted to and won't be deduplicated
+					const FString StoredFileDirectory = FPaths::GetPath(StoredFilePath);
+					if (PlatformFile.DirectoryExists(*StoredFileDirectory) || PlatformFile.CreateDirectoryTree(*StoredFileDirectory))
+					{
+						LinkFile(FilePath, StoredFilePath);
+					}
+				}
+			}
+
+			Manifest.Files.Add(ManifestEntry);
+		}
+
+		FString ManifestString;
+		if (!FJsonObjectConverter::UStructToJsonObjectString(Manifest, ManifestString) || !FFileHelper::SaveStringToFile(ManifestString, *ContentStore.ManifestFilePath))
+		{
+			Message = "Unable to write the Modfile Manifest!";
+			return false;
+		}
+
+		return true;
+	}
+
+	// Stored Files are shared by all Modfiles containing them, so they must not be modified in place
+	bool PlaceStoredFile(const FString& StoredFilePath, const FString& FilePath)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		if (PlatformFile.FileExists(*FilePath))
+		{
+			PlatformFile.DeleteFile(*FilePath);
+		}
+
+		if (!LinkFile(StoredFilePath, FilePath) && !PlatformFile.CopyFile(*FilePath, *StoredFilePath))
+		{
+			return false;
+		}
+
+		LinkedFilePaths.Add(FilePath);
+		return true;
+	}
+
+	FRuntimeArchiverZipStreamExtractor Extractor;
+	FString InstallDirectory;
+	FModioAPI_InstallContentStore ContentStore;
+	FOnFinished OnFinished;
+
+	// Files placed from the Content Store, removed again if the Installation fails
+	TArray<FString> LinkedFilePaths;
+
+	TQueue<TArray64<uint8>, EQueueMode::Spsc> PendingChunks;
+	std::atomic<int64> PendingBytes;
+	std::atomic<bool> bExtracting;
+	std::atomic<bool> bDownloadFinished;
+	std::atomic<bool> bDownloadSucceeded;
+	FString DownloadMessage;
+
+	// Only accessed by the running Extraction-Task
+	bool bFinished;
+	bool bContentStoreInstallEnded;
+};
+
+void UAsyncAction_InstallModfile::DownloadStarted()
+{
+	DownloadMessage.ProgressInfo = FModioAPI_DownloadFileProgress();
+	DownloadMessage.ProgressInfo.BytesReceived = -1;
+	DownloadMessage.ProgressInfo.BytesTotal = -1;
+	DownloadMessage.ProgressInfo.Progress = 0;
+	DownloadMessage.ErrorMessage = "Installation started!";
+	DownloadMessage.Result = EModioAPI_DownloadResult::DownloadResult_Running;
+	Started.Broadcast(DownloadMessage);
+}
+
+void UAsyncAction_InstallModfile::DownloadProgress(int64 DownloadBytesReceived, int64 DownloadBytesTotal)
+{
+	DownloadMessage.ProgressInfo = FModioAPI_DownloadFileProgress();
+	DownloadMessage.ProgressInfo.BytesReceived = DownloadBytesReceived;
+	DownloadMessage.ProgressInfo.BytesTotal = DownloadBytesTotal;
+	DownloadMessage.ProgressInfo.Progress = DownloadBytesTotal <= 0 ? 0 : static_cast<float>(DownloadBytesReceived) / DownloadBytesTotal;
+	DownloadMessage.ErrorMessage = "Downloading & Extracting...";
+	Progress.Broadcast(DownloadMessage);
+}
+
+void UAsyncAction_InstallModfile::InstallCompleted(bool bSuccess, const FString& Message)
+{
+	DownloadMessage.Result = bSuccess ? EModioAPI_DownloadResult::DownloadResult_CompletedSuccessfully : EModioAPI_DownloadResult::DownloadResult_CompletedFailed;
+	DownloadMessage.ErrorMessage = Message;
+
+	ChunkDownloader.Reset();
+	InstallPipeline.Reset();
+
+	ModioConnection->ReleaseCacheSpace(Modfile.Mod_ID, ReservedCacheBytes);
+	ReservedCacheBytes = 0;
+
+	Completed.Broadcast(DownloadMessage);
+}
+
+void UAsyncAction_InstallModfile::Cancel()
+{
+	if (ChunkDownloader.IsValid())
+	{
+		ChunkDownloader->CancelDownload();
+	}
+}
+
+void UAsyncAction_InstallModfile::Activate()
+{
+	DownloadMessage = FModioAPI_DownloadModfileMessage();
+	DownloadMessage.Modfile = Modfile;
+	DownloadMessage.ProgressInfo = FModioAPI_DownloadFileProgress();
+	DownloadMessage.Result = EModioAPI_DownloadResult::DownloadResult_CompletedFailed;
+
+	if (!ModioConnection)
+	{
+		DownloadMessage.ErrorMessage = "Modio Connection is invalid / missing!";
+		Error.Broadcast(DownloadMessage);
+		return;
+	}
+
+	if (!ModioConnection->IsInitialized())
+	{
+		DownloadMessage.ErrorMessage = "Modio Connection is not initialized!";
+		Error.Broadcast(DownloadMessage);
+		return;
+	}
+
+	if (Modfile.Mod_ID <= 0)
+	{
+		DownloadMessage.ErrorMessage = "ModID is invalid!";
+		Error.Broadcast(DownloadMessage);
+		return;
+	}
+
+	if (Modfile.ID <= 0)
+	{
+		DownloadMessage.ErrorMessage = "ModfileID is invalid!";
+		Error.Broadcast(DownloadMessage);
+		return;
+	}
+
+	// Only the extracted Files are written, the Zip-Archive is streamed
+	int64 RequiredBytes = Modfile.Filesize_Uncompressed > 0 ? Modfile.Filesize_Uncompressed : Modfile.Filesize;
+
+	FString ReserveMessage;
+	if (!ModioConnection->ReserveCacheSpace(Modfile.Mod_ID, RequiredBytes, ReserveMessage))
+	{
+		DownloadMessage.Result = EModioAPI_DownloadResult::DownloadResult_InsufficientSpace;
+		DownloadMessage.ErrorMessage = ReserveMessage;
+		Error.Broadcast(DownloadMessage);
+		return;
+	}
+
+	ReservedCacheBytes = RequiredBytes;
+
+	FString FileDownloadURL = ModioConnection->GetApiPath() + ModioConnection->EndpointGames + "/" + FString::FromInt(ModioConnection->ModioGameID) + ModioConnection->EndpointMods + "/" + FString::FromInt(Modfile.Mod_ID) + ModioConnection->EndpointFiles + "/" + FString::FromInt(Modfile.ID) + ModioConnection->EndpointDownload;
+	FString ModfileInstallDirectory = InstallDirectory.IsEmpty() ? ModioConnection->GetModfileDirectoryPathForModfile(Modfile.Mod_ID, Modfile.ID) : InstallDirectory;
+
+	TWeakObjectPtr<UAsyncAction_InstallModfile> WeakThis(this);
+
+	// Files of the previously installed Modfiles of the Mod are recognized by their Path, CRC-32 and Size
+	FModioAPI_InstallContentStore ContentStore;
+	ContentStore.ContentStoreDirectory = ModioConnection->GetContentStoreDirectoryPath();
+	ContentStore.ManifestFilePath = ModioConnection->GetManifestFilePathForModfile(Modfile.Mod_ID, Modfile.ID);
+	ContentStore.Manifest.Mod_ID = Modfile.Mod_ID;
+	ContentStore.Manifest.Modfile_ID = Modfile.ID;
+
+	for (const FModioAPI_ModfileManifest& InstalledManifest : ModioConnection->LoadModfileManifestsForMod(Modfile.Mod_ID))
+	{
+		for (const FModioAPI_ModfileManifestEntry& InstalledFile : InstalledManifest.Files)
+		{
+			ContentStore.KnownFiles.Add(MakeKnownFileKey(InstalledFile.Path, static_cast<uint32>(InstalledFile.Crc32), InstalledFile.Size), InstalledFile.Hash);
+		}
+	}
+
+	const FString ManifestFilePath = ContentStore.ManifestFilePath;
+
+	InstallPipeline = MakeShared<FModioAPI_InstallModfilePipeline, ESPMode::ThreadSafe>(ModfileInstallDirectory, MoveTemp(ContentStore), [WeakThis](bool bSuccess, const FString& Message)
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->InstallCompleted(bSuccess, Message);
+		}
+	});
+
+	// A reinstalled Modfile is only complete again once its new Manifest is written. The Pipeline keeps its stored Files from being swept until then
+	FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*ManifestFilePath);
+
+	DownloadStarted();
+
+	// The Pipeline is kept alive by the Callbacks until the Download and the Extraction are over
+	TSharedPtr<FModioAPI_InstallModfilePipeline, ESPMode::ThreadSafe> Pipeline = InstallPipeline;
+	ChunkDownloader = MakeShared<FRuntimeChunkDownloader>();
+
+	// The next Range is only requested once the Extraction has caught up
+	ChunkDownloader->SetChunkRequestGate([Pipeline]()
+	{
+		return Pipeline->CanAcceptChunk();
+	});
+
+	ChunkDownloader->DownloadFilePerChunk(FileDownloadURL, 0, "", InstallChunkSize, FInt64Vector2(), [WeakThis](int64 BytesReceived, int64 ContentSize)
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->DownloadProgress(BytesReceived, ContentSize);
+		}
+	}, [Pipeline](TArray64<uint8>&& ChunkData)
+	{
+		Pipeline->AddChunk(MoveTemp(ChunkData));
+	}).Next([Pipeline](EDownloadToMemoryResult Result)
+	{
+		switch (Result)
+		{
+			case EDownloadToMemoryResult::Success:
+			case EDownloadToMemoryResult::SucceededByPayload:
+				Pipeline->FinishDownload(true, "Download Successful!");
+				break;
+			case EDownloadToMemoryResult::Cancelled:
+				Pipeline->FinishDownload(false, "Download Cancelled!");
+				break;
+			default:
+				Pipeline->FinishDownload(false, "Download Failed!");
+				break;
+		}
+	});
+}
+
+UAsyncAction_InstallModfile* UAsyncAction_InstallModfile::AsyncActionInstallModfile(UObject* WorldContextObject, UModioAPIObject* ModioConnection, FString AccessToken, FModioAPI_Modfile Modfile, FString InstallDirectory)
+{
+	// Create Action Instance for Blueprint System
+	UAsyncAction_InstallModfile* Action = NewObject<UAsyncAction_InstallModfile>();
+	Action->ModioConnection = ModioConnection;
+	Action->AccessToken = AccessToken;
+	Action->Modfile = Modfile;
+	Action->InstallDirectory = InstallDirectory;
+	Action->RegisterWithGameInstance(WorldContextObject);
+
+	return Action;
+}
@@ -28,6 +28,15 @@ FModioAPI_Error_Object UModioAPIFunctionLibrary::ConvertJsonObjectToError(TShare
     return Error;
 }
 
+FModioAPI_Error_Object UModioAPIFunctionLibrary::MakeConnectionFailedError()
+{
+    FModioAPI_Error_Object Error;
+    Error.Error.Code = 0;
+    Error.Error.Error_Ref = 0;
+    Error.Error.Message = "Connection to mod.io failed or timed out!";
+    return Error;
+}
+
 FModioAPI_Terms UModioAPIFunctionLibrary::ConvertJsonObjectToTermsOfService(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message)
 {
     if (!JsonObject)
@@ -582,6 +591,30 @@ FModioAPI_GetModfiles UModioAPIFunctionLibrary::ConvertJsonObjectToGetModfiles(T
     return GetUserModfiles;
 }
 
+FModioAPI_GetModDependencies UModioAPIFunctionLibrary::ConvertJsonObjectToGetModDependencies(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message)
+{
+    if (!JsonObject)
+    {
+        Success = false;
+        Message = "No Json Object for Conversion!";
+        return FModioAPI_GetModDependencies();
+    }
+
+    FModioAPI_GetModDependencies_Schema GetModDependenciesSchema;
+    if (!FJsonObjectConverter::JsonObjectToUStruct<FModioAPI_GetModDependencies_Schema>(JsonObject.ToSharedRef(), &GetModDependenciesSchema))
+    {
+        Success = false;
+        Message = "Error converting JSON Object to Get Mod Dependencies!";
+        return FModioAPI_GetModDependencies();
+    }
+
+    FModioAPI_GetModDependencies GetModDependencies = ConvertGetModDependenciesSchemaToGetModDependencies(GetModDependenciesSchema);
+
+    Success = true;
+    Message = "Successfully converted JSON Object to Mod Dependencies!";
+    return GetModDependencies;
+}
+
 FModioAPI_GetMultipartUploadParts UModioAPIFunctionLibrary::ConvertJsonObjectToGetMultipartUploadParts(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message)
 {
     if (!JsonObject)
@@ -1126,6 +1159,31 @@ FModioAPI_GetModfiles UModioAPIFunctionLibrary::ConvertGetModfilesSchemaToGetMod
     return ReturnValue;
 }
 
+FModioAPI_GetModDependencies UModioAPIFunctionLibrary::ConvertGetModDependenciesSchemaToGetModDependencies(FModioAPI_GetModDependencies_Schema GetModDependenciesSchema)
+{
+    FModioAPI_GetModDependencies ReturnValue;
+
+    for (FModioAPI_ModDependencies_Object ModDependenciesObject : GetModDependenciesSchema.Data)
+    {
+        FModioAPI_ModDependencies ModDependencies;
+        ModDependencies.Mod_ID = ModDependenciesObject.Mod_ID;
+        ModDependencies.Name = ModDependenciesObject.Name;
+        ModDependencies.Name_ID = ModDependenciesObject.Name_ID;
+        ModDependencies.Date_Added = FDateTime::FromUnixTimestamp(ModDependenciesObject.Date_Added);
+        ModDependencies.Dependency_Depth = ModDependenciesObject.Dependency_Depth;
+        ModDependencies.Logo = ModDependenciesObject.Logo;
+        ModDependencies.Modfile = ConvertModfileObjectToModfile(ModDependenciesObject.Modfile);
+        ReturnValue.Data.Add(ModDependencies);
+    }
+
+    ReturnValue.Result_Count = GetModDependenciesSchema.Result_Count;
+    ReturnValue.Result_Limit = GetModDependenciesSchema.Result_Limit;
+    ReturnValue.Result_Offset = GetModDependenciesSchema.Result_Offset;
+    ReturnValue.Result_Total = GetModDependenciesSchema.Result_Total;
+
+    return ReturnValue;
+}
+
 FModioAPI_MultipartUploadPart UModioAPIFunctionLibrary::ConvertMultipartUploadPartObjectToMultipartUploadPart(FModioAPI_MultipartUploadPart_Object MultipartUploadPartObject)
 {
     FModioAPI_MultipartUploadPart ReturnValue;
@@ -1387,6 +1445,27 @@ int32 UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(FString RequestURL, F
     return FCString::Atoi(*Output);
 }
 
+int32 UModioAPIFunctionLibrary::ExtractOffsetFromRequestURL(FString RequestURL)
+{
+    FString LeftSplit;
+    FString RightSplit;
+
+    // Requests without Offset start at the first Page
+    if (!RequestURL.Split("_offset=", &LeftSplit, &RightSplit, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+    {
+        return 0;
+    }
+
+    // Find Ampersand after Offset
+    int32 AmpersandIndex;
+    if (RightSplit.FindChar('&', AmpersandIndex))
+    {
+        RightSplit = RightSplit.Left(AmpersandIndex);
+    }
+
+    return FCString::Atoi(*RightSplit);
+}
+
 FModioAPI_ModStats UModioAPIFunctionLibrary::ConvertModStatsObjectToModStats(FModioAPI_ModStats_Object ModstatsObject)
 {
     FModioAPI_ModStats Stats = FModioAPI_ModStats();
@@ -1464,6 +1543,11 @@ FString UModioAPIFunctionLibrary::ConvertPlatformToPlatformCode(TEnumAsByte<EMod
 TSharedPtr<FJsonObject> UModioAPIFunctionLibrary::ConvertResponseToJsonObject(FHttpResponsePtr Response)
 {
     TSharedPtr<FJsonObject> ResponseObj;
+    if (!Response.IsValid())
+    {
+        return ResponseObj;
+    }
+
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
     FJsonSerializer::Deserialize(Reader, ResponseObj);
 
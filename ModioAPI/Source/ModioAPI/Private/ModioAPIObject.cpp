@@ -4,6 +4,27 @@ Released under GNU AGPLv3 License.
 */
 
 #include "ModioAPIObject.h"
+#include "Objects/ModioAPISubscriptionSyncObject.h"
+#include "Objects/ModioAPIPrefetchObject.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+
+CSV_DEFINE_CATEGORY(ModioAPI, true);
+
+namespace
+{
+	// Shared by all Connections, they install into the same Content Store
+	FCriticalSection ContentStoreLock;
+	int32 NumOfContentStoreInstalls = 0;
+
+	// Incremented by every Installation, a Sweep that saw it change may have read the Manifests while one was rewritten
+	uint32 ContentStoreInstallRevision = 0;
+
+	// Mods and Content Store Directory of the last Sweep skipped because of a running Installation
+	TOptional<TPair<FString, FString>> PendingContentStoreSweep;
+}
 
 FModioAPI_AccessToken UModioAPIObject::GetPersistingCacheAccessToken()
 {
@@ -45,6 +66,35 @@ bool UModioAPIObject::InitializeModioAPI(int32 GameID, FString ApiKey, bool Auto
 		}
 	}
 
+	// Try loading the Response Cache, so unchanged Responses don't need to be downloaded again
+	FString LoadResponseCacheMessage;
+	LoadResponseCacheFromFile(LoadResponseCacheMessage);
+
+	// Open Connections before the first Requests need them, only if the Policy opts in
+	ApplyConnectionPolicy();
+	if (ConnectionPolicy.WarmUpConnections > 0)
+	{
+		WarmUpConnections(ConnectionPolicy.WarmUpConnections);
+	}
+
+	// Measured in the Background, so reserving Cache Space doesn't need to walk the Mod Directories
+	MeasureCachedModSizes(INDEX_NONE);
+
+	// Evicted Directories whose Deletion was interrupted by closing the Game
+	TArray<FString> EvictedDirectoryNames;
+	IFileManager::Get().FindFiles(EvictedDirectoryNames, *(GetModsDirectoryPath() + "Evicted_*"), false, true);
+
+	TArray<FString> EvictedDirectories;
+	for (const FString& EvictedDirectoryName : EvictedDirectoryNames)
+	{
+		EvictedDirectories.Add(GetModsDirectoryPath() + EvictedDirectoryName);
+	}
+
+	if (EvictedDirectories.Num() > 0)
+	{
+		DeleteEvictedDirectories(MoveTemp(EvictedDirectories), 0);
+	}
+
 	Message = "Connection for GameID " + FString::FromInt(GameID) + " initialized!";
 	return true;
 }
@@ -289,958 +339,3164 @@ bool UModioAPIObject::LoadPersistingCacheFromFile(FString& Message)
 	return true;
 }
 
-FString UModioAPIObject::GetUsersDirectoryPath()
+/*
+Request Dispatching
+*/
+
+int32 UModioAPIObject::GetInFlightRequestCount()
 {
-	FString ModioUsersPath = GetModioGameDirectory();
+	return InFlightRequests.Num();
+}
 
-	ModioUsersPath.Append("Users/");
+FModioAPI_RateLimitStatus UModioAPIObject::GetRateLimitStatus()
+{
+	RefillRequestBudget();
 
-	if (!IFileManager::Get().DirectoryExists(*ModioUsersPath))
-	{
-		IFileManager::Get().MakeDirectory(*ModioUsersPath, true);
-	}
+	FModioAPI_RateLimitStatus Status;
+	Status.RemainingBudget = RequestBudget;
+	Status.Limit = FMath::RoundToInt(RequestBudgetCapacity);
+	Status.QueuedRequests = RequestQueue.Num();
+	Status.SecondsUntilRetry = FMath::Max(0.0, RateLimitedUntil - FPlatformTime::Seconds());
+	Status.RateLimitedResponses = RateLimitedResponses;
 
-	return ModioUsersPath;
+	return Status;
 }
 
-FString UModioAPIObject::GetAvatarDirectoryPathForUser(int32 UserID)
+void UModioAPIObject::ConfigureRateLimit(int32 RequestsPerMinute, int32 MaxRetries, float BackoffBaseSeconds, float BackoffMaxSeconds)
 {
-	FString ModioUserDirectoryPath = GetUsersDirectoryPath();
-
-	ModioUserDirectoryPath.Append(FString::FromInt(UserID) + "/");
-
-	if (!IFileManager::Get().DirectoryExists(*ModioUserDirectoryPath))
-	{
-		IFileManager::Get().MakeDirectory(*ModioUserDirectoryPath, true);
-	}
+	RefillRequestBudget();
 
-	return ModioUserDirectoryPath;
+	RequestBudgetCapacity = FMath::Max(1, RequestsPerMinute);
+	RequestBudgetRefillPerSecond = RequestBudgetCapacity / 60.0f;
+	RequestBudget = FMath::Min(RequestBudget, RequestBudgetCapacity);
+	MaxRateLimitRetries = FMath::Max(0, MaxRetries);
+	RetryBackoffBaseSeconds = FMath::Max(0.0f, BackoffBaseSeconds);
+	RetryBackoffMaxSeconds = FMath::Max(RetryBackoffBaseSeconds, BackoffMaxSeconds);
 }
 
-FString UModioAPIObject::GetMediaDirectoryPathForGame()
+FModioAPI_RetryPolicy UModioAPIObject::GetRetryPolicy(TEnumAsByte<EModioAPI_RequestClass> RequestClass)
 {
-	FString MediaDirectoryForGame = GetModioGameDirectory();
+	if (FModioAPI_RetryPolicy* RetryPolicy = RetryPolicies.Find(RequestClass))
+	{
+		return *RetryPolicy;
+	}
 
-	MediaDirectoryForGame.Append("Media/");
+	FModioAPI_RetryPolicy DefaultPolicy;
 
-	if (!IFileManager::Get().DirectoryExists(*MediaDirectoryForGame))
+	switch (RequestClass)
 	{
-		IFileManager::Get().MakeDirectory(*MediaDirectoryForGame, true);
+		case RequestClass_IdempotentWrite:
+			// Upload Parts can be large, leave the Timeout to the HTTP Module
+			DefaultPolicy.MaxTotalRetrySeconds = 120.0f;
+			DefaultPolicy.TimeoutSeconds = 0.0f;
+			break;
+		case RequestClass_Write:
+			DefaultPolicy.MaxRetries = 0;
+			DefaultPolicy.TimeoutSeconds = 0.0f;
+			break;
+		default:
+			break;
 	}
 
-	return MediaDirectoryForGame;
+	return DefaultPolicy;
 }
 
-FString UModioAPIObject::GetModsDirectoryPath()
+void UModioAPIObject::SetRetryPolicy(TEnumAsByte<EModioAPI_RequestClass> RequestClass, FModioAPI_RetryPolicy RetryPolicy)
 {
-	FString ModsDirectoryForGame = GetModioGameDirectory();
-
-	ModsDirectoryForGame.Append("Mods/");
+	RetryPolicies.Add(RequestClass, RetryPolicy);
+}
 
-	if (!IFileManager::Get().DirectoryExists(*ModsDirectoryForGame))
+void UModioAPIObject::BeginDestroy()
+{
+	if (RequestQueueTickerHandle.IsValid())
 	{
-		IFileManager::Get().MakeDirectory(*ModsDirectoryForGame, true);
+		FTSTicker::GetCoreTicker().RemoveTicker(RequestQueueTickerHandle);
+		RequestQueueTickerHandle.Reset();
 	}
 
-	return ModsDirectoryForGame;
+	RequestQueue.Empty();
+
+	// Changes waiting for the delayed Save would be lost otherwise
+	FString FlushMessage;
+	FlushResponseCache(FlushMessage);
+
+	Super::BeginDestroy();
 }
 
-FString UModioAPIObject::GetDirectoryPathForMod(int32 ModID)
+bool UModioAPIObject::DispatchRequest(FHttpRequestRef Request, bool IsIdempotent)
 {
-	FString ModDirectory = GetModsDirectoryPath();
+	TRACE_CPUPROFILER_EVENT_SCOPE(ModioAPI_DispatchRequest);
 
-	ModDirectory.Append(FString::FromInt(ModID) + "/");
+	FModioAPI_DispatchedRequest DispatchedRequest;
+	DispatchedRequest.RequestClass = IsIdempotent ? RequestClass_IdempotentWrite : RequestClass_Write;
+	DispatchedRequest.EndpointName = GetEndpointName(Request);
+	FString& RequestKey = DispatchedRequest.RequestKey;
 
-	if (!IFileManager::Get().DirectoryExists(*ModDirectory))
+	// Only GET Requests are side effect free and can be shared between Callers
+	if (Request->GetVerb() == "GET")
 	{
-		IFileManager::Get().MakeDirectory(*ModDirectory, true);
-	}
-
-	return ModDirectory;
-}
+		DispatchedRequest.RequestClass = RequestClass_Read;
 
-FString UModioAPIObject::GetMediaDirectoryPathForMod(int32 ModID)
-{
-	FString ModMediaDirectory = GetDirectoryPathForMod(ModID);
+		// Requests issued by the Prefetcher wait for spare Budget and keep their Response for the Caller
+		if (!DispatchingPrefetchTag.IsEmpty())
+		{
+			return DispatchPrefetch(Request);
+		}
 
-	ModMediaDirectory.Append("Media/");
+		DispatchedRequest.NotModifiedResponse = AddResponseCacheValidators(Request);
 
-	if (!IFileManager::Get().DirectoryExists(*ModMediaDirectory))
-	{
-		IFileManager::Get().MakeDirectory(*ModMediaDirectory, true);
-	}
+		RequestKey = GetInFlightRequestKey(Request);
 
-	return ModMediaDirectory;
-}
+		if (ServeFromPrefetch(Request, RequestKey))
+		{
+			RequestMetrics.Endpoints.FindOrAdd(DispatchedRequest.EndpointName).CoalescedRequests++;
+			return true;
+		}
 
-FString UModioAPIObject::GetGuidesDirectoryPath()
-{
-	FString GuidesDirectoryForGame = GetModioGameDirectory();
+		// An identical Request is already pending, attach to it instead of sending a duplicate
+		if (int32* AttachedCallers = InFlightRequests.Find(RequestKey))
+		{
+			(*AttachedCallers)++;
+			RequestMetrics.Endpoints.FindOrAdd(DispatchedRequest.EndpointName).CoalescedRequests++;
+			return true;
+		}
 
-	GuidesDirectoryForGame.Append("Guides/");
+		InFlightRequests.Add(RequestKey, 1);
+	}
 
-	if (!IFileManager::Get().DirectoryExists(*GuidesDirectoryForGame))
+	FModioAPI_RetryPolicy RetryPolicy = GetRetryPolicy(DispatchedRequest.RequestClass);
+	if (RetryPolicy.TimeoutSeconds > 0.0f)
 	{
-		IFileManager::Get().MakeDirectory(*GuidesDirectoryForGame, true);
+		Request->SetTimeout(RetryPolicy.TimeoutSeconds);
 	}
 
-	return GuidesDirectoryForGame;
-}
+	// HTTP/1.1 and HTTP/2 keep Connections open by default
+	if (!ConnectionPolicy.KeepAlive)
+	{
+		Request->SetHeader("Connection", "close");
+	}
 
-FString UModioAPIObject::GetDirectoryPathForGuide(int32 GuideID)
-{
-	FString GuideDirectory = GetGuidesDirectoryPath();
+	// Wrap the Response Handler, so the Rate Limit is updated and the Request released before the Response gets broadcast
+	DispatchedRequest.ResponseHandler = Request->OnProcessRequestComplete();
+	DispatchedRequest.FirstSentAt = FPlatformTime::Seconds();
+	DispatchedRequest.Timing = MakeShared<FModioAPI_RequestTiming>();
+	Request->OnProcessRequestComplete().BindUObject(this, &UModioAPIObject::DispatchedRequest_ResponseReceived, DispatchedRequest);
 
-	GuideDirectory.Append(FString::FromInt(GuideID) + "/");
+	// The first Header marks the end of DNS, Connect and Server Time
+	TSharedPtr<FModioAPI_RequestTiming> Timing = DispatchedRequest.Timing;
+	Request->OnHeaderReceived().BindLambda([Timing](FHttpRequestPtr HeaderRequest, const FString& HeaderName, const FString& HeaderValue)
+	{
+		if (Timing->FirstByteAt <= 0.0)
+		{
+			Timing->FirstByteAt = FPlatformTime::Seconds();
+		}
+	});
 
-	if (!IFileManager::Get().DirectoryExists(*GuideDirectory))
+	if (!SendOrQueueRequest(Request, 0.0, DispatchedRequest.Timing))
 	{
-		IFileManager::Get().MakeDirectory(*GuideDirectory, true);
+		InFlightRequests.Remove(RequestKey);
+		return false;
 	}
 
-	return GuideDirectory;
+	FModioAPI_EndpointMetrics& EndpointMetrics = RequestMetrics.Endpoints.FindOrAdd(DispatchedRequest.EndpointName);
+	EndpointMetrics.Requests++;
+	EndpointMetrics.BytesSent += Request->GetContentLength();
+	RequestMetrics.BytesSent += Request->GetContentLength();
+	RequestMetrics.ActiveRequests++;
+
+	CSV_CUSTOM_STAT(ModioAPI, ActiveRequests, RequestMetrics.ActiveRequests, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(ModioAPI, BytesSent, static_cast<float>(Request->GetContentLength()), ECsvCustomStatOp::Accumulate);
+
+	return true;
 }
 
-FString UModioAPIObject::GetMediaDirectoryPathForGuide(int32 GuideID)
+FString UModioAPIObject::GetInFlightRequestKey(FHttpRequestRef Request)
 {
-	FString GuideMediaDirectory = GetDirectoryPathForGuide(GuideID);
+	return Request->GetVerb() + " " + Request->GetURL() + " " + Request->GetHeader("Authorization");
+}
 
-	GuideMediaDirectory.Append("Media/");
+bool UModioAPIObject::SendOrQueueRequest(FHttpRequestRef Request, double NotBefore, TSharedPtr<FModioAPI_RequestTiming> Timing)
+{
+	RefillRequestBudget();
 
-	if (!IFileManager::Get().DirectoryExists(*GuideMediaDirectory))
+	const double Now = FPlatformTime::Seconds();
+
+	if (Timing.IsValid())
 	{
-		IFileManager::Get().MakeDirectory(*GuideMediaDirectory, true);
+		*Timing = FModioAPI_RequestTiming();
+		Timing->QueuedAt = Now;
 	}
 
-	return GuideMediaDirectory;
-}
+	// Keep the Order of queued Requests, only send right away if nothing is waiting
+	if (RequestQueue.Num() == 0 && NotBefore <= Now && RateLimitedUntil <= Now && RequestBudget >= 1.0f)
+	{
+		const int32 ConnectionIndex = AcquireConnection(Timing);
+		if (ConnectionIndex != INDEX_NONE)
+		{
+			RequestBudget -= 1.0f;
 
-FString UModioAPIObject::GetDirectoryPathForUploadSession(FString MultipartUploadSessionID)
-{
-	FString UploadSessionDirectory = GetUploadSessionsDirectoryPath();
+			if (Timing.IsValid())
+			{
+				Timing->SentAt = Now;
+			}
 
-	UploadSessionDirectory.Append(MultipartUploadSessionID + "/");
+			if (!Request->ProcessRequest())
+			{
+				ReleaseConnection(ConnectionIndex, nullptr, false);
+				return false;
+			}
 
-	if (!IFileManager::Get().DirectoryExists(*UploadSessionDirectory))
+			return true;
+		}
+
+		ConnectionPoolStats.PoolExhausted++;
+	}
+
+	RequestQueue.Add({Request, NotBefore, Timing});
+	CSV_CUSTOM_STAT(ModioAPI, QueuedRequests, RequestQueue.Num(), ECsvCustomStatOp::Set);
+
+	if (!RequestQueueTickerHandle.IsValid())
 	{
-		IFileManager::Get().MakeDirectory(*UploadSessionDirectory, true);
+		RequestQueueTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UModioAPIObject::ProcessRequestQueue));
 	}
 
-	return UploadSessionDirectory;
+	return true;
 }
 
-void UModioAPIObject::PrepareZipArchiveForMultipartUploadSession(FString ZipArchiveFilePath, FString MultipartUploadSessionID, bool& Success, FString& Message, int64& TotalSize)
+void UModioAPIObject::RefillRequestBudget()
 {
-	if (ZipArchiveFilePath.IsEmpty())
-	{
-		Message = "No Zip Archive File Path provided!";
-		Success = false;
-		return;
-	}
+	const double Now = FPlatformTime::Seconds();
 
-	if (!IFileManager::Get().FileExists(*ZipArchiveFilePath))
+	if (RequestBudgetLastRefill > 0.0)
 	{
-		Message = "Zip Archive File Path not pointing to a File!";
-		Success = false;
-		return;
+		RequestBudget = FMath::Min(RequestBudgetCapacity, RequestBudget + static_cast<float>(Now - RequestBudgetLastRefill) * RequestBudgetRefillPerSecond);
 	}
 
-	if (FPaths::GetExtension(ZipArchiveFilePath, false).ToLower() != "zip")
-	{
-		Message = "Zip Archive File Path not pointing to a Zip-File!";
-		Success = false;
-		return;
-	}
+	RequestBudgetLastRefill = Now;
+}
 
-	if (MultipartUploadSessionID.IsEmpty())
-	{
-		Message = "Multipart Upload Session ID is empty!";
-		Success = false;
-		return;
-	}
+bool UModioAPIObject::ProcessRequestQueue(float DeltaTime)
+{
+	RefillRequestBudget();
 
-	IFileHandle* ZipArchiveFileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenRead(*ZipArchiveFilePath, true);
+	const double Now = FPlatformTime::Seconds();
 
-	if (!ZipArchiveFileHandle)
+	for (int32 Index = 0; Index < RequestQueue.Num() && RateLimitedUntil <= Now && RequestBudget >= 1.0f && HasIdleConnection();)
 	{
-		Message = "No Success with Reading from the Zip Archive File!";
-		Success = false;
-		return;
-	}
+		// Requests waiting for their Retry don't block the ones behind them
+		if (RequestQueue[Index].NotBefore > Now)
+		{
+			Index++;
+			continue;
+		}
 
-	TotalSize = ZipArchiveFileHandle->Size();
-	int64 BytesPerSplit = 52428800; // 50 Mebibyte = 52.428.800 Bytes
-	int32 PacketCount = FMath::CeilToInt((float(TotalSize)) / (float(BytesPerSplit)));
-	int64 BytesRead = 0;
-	uint8* DataBuffer;
-	int32 DataPartIndex = -1;
-	TArray<uint8> DataPartData;
-	bool WriteSuccess;
-	FString WriteMessage;
+		FHttpRequestRef Request = RequestQueue[Index].Request;
+		TSharedPtr<FModioAPI_RequestTiming> Timing = RequestQueue[Index].Timing;
+		RequestQueue.RemoveAt(Index);
+		RequestBudget -= 1.0f;
 
-	int64 NewPosition;
+		const int32 ConnectionIndex = AcquireConnection(Timing);
 
-	// All Splits except last one
-	if (PacketCount > 1)
-	{
-		for (int32 Index = 0; Index < PacketCount - 1; ++Index)
+		if (Timing.IsValid())
 		{
-			DataBuffer = (uint8*)FMemory::Malloc(BytesPerSplit);
+			Timing->SentAt = Now;
+		}
 
-			NewPosition = Index * BytesPerSplit;
-			ZipArchiveFileHandle->Seek(NewPosition);
+		// Complete the Request as failed, so Callers attached to it get the Error broadcast and it can be issued again
+		if (!Request->ProcessRequest())
+		{
+			ReleaseConnection(ConnectionIndex, nullptr, false);
 
-			if (ZipArchiveFileHandle->Read(DataBuffer, BytesPerSplit))
+			if (Timing.IsValid())
 			{
-				BytesRead = BytesRead + BytesPerSplit;
-				DataPartIndex = Index;
-				DataPartData.Empty();
-				DataPartData.Append(DataBuffer, BytesPerSplit);
-				WriteUploadPartToMultipartUploadSessionDirectory(MultipartUploadSessionID, DataPartIndex, DataPartData, WriteSuccess, WriteMessage);
+				Timing->ConnectionIndex = INDEX_NONE;
+				Timing->ProcessFailed = true;
 			}
 
-			FMemory::Free(DataBuffer);
+			Request->OnProcessRequestComplete().ExecuteIfBound(Request, nullptr, false);
 		}
 	}
 
-	// Last Split which is not the full size!
-	int64 RemainingSize = TotalSize - BytesRead;
-
-	NewPosition = (PacketCount - 1) * BytesPerSplit;
-	ZipArchiveFileHandle->Seek(NewPosition);
+	CSV_CUSTOM_STAT(ModioAPI, QueuedRequests, RequestQueue.Num(), ECsvCustomStatOp::Set);
 
-	DataBuffer = (uint8*)FMemory::Malloc(RemainingSize);
+	ProcessPrefetchQueue();
 
-	if (ZipArchiveFileHandle->Read(DataBuffer, RemainingSize))
+	if (RequestQueue.Num() == 0 && PrefetchQueue.Num() == 0 && (!Prefetcher || !Prefetcher->HasQueuedLogos()))
 	{
-		BytesRead = BytesRead + RemainingSize;
-		DataPartIndex = (PacketCount - 1);
-		DataPartData.Empty();
-		DataPartData.Append(DataBuffer, RemainingSize);
-		WriteUploadPartToMultipartUploadSessionDirectory(MultipartUploadSessionID, DataPartIndex, DataPartData, WriteSuccess, WriteMessage);
+		RequestQueueTickerHandle.Reset();
+		return false;
 	}
 
-	FMemory::Free(DataBuffer);
-
-	Success = true;
-	Message = "Successfully prepared Zip Archive for Upload Session!";
-	return;
+	return true;
 }
 
-void UModioAPIObject::WriteUploadPartToMultipartUploadSessionDirectory(FString MultipartUploadSessionID, int32 UploadPartIndex, TArray<uint8> UploadPartData, bool& Success, FString& Message)
+void UModioAPIObject::UpdateRateLimitFromResponse(FHttpResponsePtr Response)
 {
-	if (MultipartUploadSessionID.IsEmpty())
+	if (!Response.IsValid())
 	{
-		Message = "Upload Session ID is empty!";
-		Success = false;
 		return;
 	}
 
-	if (UploadPartData.IsEmpty())
+	RefillRequestBudget();
+
+	// mod.io reports its Limit per Minute
+	FString LimitHeader = Response->GetHeader("X-RateLimit-Limit");
+	if (LimitHeader.IsNumeric() && FCString::Atoi(*LimitHeader) > 0)
 	{
-		Message = "Upload Part Data empty!";
-		Success = false;
-		return;
+		RequestBudgetCapacity = FCString::Atoi(*LimitHeader);
+		RequestBudgetRefillPerSecond = RequestBudgetCapacity / 60.0f;
 	}
 
-	FString FileName = GetDirectoryPathForUploadSession(MultipartUploadSessionID) + "Upload.zip." + UModioAPIFunctionLibrary::ConvertIntToZipFilePartNumber(UploadPartIndex + 1);
-	Success = FFileHelper::SaveArrayToFile(UploadPartData, *FileName);
+	// Never assume more Budget than mod.io has left for us
+	FString RemainingHeader = Response->GetHeader("X-RateLimit-Remaining");
+	if (RemainingHeader.IsNumeric())
+	{
+		RequestBudget = FMath::Min(RequestBudget, FCString::Atof(*RemainingHeader));
+	}
 
-	if (Success)
+	FString RetryAfterHeader = Response->GetHeader("X-RateLimit-RetryAfter");
+	if (RetryAfterHeader.IsEmpty())
 	{
-		Message = "Successfully wrote Data to File!";
+		RetryAfterHeader = Response->GetHeader("Retry-After");
 	}
-	else
+
+	if (Response->GetResponseCode() == 429)
 	{
-		Message = "Error while writing Data to File!";
+		RateLimitedResponses++;
+		RequestBudget = 0.0f;
+
+		const float RetryAfter = RetryAfterHeader.IsNumeric() ? FCString::Atof(*RetryAfterHeader) : RetryBackoffBaseSeconds;
+		RateLimitedUntil = FMath::Max(RateLimitedUntil, FPlatformTime::Seconds() + RetryAfter);
 	}
-	return;
 }
 
-bool UModioAPIObject::CleanupUploadSession(FString MultipartUploadSessionID, FString& Message)
+float UModioAPIObject::GetRetryDelay(int32 Attempt, float MinimumDelay)
 {
-	FString CleanupDirectory = GetDirectoryPathForUploadSession(MultipartUploadSessionID);
+	const float Backoff = FMath::Min(RetryBackoffMaxSeconds, RetryBackoffBaseSeconds * FMath::Pow(2.0f, Attempt));
+	return FMath::Max(MinimumDelay, FMath::FRandRange(0.0f, Backoff));
+}
 
-	if (CleanupDirectory.IsEmpty())
+bool UModioAPIObject::ShouldRetryRequest(FHttpResponsePtr Response, bool bConnectedSuccessfully, const FModioAPI_DispatchedRequest& DispatchedRequest, float& RetryDelay)
+{
+	RetryDelay = 0.0f;
+
+	// Writes that aren't idempotent could be applied twice
+	if (DispatchedRequest.RequestClass == RequestClass_Write)
 	{
-		Message = "Can't find the Directory for the Upload Session in the Cache!";
 		return false;
 	}
 
-	if (!FPaths::DirectoryExists(CleanupDirectory))
+	// The HTTP Module refused the Request, sending it again won't change that
+	if (DispatchedRequest.Timing.IsValid() && DispatchedRequest.Timing->ProcessFailed)
 	{
-		Message = "The Directory that should be deleted doesn't exist!";
 		return false;
 	}
 
-	if (IFileManager::Get().DeleteDirectory(*CleanupDirectory, true, true))
+	FModioAPI_RetryPolicy RetryPolicy = GetRetryPolicy(DispatchedRequest.RequestClass);
+	const bool bConnectionFailed = !bConnectedSuccessfully || !Response.IsValid();
+	const int32 ResponseCode = bConnectionFailed ? 0 : Response->GetResponseCode();
+
+	if (bConnectionFailed)
 	{
-		Message = "Successfully cleaned up the Upload Session Cache!";
-		return true;
+		if (!RetryPolicy.RetryConnectionFailures || DispatchedRequest.Attempt >= RetryPolicy.MaxRetries)
+		{
+			return false;
+		}
+	}
+	else if (ResponseCode == 429)
+	{
+		if (DispatchedRequest.Attempt >= MaxRateLimitRetries)
+		{
+			return false;
+		}
+	}
+	else if (ResponseCode >= 500 || ResponseCode == 408)
+	{
+		if (!RetryPolicy.RetryServerErrors || DispatchedRequest.Attempt >= RetryPolicy.MaxRetries)
+		{
+			return false;
+		}
 	}
 	else
 	{
-		Message = "Error when cleaning up the Upload Session Cache!";
 		return false;
 	}
+
+	const float MinimumDelay = FMath::Max(0.0, RateLimitedUntil - FPlatformTime::Seconds());
+	RetryDelay = GetRetryDelay(DispatchedRequest.Attempt, MinimumDelay);
+
+	// Don't let Retries stack up beyond the Time the Caller is willing to wait
+	return FPlatformTime::Seconds() + RetryDelay - DispatchedRequest.FirstSentAt <= RetryPolicy.MaxTotalRetrySeconds;
 }
 
-bool UModioAPIObject::CleanupAllUploadSessions(FString& Message)
+void UModioAPIObject::DispatchedRequest_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FModioAPI_DispatchedRequest DispatchedRequest)
 {
-	FString UploadSessionsCacheDirectory = GetUploadSessionsDirectoryPath();
+	TRACE_CPUPROFILER_EVENT_SCOPE(ModioAPI_ResponseReceived);
 
-	if (IFileManager::Get().DeleteDirectory(*UploadSessionsCacheDirectory, true, true))
+	// The Connection is free for the next Request, even if this one gets retried
+	if (DispatchedRequest.Timing.IsValid())
 	{
-		Message = "Successfully cleaned up all the Upload Sessions in Cache!";
-		return true;
+		ReleaseConnection(DispatchedRequest.Timing->ConnectionIndex, Response, bConnectedSuccessfully);
 	}
 
-	Message = "Error when cleaning up all the Upload Sessions in Cache!";
-	return false;
-}
+	UpdateRateLimitFromResponse(Response);
 
-FString UModioAPIObject::GetModfilesDirectoryPathForMod(int32 ModID)
-{
-	FString ModModfilesDirectory = GetDirectoryPathForMod(ModID);
+	// Transient Failures are retried instead of broadcasting the Error
+	float RetryDelay = 0.0f;
+	if (Request.IsValid() && ShouldRetryRequest(Response, bConnectedSuccessfully, DispatchedRequest, RetryDelay))
+	{
+		FModioAPI_DispatchedRequest RetriedRequest = DispatchedRequest;
+		RetriedRequest.Attempt++;
 
-	ModModfilesDirectory.Append("Modfiles/");
+		FHttpRequestRef RetryRequest = Request.ToSharedRef();
+		RetryRequest->OnProcessRequestComplete().BindUObject(this, &UModioAPIObject::DispatchedRequest_ResponseReceived, RetriedRequest);
 
-	if (!IFileManager::Get().DirectoryExists(*ModModfilesDirectory))
-	{
-		IFileManager::Get().MakeDirectory(*ModModfilesDirectory, true);
+		if (SendOrQueueRequest(RetryRequest, FPlatformTime::Seconds() + RetryDelay, RetriedRequest.Timing))
+		{
+			RequestMetrics.Endpoints.FindOrAdd(DispatchedRequest.EndpointName).Retries++;
+			RequestMetrics.Retries++;
+			CSV_CUSTOM_STAT(ModioAPI, Retries, 1, ECsvCustomStatOp::Accumulate);
+			return;
+		}
 	}
 
-	return ModModfilesDirectory;
-}
+	// Requests issued by Listeners of this Response need to be sent again
+	InFlightRequests.Remove(DispatchedRequest.RequestKey);
 
-FString UModioAPIObject::GetUploadSessionsDirectoryPath()
-{
-	FString UploadSessionsDirectoryForGame = GetModioGameDirectory();
+	RecordResponseMetrics(Request, Response, bConnectedSuccessfully, DispatchedRequest);
 
-	UploadSessionsDirectoryForGame.Append("Uploads/");
+	// Listeners may dispatch and handle further Requests while this one is handled
+	const FString PreviousEndpointName = HandledEndpointName;
+	const double PreviousEndpointParseSeconds = HandledEndpointParseSeconds;
+	HandledEndpointName = DispatchedRequest.EndpointName;
+	HandledEndpointParseSeconds = 0.0;
 
-	if (!IFileManager::Get().DirectoryExists(*UploadSessionsDirectoryForGame))
+	const TSharedPtr<FStructOnScope> PreviousPinnedResponse = PinNotModifiedResponse(Request, DispatchedRequest.NotModifiedResponse);
+
+	const double HandlingStartedAt = FPlatformTime::Seconds();
 	{
-		IFileManager::Get().MakeDirectory(*UploadSessionsDirectoryForGame, true);
+		TRACE_CPUPROFILER_EVENT_SCOPE(ModioAPI_HandleResponse);
+		DispatchedRequest.ResponseHandler.ExecuteIfBound(Request, Response, bConnectedSuccessfully);
 	}
+	const double HandledAt = FPlatformTime::Seconds();
 
-	return UploadSessionsDirectoryForGame;
-}
-
-FString UModioAPIObject::GetModfileDirectoryPathForModfile(int32 ModID, int32 ModfileID)
-{
-	FString ModfileDirectory = GetModfilesDirectoryPathForMod(ModID);
+	UnpinNotModifiedResponse(Request, PreviousPinnedResponse);
 
-	ModfileDirectory.Append(FString::FromInt(ModfileID) + "/");
+	FModioAPI_EndpointMetrics& EndpointMetrics = RequestMetrics.Endpoints.FindOrAdd(DispatchedRequest.EndpointName);
+	AddHistogramSample(EndpointMetrics.Process, FMath::Max(0.0, HandledAt - HandlingStartedAt - HandledEndpointParseSeconds));
+	AddHistogramSample(EndpointMetrics.Total, HandledAt - DispatchedRequest.FirstSentAt);
 
-	if (!IFileManager::Get().DirectoryExists(*ModfileDirectory))
-	{
-		IFileManager::Get().MakeDirectory(*ModfileDirectory, true);
-	}
+	HandledEndpointName = PreviousEndpointName;
+	HandledEndpointParseSeconds = PreviousEndpointParseSeconds;
 
-	return ModfileDirectory;
+	RequestMetrics.ActiveRequests = FMath::Max(0, RequestMetrics.ActiveRequests - 1);
+	CSV_CUSTOM_STAT(ModioAPI, ActiveRequests, RequestMetrics.ActiveRequests, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(ModioAPI, ResponseTotalMs, static_cast<float>((HandledAt - DispatchedRequest.FirstSentAt) * 1000.0), ECsvCustomStatOp::Max);
 }
 
 /*
-Temporary Cache
+Request Metrics
 */
 
-bool UModioAPIObject::CacheGame(FModioAPI_Game Game, FString& Message)
+FModioAPI_RequestMetrics UModioAPIObject::GetRequestMetrics()
 {
-	if (!TempCache.CachedGames.Find(Game.ID))
-	{
-		Message = "Game was cached!";
-		TempCache.CachedGames.Add(Game.ID, Game);
-	}
-	else
-	{
-		Message = "Game with that ID already existed in Cache. Entry was overwritten!";
-		TempCache.CachedGames.Emplace(Game.ID, Game);
-	}
+	FModioAPI_RequestMetrics Snapshot = RequestMetrics;
+	Snapshot.QueuedRequests = RequestQueue.Num();
 
-	return true;
+	return Snapshot;
 }
 
-bool UModioAPIObject::CacheTermsOfService(FModioAPI_Terms TermsOfService, FString& Message)
+void UModioAPIObject::ResetRequestMetrics()
 {
-	TempCache.CachedTerms = TermsOfService;
+	const int32 ActiveRequests = RequestMetrics.ActiveRequests;
 
-	Message = "Terms of Service saved to Temporary Cache!";
-	return true;
+	RequestMetrics = FModioAPI_RequestMetrics();
+	RequestMetrics.ActiveRequests = ActiveRequests;
 }
 
-bool UModioAPIObject::CacheUser(FModioAPI_User User, FString& Message)
+FString UModioAPIObject::GetEndpointName(FHttpRequestPtr Request)
 {
-	if (!TempCache.CachedUsers.Find(User.ID))
+	if (!Request.IsValid())
 	{
-		Message = "User was cached!";
-		TempCache.CachedUsers.Add(User.ID, User);
+		return FString();
 	}
-	else
+
+	// Strip Query and everything up to the API Version
+	FString Path = Request->GetURL();
+	Path.Split("?", &Path, nullptr);
+
+	FString PathAfterVersion;
+	if (Path.Split(EndpointAPIPath + EndpointAPIVersion, nullptr, &PathAfterVersion))
 	{
-		Message = "User with that ID already existed in Cache. Entry was overwritten!";
-		TempCache.CachedUsers.Emplace(User.ID, User);
+		Path = PathAfterVersion;
 	}
 
-	return true;
-}
+	// Replace IDs, so all Requests to the same Endpoint share their Metrics
+	TArray<FString> Segments;
+	Path.ParseIntoArray(Segments, TEXT("/"));
 
-bool UModioAPIObject::CacheUserEvent(FModioAPI_UserEvent UserEvent, FString& Message)
-{
-	if (!TempCache.CachedEvents.Find(UserEvent.ID))
+	FString EndpointName = Request->GetVerb() + " ";
+	for (const FString& Segment : Segments)
 	{
-		Message = "User Event was cached!";
-		TempCache.CachedEvents.Add(UserEvent.ID, UserEvent);
+		EndpointName.Append("/");
+		EndpointName.Append(Segment.IsNumeric() ? FString("{id}") : Segment);
 	}
-	else
+
+	return EndpointName;
+}
+
+TSharedPtr<FJsonObject> UModioAPIObject::ParseResponseToJsonObject(FHttpResponsePtr Response)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ModioAPI_ParseResponse);
+
+	const double ParsingStartedAt = FPlatformTime::Seconds();
+	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	const double ParseSeconds = FPlatformTime::Seconds() - ParsingStartedAt;
+
+	if (!HandledEndpointName.IsEmpty())
 	{
-		Message = "User Event with that ID already existed in Cache. Entry was overwritten!";
-		TempCache.CachedEvents.Emplace(UserEvent.ID, UserEvent);
+		HandledEndpointParseSeconds += ParseSeconds;
+		AddHistogramSample(RequestMetrics.Endpoints.FindOrAdd(HandledEndpointName).Parse, ParseSeconds);
 	}
 
-	return true;
+	return ResponseObj;
 }
 
-bool UModioAPIObject::CacheModfile(FModioAPI_Modfile Modfile, FString& Message)
+void UModioAPIObject::AddHistogramSample(FModioAPI_LatencyHistogram& Histogram, double Seconds)
 {
-	if (!TempCache.CachedModfiles.Find(Modfile.ID))
+	static const TArray<float> BucketUpperBoundsMs = {1.0f, 2.0f, 5.0f, 10.0f, 25.0f, 50.0f, 100.0f, 250.0f, 500.0f, 1000.0f, 2500.0f, 5000.0f, 10000.0f};
+
+	if (Histogram.BucketCounts.Num() != BucketUpperBoundsMs.Num() + 1)
 	{
-		Message = "Modfile was cached!";
-		TempCache.CachedModfiles.Add(Modfile.ID, Modfile);
+		Histogram.BucketUpperBoundsMs = BucketUpperBoundsMs;
+		Histogram.BucketCounts.Init(0, BucketUpperBoundsMs.Num() + 1);
 	}
-	else
+
+	const float Milliseconds = FMath::Max(0.0, Seconds * 1000.0);
+
+	int32 Bucket = 0;
+	while (Bucket < BucketUpperBoundsMs.Num() && Milliseconds > BucketUpperBoundsMs[Bucket])
 	{
-		Message = "Modfile with that ID already existed in Cache. Entry was overwritten!";
-		TempCache.CachedModfiles.Emplace(Modfile.ID, Modfile);
+		Bucket++;
 	}
 
-	return true;
+	Histogram.BucketCounts[Bucket]++;
+	Histogram.Samples++;
+	Histogram.TotalMs += Milliseconds;
+	Histogram.MaxMs = FMath::Max(Histogram.MaxMs, Milliseconds);
 }
 
-bool UModioAPIObject::UncacheModfile(int32 ModfileID, FString& Message)
+void UModioAPIObject::RecordResponseMetrics(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, const FModioAPI_DispatchedRequest& DispatchedRequest)
 {
-	if (TempCache.CachedModfiles.Find(ModfileID))
+	FModioAPI_EndpointMetrics& EndpointMetrics = RequestMetrics.Endpoints.FindOrAdd(DispatchedRequest.EndpointName);
+	const double ReceivedAt = FPlatformTime::Seconds();
+
+	if (!bConnectedSuccessfully || !Response.IsValid())
 	{
-		Message = "Modfile was uncached!";
-		TempCache.CachedModfiles.Remove(ModfileID);
-		return true;
+		EndpointMetrics.Failures++;
 	}
 	else
 	{
-		Message = "Modfile with that ID didn't exist in Cache!";
-		return false;
+		const int32 ResponseCode = Response->GetResponseCode();
+		if (ResponseCode == 304)
+		{
+			EndpointMetrics.NotModifiedResponses++;
+		}
+		else if (ResponseCode >= 400)
+		{
+			EndpointMetrics.Failures++;
+		}
+
+		const int64 BytesReceived = Response->GetContent().Num();
+		EndpointMetrics.BytesReceived += BytesReceived;
+		RequestMetrics.BytesReceived += BytesReceived;
+		CSV_CUSTOM_STAT(ModioAPI, BytesReceived, static_cast<float>(BytesReceived), ECsvCustomStatOp::Accumulate);
 	}
-}
 
-bool UModioAPIObject::CacheSubscribedMod(FModioAPI_Mod SubscribedMod, FString& Message)
-{
-	if (!TempCache.CachedSubscribedMods.Find(SubscribedMod.ID))
+	const TSharedPtr<FModioAPI_RequestTiming>& Timing = DispatchedRequest.Timing;
+	if (!Timing.IsValid() || Timing->SentAt <= 0.0)
 	{
-		Message = "Subscribed Mod was cached!";
-		TempCache.CachedSubscribedMods.Add(SubscribedMod.ID, SubscribedMod);
+		return;
 	}
-	else
+
+	AddHistogramSample(EndpointMetrics.QueueWait, Timing->SentAt - Timing->QueuedAt);
+
+	if (Timing->FirstByteAt > 0.0)
 	{
-		Message = "Subscribed Mod with that ID already existed in Cache. Entry was overwritten!";
-		TempCache.CachedSubscribedMods.Emplace(SubscribedMod.ID, SubscribedMod);
+		AddHistogramSample(EndpointMetrics.TimeToFirstByte, Timing->FirstByteAt - Timing->SentAt);
+		AddHistogramSample(EndpointMetrics.Transfer, ReceivedAt - Timing->FirstByteAt);
+		AddHistogramSample(Timing->EstimatedReuse ? ConnectionPoolStats.TimeToFirstByteEstimatedReused : ConnectionPoolStats.TimeToFirstByteEstimatedNew, Timing->FirstByteAt - Timing->SentAt);
 	}
-
-	return true;
 }
 
-bool UModioAPIObject::CacheUnsubscriptionFromMod(int32 UnsubscribedModID, FString& Message)
+/*
+Connections
+*/
+
+void UModioAPIObject::SetConnectionPolicy(FModioAPI_ConnectionPolicy Policy)
 {
-	if (TempCache.CachedSubscribedMods.Find(UnsubscribedModID))
+	Policy.MaxConnections = FMath::Max(0, Policy.MaxConnections);
+	Policy.WarmUpConnections = FMath::Max(0, Policy.WarmUpConnections);
+	if (Policy.MaxConnections > 0)
 	{
-		Message = "Unsubscription from Mod was cached!";
-		TempCache.CachedSubscribedMods.Remove(UnsubscribedModID);
-		return true;
+		Policy.WarmUpConnections = FMath::Min(Policy.WarmUpConnections, Policy.MaxConnections);
 	}
+	Policy.KeepAliveSeconds = FMath::Max(0.0f, Policy.KeepAliveSeconds);
 
-	Message = "Unsubscription from Mod couldn't be cached! Mod wasn't in Subscribed Mods Cache!";
-	return false;
+	ConnectionPolicy = Policy;
+	ApplyConnectionPolicy();
 }
 
-bool UModioAPIObject::CacheMod(FModioAPI_Mod Mod, FString& Message)
+FModioAPI_ConnectionPolicy UModioAPIObject::GetConnectionPolicy()
 {
-	if (!TempCache.CachedMods.Find(Mod.ID))
-	{
-		Message = "Mod was cached!";
-		TempCache.CachedMods.Add(Mod.ID, Mod);
-	}
-	else
+	return ConnectionPolicy;
+}
+
+FModioAPI_ConnectionPoolStats UModioAPIObject::GetConnectionPoolStats()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	FModioAPI_ConnectionPoolStats Stats = ConnectionPoolStats;
+	for (const FModioAPI_ApiConnection& Connection : ApiConnections)
 	{
-		Message = "Mod with that ID already existed in Cache. Entry was overwritten!";
-		TempCache.CachedMods.Emplace(Mod.ID, Mod);
+		FModioAPI_ConnectionStats ConnectionStats = Connection.Stats;
+		ConnectionStats.Busy = Connection.Busy;
+		ConnectionStats.EstimatedOpen = Connection.Busy || (Connection.LastUsedAt > 0.0 && Now - Connection.LastUsedAt < ConnectionPolicy.KeepAliveSeconds);
+		Stats.EstimatedConnections.Add(ConnectionStats);
 	}
 
-	return true;
+	const int32 NumOfRequests = Stats.EstimatedReuses + Stats.EstimatedNewConnections;
+	Stats.EstimatedReuseRatio = NumOfRequests > 0 ? static_cast<float>(Stats.EstimatedReuses) / NumOfRequests : 0.0f;
+
+	return Stats;
 }
 
-bool UModioAPIObject::UncacheMod(int32 ModID, FString& Message)
+void UModioAPIObject::ResetConnectionPoolStats()
 {
-	if (TempCache.CachedMods.Find(ModID))
-	{
-		Message = "Mod was uncached!";
-		TempCache.CachedMods.Remove(ModID);
-		return true;
-	}
-	else
+	ConnectionPoolStats = FModioAPI_ConnectionPoolStats();
+
+	for (FModioAPI_ApiConnection& Connection : ApiConnections)
 	{
-		Message = "Mod with that ID didn't exist in Cache!";
-		return false;
+		Connection.Stats = FModioAPI_ConnectionStats();
 	}
 }
 
-bool UModioAPIObject::CachePurchasedMod(FModioAPI_Mod PurchasedMod, FString& Message)
+int32 UModioAPIObject::WarmUpConnections(int32 NumOfConnections)
 {
-	if (!TempCache.CachedPurchasedMods.Find(PurchasedMod.ID))
+	// Connections closed after every Request can't be warmed up
+	if (!IsInitialized() || !ConnectionPolicy.KeepAlive)
 	{
-		Message = "Purchased Mod was cached!";
-		TempCache.CachedPurchasedMods.Add(PurchasedMod.ID, PurchasedMod);
+		return 0;
 	}
-	else
+
+	const double Now = FPlatformTime::Seconds();
+	if (ConnectionPolicy.MaxConnections > 0)
 	{
-		Message = "Purchased Mod with that ID already existed in Cache. Entry was overwritten!";
-		TempCache.CachedPurchasedMods.Emplace(PurchasedMod.ID, PurchasedMod);
+		NumOfConnections = FMath::Min(NumOfConnections, ConnectionPolicy.MaxConnections);
 	}
 
-	return true;
-}
-
-bool UModioAPIObject::CacheMutedUser(FModioAPI_User User, FString& Message)
-{
-	if (!TempCache.CachedMutedUsers.Find(User.ID))
+	for (int32 Index = 0; Index < GetNumOfConnectionSlots(); Index++)
 	{
-		Message = "Muted User was cached!";
-		TempCache.CachedMutedUsers.Add(User.ID, User);
+		const FModioAPI_ApiConnection& Connection = ApiConnections[Index];
+		if (Connection.Busy || (Connection.LastUsedAt > 0.0 && Now - Connection.LastUsedAt < ConnectionPolicy.KeepAliveSeconds))
+		{
+			NumOfConnections--;
+		}
 	}
-	else
+
+	int32 NumOfWarmUps = 0;
+
+	// Queued Requests come first, they open the Connections anyway. Warm-Ups aren't API Calls, so they leave the Rate Limit Budget alone
+	while (NumOfWarmUps < NumOfConnections && RequestQueue.Num() == 0 && RateLimitedUntil <= Now)
 	{
-		Message = "Muted User with that ID already existed in Cache. Entry was overwritten!";
-		TempCache.CachedMutedUsers.Emplace(User.ID, User);
-	}
+		const int32 ConnectionIndex = AcquireConnection(nullptr, true);
+		if (ConnectionIndex == INDEX_NONE)
+		{
+			break;
+		}
 
-	FString Temp;
-	CacheUser(User, Temp);
+		// The Response doesn't matter, only the Connection that is left open
+		FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
+		Request->SetURL(GetApiPath());
+		Request->SetVerb("HEAD");
+		Request->OnProcessRequestComplete().BindWeakLambda(this, [this, ConnectionIndex](FHttpRequestPtr WarmUpRequest, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			ReleaseConnection(ConnectionIndex, Response, bConnectedSuccessfully);
+		});
 
-	return true;
+		if (!Request->ProcessRequest())
+		{
+			ReleaseConnection(ConnectionIndex, nullptr, false);
+			break;
+		}
+
+		ConnectionPoolStats.WarmUps++;
+		NumOfWarmUps++;
+	}
+
+	return NumOfWarmUps;
 }
 
-bool UModioAPIObject::CacheRating(FModioAPI_Rating Rating, FString& Message)
+void UModioAPIObject::ApplyConnectionPolicy()
 {
-	if (Rating.Game_ID != ModioGameID)
+	if (ApiConnections.Num() < ConnectionPolicy.MaxConnections)
 	{
-		Message = "Only Ratings for the Game-ID of the Connection are supported right now!";
-		return false;
+		ApiConnections.SetNum(ConnectionPolicy.MaxConnections);
 	}
 
-	if (!TempCache.CachedModRatings.Find(Rating.Mod_ID))
-	{
-		Message = "Rating was cached!";
-		TempCache.CachedModRatings.Add(Rating.Mod_ID, Rating);
-	}
-	else
+	// Connections above a lowered Cap are dropped once they are idle
+	while (ConnectionPolicy.MaxConnections > 0 && ApiConnections.Num() > ConnectionPolicy.MaxConnections && !ApiConnections.Last().Busy)
 	{
-		Message = "Rating with that Mod-ID already existed in Cache. Entry was overwritten!";
-		TempCache.CachedModRatings.Emplace(Rating.Mod_ID, Rating);
+		ApiConnections.Pop();
 	}
-
-	return true;
 }
 
-bool UModioAPIObject::CacheWallet(FModioAPI_Wallet Wallet, FString& Message)
+int32 UModioAPIObject::GetNumOfConnectionSlots()
 {
-	Message = "Wallet was cached!";
-	TempCache.CachedWallet = Wallet;
-	return true;
+	return ConnectionPolicy.MaxConnections > 0 ? FMath::Min(ApiConnections.Num(), ConnectionPolicy.MaxConnections) : ApiConnections.Num();
 }
 
-bool UModioAPIObject::CacheGameTagOptions(FModioAPI_GetGameTagOptions GameTagOptions, FString& Message)
+bool UModioAPIObject::HasIdleConnection()
 {
-	if (TempCache.CachedGames.Find(ModioGameID))
+	// Without a Cap another Slot is added whenever all of them are busy
+	if (ConnectionPolicy.MaxConnections <= 0)
 	{
-		TempCache.CachedGames.Find(ModioGameID)->Tag_Options = GameTagOptions.Data;
-		Message = "Game Tag Options were cached!";
 		return true;
 	}
-	else
+
+	for (int32 Index = 0; Index < ConnectionPolicy.MaxConnections; Index++)
 	{
-		Message = "Game wasn't cached before!";
+		if (!ApiConnections.IsValidIndex(Index) || !ApiConnections[Index].Busy)
+		{
+			return true;
+		}
 	}
 
 	return false;
 }
 
-bool UModioAPIObject::GetCachedModfilesForMod(int32 ModID, TArray<int32>& Modfiles, FString& Message)
+int32 UModioAPIObject::AcquireConnection(TSharedPtr<FModioAPI_RequestTiming> Timing, bool bOnlyClosed)
 {
-	if (ModID < 1)
+	if (ApiConnections.Num() < ConnectionPolicy.MaxConnections)
 	{
-		return false;
+		ApiConnections.SetNum(ConnectionPolicy.MaxConnections);
 	}
 
-	TArray<FModioAPI_Modfile> CachedModfiles;
-	GetCached_Modfiles(FModioAPI_RequestFilters(), FModioAPI_RequestSorting(), FModioAPI_RequestPagination(), CachedModfiles);
-
-	TArray<int32> CachedModfilesForMod;
-	CachedModfilesForMod.Empty();
+	const double Now = FPlatformTime::Seconds();
+	int32 OpenIndex = INDEX_NONE;
+	int32 ClosedIndex = INDEX_NONE;
 
-	for (FModioAPI_Modfile Modfile : CachedModfiles)
+	for (int32 Index = 0; Index < GetNumOfConnectionSlots(); Index++)
 	{
-		if (Modfile.Mod_ID == ModID)
+		const FModioAPI_ApiConnection& Connection = ApiConnections[Index];
+		if (Connection.Busy)
 		{
-			CachedModfilesForMod.Add(Modfile.ID);
+			continue;
+		}
+
+		// The most recently used Connection is the least likely to be closed by mod.io in the meantime
+		if (Connection.LastUsedAt > 0.0 && Now - Connection.LastUsedAt < ConnectionPolicy.KeepAliveSeconds)
+		{
+			if (OpenIndex == INDEX_NONE || Connection.LastUsedAt > ApiConnections[OpenIndex].LastUsedAt)
+			{
+				OpenIndex = Index;
+			}
+		}
+		else if (ClosedIndex == INDEX_NONE)
+		{
+			ClosedIndex = Index;
 		}
 	}
 
-	Modfiles = CachedModfilesForMod;
-	return true;
-}
+	if (ClosedIndex == INDEX_NONE && ConnectionPolicy.MaxConnections <= 0)
+	{
+		ClosedIndex = ApiConnections.AddDefaulted();
+	}
+
+	const bool bReused = !bOnlyClosed && OpenIndex != INDEX_NONE;
+	const int32 ConnectionIndex = bReused ? OpenIndex : ClosedIndex;
+	if (ConnectionIndex == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	FModioAPI_ApiConnection& Connection = ApiConnections[ConnectionIndex];
+	Connection.Busy = true;
+	Connection.Stats.Requests++;
+	ConnectionPoolStats.Requests++;
+
+	if (bReused)
+	{
+		Connection.Stats.EstimatedReuses++;
+		ConnectionPoolStats.EstimatedReuses++;
+	}
+	else
+	{
+		Connection.Stats.EstimatedOpened++;
+		ConnectionPoolStats.EstimatedNewConnections++;
+	}
+
+	if (Timing.IsValid())
+	{
+		Timing->ConnectionIndex = ConnectionIndex;
+		Timing->EstimatedReuse = bReused;
+	}
+
+	return ConnectionIndex;
+}
+
+void UModioAPIObject::ReleaseConnection(int32 ConnectionIndex, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+{
+	if (!ApiConnections.IsValidIndex(ConnectionIndex))
+	{
+		return;
+	}
+
+	FModioAPI_ApiConnection& Connection = ApiConnections[ConnectionIndex];
+	Connection.Busy = false;
+
+	// A failed Connection or one mod.io announced to close has to be established again
+	const bool bClosedByServer = !bConnectedSuccessfully || !Response.IsValid() || Response->GetHeader("Connection").Equals("close", ESearchCase::IgnoreCase);
+
+	if (!ConnectionPolicy.KeepAlive)
+	{
+		Connection.LastUsedAt = 0.0;
+	}
+	else if (bClosedByServer)
+	{
+		Connection.LastUsedAt = 0.0;
+		ConnectionPoolStats.ClosedConnections++;
+	}
+	else
+	{
+		Connection.LastUsedAt = FPlatformTime::Seconds();
+	}
+
+	while (ConnectionPolicy.MaxConnections > 0 && ApiConnections.Num() > ConnectionPolicy.MaxConnections && !ApiConnections.Last().Busy)
+	{
+		ApiConnections.Pop();
+	}
+}
+
+/*
+Prefetching
+*/
+
+void UModioAPIObject::ConfigurePrefetching(int32 MaxConcurrent, float BudgetReserve, float LifetimeSeconds)
+{
+	MaxConcurrentPrefetches = FMath::Max(0, MaxConcurrent);
+	PrefetchBudgetReserve = FMath::Clamp(BudgetReserve, 0.0f, 1.0f);
+	PrefetchLifetimeSeconds = FMath::Max(0.0f, LifetimeSeconds);
+}
+
+UModioAPIPrefetchObject* UModioAPIObject::GetPrefetcher()
+{
+	if (!Prefetcher)
+	{
+		Prefetcher = NewObject<UModioAPIPrefetchObject>(this);
+		Prefetcher->ModioConnection = this;
+	}
+
+	return Prefetcher;
+}
+
+FModioAPI_PrefetchStats UModioAPIObject::GetPrefetchStats()
+{
+	ExpirePrefetches();
+
+	FModioAPI_PrefetchStats Stats = PrefetchStats;
+	// Several Callers may attach to the same Prefetch
+	Stats.HitRate = Stats.Sent > 0 ? FMath::Min(1.0f, static_cast<float>(Stats.Hits + Stats.LateHits) / Stats.Sent) : 0.0f;
+
+	return Stats;
+}
+
+void UModioAPIObject::ResetPrefetchStats()
+{
+	PrefetchStats = FModioAPI_PrefetchStats();
+}
+
+void UModioAPIObject::BeginPrefetch(const FString& Tag)
+{
+	DispatchingPrefetchTag = Tag.IsEmpty() ? "Prefetch" : Tag;
+}
+
+void UModioAPIObject::EndPrefetch()
+{
+	DispatchingPrefetchTag.Empty();
+}
+
+int32 UModioAPIObject::CancelPrefetches(const FString& Tag)
+{
+	TArray<FHttpRequestPtr> RequestsToCancel;
+	int32 NumOfCancelled = 0;
+
+	for (auto It = Prefetches.CreateIterator(); It; ++It)
+	{
+		FModioAPI_PrefetchedRequest& Prefetch = It.Value();
+
+		// Callers waiting for the Response keep the Prefetch relevant
+		if ((!Tag.IsEmpty() && Prefetch.Tag != Tag) || Prefetch.WaitingRequest.IsValid())
+		{
+			continue;
+		}
+
+		if (!Prefetch.Sent)
+		{
+			PrefetchQueue.Remove(It.Key());
+		}
+		else if (!Prefetch.Response.IsValid())
+		{
+			RequestsToCancel.Add(Prefetch.Request);
+		}
+
+		It.RemoveCurrent();
+		NumOfCancelled++;
+	}
+
+	// Cancelling may complete the Requests right away, which must not happen while iterating
+	for (FHttpRequestPtr Request : RequestsToCancel)
+	{
+		Request->CancelRequest();
+	}
+
+	PrefetchStats.Cancelled += NumOfCancelled;
+	return NumOfCancelled;
+}
+
+bool UModioAPIObject::DispatchPrefetch(FHttpRequestRef Request)
+{
+	ExpirePrefetches();
+
+	TSharedPtr<FStructOnScope> NotModifiedResponse = AddResponseCacheValidators(Request);
+
+	const FString RequestKey = GetInFlightRequestKey(Request);
+
+	// A Caller sent the Request already
+	if (InFlightRequests.Contains(RequestKey))
+	{
+		return true;
+	}
+
+	// Prefetched before, it is relevant for the new Tag now
+	if (FModioAPI_PrefetchedRequest* ExistingPrefetch = Prefetches.Find(RequestKey))
+	{
+		ExistingPrefetch->Tag = DispatchingPrefetchTag;
+		return true;
+	}
+
+	FModioAPI_PrefetchedRequest& Prefetch = Prefetches.Add(RequestKey);
+	Prefetch.Request = Request;
+	Prefetch.NotModifiedResponse = NotModifiedResponse;
+	Prefetch.Tag = DispatchingPrefetchTag;
+	Prefetch.Timing = MakeShared<FModioAPI_RequestTiming>();
+	Prefetch.Timing->QueuedAt = FPlatformTime::Seconds();
+
+	Request->OnProcessRequestComplete().BindUObject(this, &UModioAPIObject::Prefetch_ResponseReceived, RequestKey, Prefetch.Timing);
+
+	PrefetchQueue.Add(RequestKey);
+	PrefetchStats.Issued++;
+
+	if (!RequestQueueTickerHandle.IsValid())
+	{
+		RequestQueueTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UModioAPIObject::ProcessRequestQueue));
+	}
+
+	return true;
+}
+
+bool UModioAPIObject::ServeFromPrefetch(FHttpRequestRef Request, const FString& RequestKey)
+{
+	ExpirePrefetches();
+
+	FModioAPI_PrefetchedRequest* Prefetch = Prefetches.Find(RequestKey);
+	if (!Prefetch)
+	{
+		return false;
+	}
+
+	// Not sent yet, the Request of the Caller replaces it at regular Priority
+	if (!Prefetch->Sent)
+	{
+		PrefetchQueue.Remove(RequestKey);
+		Prefetches.Remove(RequestKey);
+		PrefetchStats.Cancelled++;
+		return false;
+	}
+
+	if (!Prefetch->Response.IsValid())
+	{
+		// Like In-Flight Requests, the Response is broadcast once no Matter how many Callers wait for it
+		if (!Prefetch->WaitingRequest.IsValid())
+		{
+			Prefetch->WaitingRequest = Request;
+		}
+
+		PrefetchStats.LateHits++;
+		return true;
+	}
+
+	FHttpResponsePtr Response = Prefetch->Response;
+	TSharedPtr<FStructOnScope> NotModifiedResponse = Prefetch->NotModifiedResponse;
+	Prefetches.Remove(RequestKey);
+	PrefetchStats.Hits++;
+
+	// Handled on the next Tick like a Response from mod.io, so the Caller can still bind to the Events
+	TWeakObjectPtr<UModioAPIObject> WeakThis(this);
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThis, Request, Response, NotModifiedResponse](float DeltaTime)
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->HandlePrefetchedResponse(Request, Response, NotModifiedResponse);
+		}
+		return false;
+	}));
+
+	return true;
+}
+
+bool UModioAPIObject::CanSendPrefetch()
+{
+	const float ReservedBudget = PrefetchBudgetReserve * RequestBudgetCapacity;
+
+	// Regular Requests always come first
+	return RequestQueue.Num() == 0 && PrefetchesInFlight < MaxConcurrentPrefetches && RateLimitedUntil <= FPlatformTime::Seconds() && RequestBudget >= 1.0f + ReservedBudget && HasIdleConnection();
+}
+
+bool UModioAPIObject::AcquirePrefetchSlot()
+{
+	RefillRequestBudget();
+
+	// Downloads of the Prefetcher queue behind the prefetched Requests
+	if (PrefetchQueue.Num() > 0 || !CanSendPrefetch())
+	{
+		return false;
+	}
+
+	PrefetchesInFlight++;
+	return true;
+}
+
+void UModioAPIObject::ReleasePrefetchSlot()
+{
+	PrefetchesInFlight = FMath::Max(0, PrefetchesInFlight - 1);
+}
+
+void UModioAPIObject::SchedulePrefetchQueue()
+{
+	if (!RequestQueueTickerHandle.IsValid())
+	{
+		RequestQueueTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UModioAPIObject::ProcessRequestQueue));
+	}
+}
+
+void UModioAPIObject::ProcessPrefetchQueue()
+{
+	RefillRequestBudget();
+
+	const double Now = FPlatformTime::Seconds();
+
+	while (PrefetchQueue.Num() > 0 && CanSendPrefetch())
+	{
+		const FString RequestKey = PrefetchQueue[0];
+		PrefetchQueue.RemoveAt(0);
+
+		FModioAPI_PrefetchedRequest* Prefetch = Prefetches.Find(RequestKey);
+		if (!Prefetch)
+		{
+			continue;
+		}
+
+		RequestBudget -= 1.0f;
+
+		const int32 ConnectionIndex = AcquireConnection(Prefetch->Timing);
+		Prefetch->Timing->SentAt = Now;
+		Prefetch->Sent = true;
+
+		if (!Prefetch->Request->ProcessRequest())
+		{
+			ReleaseConnection(ConnectionIndex, nullptr, false);
+			Prefetches.Remove(RequestKey);
+			PrefetchStats.Failed++;
+			continue;
+		}
+
+		PrefetchesInFlight++;
+		PrefetchStats.Sent++;
+	}
+
+	if (PrefetchQueue.Num() == 0 && Prefetcher)
+	{
+		Prefetcher->ProcessLogoQueue();
+	}
+}
+
+void UModioAPIObject::Prefetch_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString RequestKey, TSharedPtr<FModioAPI_RequestTiming> Timing)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ModioAPI_PrefetchReceived);
+
+	PrefetchesInFlight = FMath::Max(0, PrefetchesInFlight - 1);
+	ReleaseConnection(Timing->ConnectionIndex, Response, bConnectedSuccessfully);
+	UpdateRateLimitFromResponse(Response);
+
+	// Cancelled, or replaced by a later Prefetch of the same Request
+	FModioAPI_PrefetchedRequest* Prefetch = Prefetches.Find(RequestKey);
+	if (!Prefetch || Prefetch->Request != Request)
+	{
+		return;
+	}
+
+	FHttpRequestPtr WaitingRequest = Prefetch->WaitingRequest;
+
+	const int32 ResponseCode = bConnectedSuccessfully && Response.IsValid() ? Response->GetResponseCode() : 0;
+	if (ResponseCode != 200 && ResponseCode != 304)
+	{
+		// Waiting Callers get the Request sent at regular Priority, with Retries
+		Prefetches.Remove(RequestKey);
+		PrefetchStats.Failed++;
+
+		if (WaitingRequest.IsValid())
+		{
+			DispatchRequest(WaitingRequest.ToSharedRef());
+		}
+
+		return;
+	}
+
+	PrefetchStats.Completed++;
+
+	if (WaitingRequest.IsValid())
+	{
+		TSharedPtr<FStructOnScope> NotModifiedResponse = Prefetch->NotModifiedResponse;
+		Prefetches.Remove(RequestKey);
+		HandlePrefetchedResponse(WaitingRequest.ToSharedRef(), Response, NotModifiedResponse);
+
+		return;
+	}
+
+	Prefetch->Response = Response;
+	Prefetch->ReceivedAt = FPlatformTime::Seconds();
+}
+
+void UModioAPIObject::HandlePrefetchedResponse(FHttpRequestRef Request, FHttpResponsePtr Response, TSharedPtr<FStructOnScope> NotModifiedResponse)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ModioAPI_HandleResponse);
+
+	// Listeners may dispatch and handle further Requests while this one is handled
+	const FString PreviousEndpointName = HandledEndpointName;
+	const double PreviousEndpointParseSeconds = HandledEndpointParseSeconds;
+	HandledEndpointName = GetEndpointName(Request);
+	HandledEndpointParseSeconds = 0.0;
+
+	const TSharedPtr<FStructOnScope> PreviousPinnedResponse = PinNotModifiedResponse(Request, NotModifiedResponse);
+	Request->OnProcessRequestComplete().ExecuteIfBound(Request, Response, true);
+	UnpinNotModifiedResponse(Request, PreviousPinnedResponse);
+
+	HandledEndpointName = PreviousEndpointName;
+	HandledEndpointParseSeconds = PreviousEndpointParseSeconds;
+}
+
+void UModioAPIObject::ExpirePrefetches()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	for (auto It = Prefetches.CreateIterator(); It; ++It)
+	{
+		if (It.Value().ReceivedAt > 0.0 && Now - It.Value().ReceivedAt > PrefetchLifetimeSeconds)
+		{
+			It.RemoveCurrent();
+			PrefetchStats.Expired++;
+		}
+	}
+}
+
+/*
+Response Cache
+*/
+
+FString UModioAPIObject::GetResponseCacheFilePath()
+{
+	FString ResponseCacheFilePath = GetModioGameDirectory();
+
+	ResponseCacheFilePath.Append("ResponseCache.json");
+
+	return ResponseCacheFilePath;
+}
+
+TSharedPtr<FStructOnScope> UModioAPIObject::FindNotModifiedResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, UScriptStruct* ExpectedStruct)
+{
+	if (!Request.IsValid() || !Response.IsValid() || Response->GetResponseCode() != 304)
+	{
+		return nullptr;
+	}
+
+	// Evicted or cleared while the Request was in flight, the Response the Validators were sent for is still pinned then
+	TSharedPtr<FStructOnScope>* DecodedResponse = DecodedResponses.Find(Request->GetURL());
+	if (!DecodedResponse || !DecodedResponse->IsValid())
+	{
+		DecodedResponse = PinnedResponses.Find(Request->GetURL());
+	}
+
+	if (!DecodedResponse || !DecodedResponse->IsValid() || (*DecodedResponse)->GetStruct() != ExpectedStruct)
+	{
+		return nullptr;
+	}
+
+	if (FModioAPI_ResponseCacheEntry* Entry = ResponseCache.Entries.Find(Request->GetURL()))
+	{
+		Entry->LastUsed = FDateTime::UtcNow();
+	}
+
+	return *DecodedResponse;
+}
+
+void UModioAPIObject::StoreScopedResponseInCache(FHttpRequestPtr Request, FHttpResponsePtr Response, TSharedPtr<FStructOnScope> ScopedResponse)
+{
+	if (!Request.IsValid() || !Response.IsValid() || !ScopedResponse.IsValid())
+	{
+		return;
+	}
+
+	FModioAPI_ResponseCacheEntry Entry;
+	Entry.ETag = Response->GetHeader("ETag");
+	Entry.LastModified = Response->GetHeader("Last-Modified");
+
+	// Nothing to validate the Response against later
+	if (Entry.ETag.IsEmpty() && Entry.LastModified.IsEmpty())
+	{
+		return;
+	}
+
+	const UScriptStruct* ResponseStruct = CastChecked<UScriptStruct>(ScopedResponse->GetStruct());
+	Entry.StructPath = ResponseStruct->GetPathName();
+	if (!FJsonObjectConverter::UStructToJsonObjectString(ResponseStruct, ScopedResponse->GetStructMemory(), Entry.DecodedResponse, 0, 0, 0, nullptr, false))
+	{
+		return;
+	}
+
+	Entry.LastUsed = FDateTime::UtcNow();
+
+	ResponseCache.Entries.Add(Request->GetURL(), Entry);
+	DecodedResponses.Add(Request->GetURL(), ScopedResponse);
+
+	EvictResponseCacheEntries();
+	MarkResponseCacheDirty();
+}
+
+TSharedPtr<FStructOnScope> UModioAPIObject::AddResponseCacheValidators(FHttpRequestRef Request)
+{
+	// Only Responses still available decoded can be served on '304 Not Modified'
+	TSharedPtr<FStructOnScope>* DecodedResponse = DecodedResponses.Find(Request->GetURL());
+	if (!DecodedResponse || !DecodedResponse->IsValid())
+	{
+		return nullptr;
+	}
+
+	FModioAPI_ResponseCacheEntry* Entry = ResponseCache.Entries.Find(Request->GetURL());
+	if (!Entry)
+	{
+		return nullptr;
+	}
+
+	if (!Entry->ETag.IsEmpty())
+	{
+		Request->SetHeader("If-None-Match", Entry->ETag);
+	}
+
+	if (!Entry->LastModified.IsEmpty())
+	{
+		Request->SetHeader("If-Modified-Since", Entry->LastModified);
+	}
+
+	return *DecodedResponse;
+}
+
+TSharedPtr<FStructOnScope> UModioAPIObject::PinNotModifiedResponse(FHttpRequestPtr Request, TSharedPtr<FStructOnScope> NotModifiedResponse)
+{
+	if (!Request.IsValid())
+	{
+		return nullptr;
+	}
+
+	// Listeners may handle a Response for the same URL while this one is handled
+	TSharedPtr<FStructOnScope> PreviousPinnedResponse = PinnedResponses.FindRef(Request->GetURL());
+
+	if (NotModifiedResponse.IsValid())
+	{
+		PinnedResponses.Add(Request->GetURL(), NotModifiedResponse);
+	}
+
+	return PreviousPinnedResponse;
+}
+
+void UModioAPIObject::UnpinNotModifiedResponse(FHttpRequestPtr Request, TSharedPtr<FStructOnScope> PreviousPinnedResponse)
+{
+	if (!Request.IsValid())
+	{
+		return;
+	}
+
+	if (PreviousPinnedResponse.IsValid())
+	{
+		PinnedResponses.Add(Request->GetURL(), PreviousPinnedResponse);
+	}
+	else
+	{
+		PinnedResponses.Remove(Request->GetURL());
+	}
+}
+
+bool UModioAPIObject::SaveResponseCacheToFile(FString& Message)
+{
+	if (!IsInitialized())
+	{
+		Message = "Mod.io not yet initialized!";
+		return false;
+	}
+
+	// Convert Response Cache Struct to JSON String
+	FString JsonString;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(ResponseCache, JsonString, 0, 0, 0, nullptr, false))
+	{
+		Message = "Error converting Response Cache to JSON String!";
+		return false;
+	}
+
+	// Write String to File
+	if (!FFileHelper::SaveStringToFile(JsonString, *GetResponseCacheFilePath()))
+	{
+		Message = "Error writing Response Cache File!";
+		return false;
+	}
+
+	Message = "Response Cache saved successfully to File!";
+	return true;
+}
+
+bool UModioAPIObject::LoadResponseCacheFromFile(FString& Message)
+{
+	if (!IsInitialized())
+	{
+		Message = "Mod.io not yet initialized!";
+		return false;
+	}
+
+	// Check if File exists
+	FString FilePath = GetResponseCacheFilePath();
+	if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*FilePath))
+	{
+		Message = "Response Cache file doesn't exist!";
+		return false;
+	}
+
+	// Read File to String
+	FString FileLoadedToString;
+	if (!FFileHelper::LoadFileToString(FileLoadedToString, *FilePath))
+	{
+		Message = "Error reading Response Cache file to String!";
+		return false;
+	}
+
+	// Convert String to Struct
+	FModioAPI_ResponseCache LoadedResponseCache;
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(FileLoadedToString, &LoadedResponseCache, 0, 0))
+	{
+		Message = "Error converting loaded String to Response Cache!";
+		return false;
+	}
+
+	ResponseCache = FModioAPI_ResponseCache();
+	DecodedResponses.Empty();
+
+	// Decode the stored Responses once, so they can be served without parsing on '304 Not Modified'
+	for (const TPair<FString, FModioAPI_ResponseCacheEntry>& Entry : LoadedResponseCache.Entries)
+	{
+		UScriptStruct* ResponseStruct = FindObject<UScriptStruct>(nullptr, *Entry.Value.StructPath);
+		if (!ResponseStruct)
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> JsonObject;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Entry.Value.DecodedResponse), JsonObject) || !JsonObject.IsValid())
+		{
+			continue;
+		}
+
+		TSharedPtr<FStructOnScope> ScopedResponse = MakeShared<FStructOnScope>(ResponseStruct);
+		if (!FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), ResponseStruct, ScopedResponse->GetStructMemory(), 0, 0))
+		{
+			continue;
+		}
+
+		ResponseCache.Entries.Add(Entry.Key, Entry.Value);
+		DecodedResponses.Add(Entry.Key, ScopedResponse);
+	}
+
+	// The Limit may have been lowered since the File was saved
+	EvictResponseCacheEntries();
+
+	Message = "Response Cache loaded successfully from File!";
+	return true;
+}
+
+void UModioAPIObject::EvictResponseCacheEntries()
+{
+	while (ResponseCache.Entries.Num() > MaxResponseCacheEntries)
+	{
+		const FString* LeastRecentlyUsedURL = nullptr;
+		FDateTime LeastRecentlyUsed = FDateTime::MaxValue();
+
+		for (const TPair<FString, FModioAPI_ResponseCacheEntry>& Entry : ResponseCache.Entries)
+		{
+			if (Entry.Value.LastUsed < LeastRecentlyUsed || !LeastRecentlyUsedURL)
+			{
+				LeastRecentlyUsedURL = &Entry.Key;
+				LeastRecentlyUsed = Entry.Value.LastUsed;
+			}
+		}
+
+		const FString EvictedURL = *LeastRecentlyUsedURL;
+		ResponseCache.Entries.Remove(EvictedURL);
+		DecodedResponses.Remove(EvictedURL);
+
+		MarkResponseCacheDirty();
+	}
+}
+
+void UModioAPIObject::MarkResponseCacheDirty()
+{
+	bResponseCacheDirty = true;
+
+	if (!ResponseCacheSaveTickerHandle.IsValid())
+	{
+		ResponseCacheSaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UModioAPIObject::FlushResponseCache_Tick), ResponseCacheSaveDelaySeconds);
+	}
+}
+
+bool UModioAPIObject::FlushResponseCache_Tick(float DeltaTime)
+{
+	ResponseCacheSaveTickerHandle.Reset();
+
+	FString FlushMessage;
+	FlushResponseCache(FlushMessage);
+
+	return false;
+}
+
+FString UModioAPIObject::GetUsersDirectoryPath()
+{
+	FString ModioUsersPath = GetModioGameDirectory();
+
+	ModioUsersPath.Append("Users/");
+
+	if (!IFileManager::Get().DirectoryExists(*ModioUsersPath))
+	{
+		IFileManager::Get().MakeDirectory(*ModioUsersPath, true);
+	}
+
+	return ModioUsersPath;
+}
+
+FString UModioAPIObject::GetAvatarDirectoryPathForUser(int32 UserID)
+{
+	FString ModioUserDirectoryPath = GetUsersDirectoryPath();
+
+	ModioUserDirectoryPath.Append(FString::FromInt(UserID) + "/");
+
+	if (!IFileManager::Get().DirectoryExists(*ModioUserDirectoryPath))
+	{
+		IFileManager::Get().MakeDirectory(*ModioUserDirectoryPath, true);
+	}
+
+	return ModioUserDirectoryPath;
+}
+
+FString UModioAPIObject::GetMediaDirectoryPathForGame()
+{
+	FString MediaDirectoryForGame = GetModioGameDirectory();
+
+	MediaDirectoryForGame.Append("Media/");
+
+	if (!IFileManager::Get().DirectoryExists(*MediaDirectoryForGame))
+	{
+		IFileManager::Get().MakeDirectory(*MediaDirectoryForGame, true);
+	}
+
+	return MediaDirectoryForGame;
+}
+
+FString UModioAPIObject::GetModsDirectoryPath()
+{
+	FString ModsDirectoryForGame = GetModioGameDirectory();
+
+	ModsDirectoryForGame.Append("Mods/");
+
+	if (!IFileManager::Get().DirectoryExists(*ModsDirectoryForGame))
+	{
+		IFileManager::Get().MakeDirectory(*ModsDirectoryForGame, true);
+	}
+
+	return ModsDirectoryForGame;
+}
+
+FString UModioAPIObject::GetDirectoryPathForMod(int32 ModID)
+{
+	FString ModDirectory = GetModsDirectoryPath();
+
+	ModDirectory.Append(FString::FromInt(ModID) + "/");
+
+	if (!IFileManager::Get().DirectoryExists(*ModDirectory))
+	{
+		IFileManager::Get().MakeDirectory(*ModDirectory, true);
+	}
+
+	return ModDirectory;
+}
+
+FString UModioAPIObject::GetMediaDirectoryPathForMod(int32 ModID)
+{
+	FString ModMediaDirectory = GetDirectoryPathForMod(ModID);
+
+	ModMediaDirectory.Append("Media/");
+
+	if (!IFileManager::Get().DirectoryExists(*ModMediaDirectory))
+	{
+		IFileManager::Get().MakeDirectory(*ModMediaDirectory, true);
+	}
+
+	return ModMediaDirectory;
+}
+
+FString UModioAPIObject::GetGuidesDirectoryPath()
+{
+	FString GuidesDirectoryForGame = GetModioGameDirectory();
+
+	GuidesDirectoryForGame.Append("Guides/");
+
+	if (!IFileManager::Get().DirectoryExists(*GuidesDirectoryForGame))
+	{
+		IFileManager::Get().MakeDirectory(*GuidesDirectoryForGame, true);
+	}
+
+	return GuidesDirectoryForGame;
+}
+
+FString UModioAPIObject::GetDirectoryPathForGuide(int32 GuideID)
+{
+	FString GuideDirectory = GetGuidesDirectoryPath();
+
+	GuideDirectory.Append(FString::FromInt(GuideID) + "/");
+
+	if (!IFileManager::Get().DirectoryExists(*GuideDirectory))
+	{
+		IFileManager::Get().MakeDirectory(*GuideDirectory, true);
+	}
+
+	return GuideDirectory;
+}
+
+FString UModioAPIObject::GetMediaDirectoryPathForGuide(int32 GuideID)
+{
+	FString GuideMediaDirectory = GetDirectoryPathForGuide(GuideID);
+
+	GuideMediaDirectory.Append("Media/");
+
+	if (!IFileManager::Get().DirectoryExists(*GuideMediaDirectory))
+	{
+		IFileManager::Get().MakeDirectory(*GuideMediaDirectory, true);
+	}
+
+	return GuideMediaDirectory;
+}
+
+FString UModioAPIObject::GetDirectoryPathForUploadSession(FString MultipartUploadSessionID)
+{
+	FString UploadSessionDirectory = GetUploadSessionsDirectoryPath();
+
+	UploadSessionDirectory.Append(MultipartUploadSessionID + "/");
+
+	if (!IFileManager::Get().DirectoryExists(*UploadSessionDirectory))
+	{
+		IFileManager::Get().MakeDirectory(*UploadSessionDirectory, true);
+	}
+
+	return UploadSessionDirectory;
+}
+
+void UModioAPIObject::PrepareZipArchiveForMultipartUploadSession(FString ZipArchiveFilePath, FString MultipartUploadSessionID, bool& Success, FString& Message, int64& TotalSize)
+{
+	if (ZipArchiveFilePath.IsEmpty())
+	{
+		Message = "No Zip Archive File Path provided!";
+		Success = false;
+		return;
+	}
+
+	if (!IFileManager::Get().FileExists(*ZipArchiveFilePath))
+	{
+		Message = "Zip Archive File Path not pointing to a File!";
+		Success = false;
+		return;
+	}
+
+	if (FPaths::GetExtension(ZipArchiveFilePath, false).ToLower() != "zip")
+	{
+		Message = "Zip Archive File Path not pointing to a Zip-File!";
+		Success = false;
+		return;
+	}
+
+	if (MultipartUploadSessionID.IsEmpty())
+	{
+		Message = "Multipart Upload Session ID is empty!";
+		Success = false;
+		return;
+	}
+
+	IFileHandle* ZipArchiveFileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenRead(*ZipArchiveFilePath, true);
+
+	if (!ZipArchiveFileHandle)
+	{
+		Message = "No Success with Reading from the Zip Archive File!";
+		Success = false;
+		return;
+	}
+
+	TotalSize = ZipArchiveFileHandle->Size();
+	int64 BytesPerSplit = 52428800; // 50 Mebibyte = 52.428.800 Bytes
+	int32 PacketCount = FMath::CeilToInt((float(TotalSize)) / (float(BytesPerSplit)));
+	int64 BytesRead = 0;
+	uint8* DataBuffer;
+	int32 DataPartIndex = -1;
+	TArray<uint8> DataPartData;
+	bool WriteSuccess;
+	FString WriteMessage;
+
+	int64 NewPosition;
+
+	// All Splits except last one
+	if (PacketCount > 1)
+	{
+		for (int32 Index = 0; Index < PacketCount - 1; ++Index)
+		{
+			DataBuffer = (uint8*)FMemory::Malloc(BytesPerSplit);
+
+			NewPosition = Index * BytesPerSplit;
+			ZipArchiveFileHandle->Seek(NewPosition);
+
+			if (ZipArchiveFileHandle->Read(DataBuffer, BytesPerSplit))
+			{
+				BytesRead = BytesRead + BytesPerSplit;
+				DataPartIndex = Index;
+				DataPartData.Empty();
+				DataPartData.Append(DataBuffer, BytesPerSplit);
+				WriteUploadPartToMultipartUploadSessionDirectory(MultipartUploadSessionID, DataPartIndex, DataPartData, WriteSuccess, WriteMessage);
+			}
+
+			FMemory::Free(DataBuffer);
+		}
+	}
+
+	// Last Split which is not the full size!
+	int64 RemainingSize = TotalSize - BytesRead;
+
+	NewPosition = (PacketCount - 1) * BytesPerSplit;
+	ZipArchiveFileHandle->Seek(NewPosition);
+
+	DataBuffer = (uint8*)FMemory::Malloc(RemainingSize);
+
+	if (ZipArchiveFileHandle->Read(DataBuffer, RemainingSize))
+	{
+		BytesRead = BytesRead + RemainingSize;
+		DataPartIndex = (PacketCount - 1);
+		DataPartData.Empty();
+		DataPartData.Append(DataBuffer, RemainingSize);
+		WriteUploadPartToMultipartUploadSessionDirectory(MultipartUploadSessionID, DataPartIndex, DataPartData, WriteSuccess, WriteMessage);
+	}
+
+	FMemory::Free(DataBuffer);
+
+	Success = true;
+	Message = "Successfully prepared Zip Archive for Upload Session!";
+	return;
+}
+
+void UModioAPIObject::WriteUploadPartToMultipartUploadSessionDirectory(FString MultipartUploadSessionID, int32 UploadPartIndex, TArray<uint8> UploadPartData, bool& Success, FString& Message)
+{
+	if (MultipartUploadSessionID.IsEmpty())
+	{
+		Message = "Upload Session ID is empty!";
+		Success = false;
+		return;
+	}
+
+	if (UploadPartData.IsEmpty())
+	{
+		Message = "Upload Part Data empty!";
+		Success = false;
+		return;
+	}
+
+	FString FileName = GetDirectoryPathForUploadSession(MultipartUploadSessionID) + "Upload.zip." + UModioAPIFunctionLibrary::ConvertIntToZipFilePartNumber(UploadPartIndex + 1);
+	Success = FFileHelper::SaveArrayToFile(UploadPartData, *FileName);
+
+	if (Success)
+	{
+		Message = "Successfully wrote Data to File!";
+	}
+	else
+	{
+		Message = "Error while writing Data to File!";
+	}
+	return;
+}
+
+bool UModioAPIObject::CleanupUploadSession(FString MultipartUploadSessionID, FString& Message)
+{
+	FString CleanupDirectory = GetDirectoryPathForUploadSession(MultipartUploadSessionID);
+
+	if (CleanupDirectory.IsEmpty())
+	{
+		Message = "Can't find the Directory for the Upload Session in the Cache!";
+		return false;
+	}
+
+	if (!FPaths::DirectoryExists(CleanupDirectory))
+	{
+		Message = "The Directory that should be deleted doesn't exist!";
+		return false;
+	}
+
+	if (IFileManager::Get().DeleteDirectory(*CleanupDirectory, true, true))
+	{
+		Message = "Successfully cleaned up the Upload Session Cache!";
+		return true;
+	}
+	else
+	{
+		Message = "Error when cleaning up the Upload Session Cache!";
+		return false;
+	}
+}
+
+bool UModioAPIObject::CleanupAllUploadSessions(FString& Message)
+{
+	FString UploadSessionsCacheDirectory = GetUploadSessionsDirectoryPath();
+
+	if (IFileManager::Get().DeleteDirectory(*UploadSessionsCacheDirectory, true, true))
+	{
+		Message = "Successfully cleaned up all the Upload Sessions in Cache!";
+		return true;
+	}
+
+	Message = "Error when cleaning up all the Upload Sessions in Cache!";
+	return false;
+}
+
+FString UModioAPIObject::GetModfilesDirectoryPathForMod(int32 ModID)
+{
+	FString ModModfilesDirectory = GetDirectoryPathForMod(ModID);
+
+	ModModfilesDirectory.Append("Modfiles/");
+
+	if (!IFileManager::Get().DirectoryExists(*ModModfilesDirectory))
+	{
+		IFileManager::Get().MakeDirectory(*ModModfilesDirectory, true);
+	}
+
+	return ModModfilesDirectory;
+}
+
+FString UModioAPIObject::GetUploadSessionsDirectoryPath()
+{
+	FString UploadSessionsDirectoryForGame = GetModioGameDirectory();
+
+	UploadSessionsDirectoryForGame.Append("Uploads/");
+
+	if (!IFileManager::Get().DirectoryExists(*UploadSessionsDirectoryForGame))
+	{
+		IFileManager::Get().MakeDirectory(*UploadSessionsDirectoryForGame, true);
+	}
+
+	return UploadSessionsDirectoryForGame;
+}
+
+FString UModioAPIObject::GetModfileDirectoryPathForModfile(int32 ModID, int32 ModfileID)
+{
+	FString ModfileDirectory = GetModfilesDirectoryPathForMod(ModID);
+
+	ModfileDirectory.Append(FString::FromInt(ModfileID) + "/");
+
+	if (!IFileManager::Get().DirectoryExists(*ModfileDirectory))
+	{
+		IFileManager::Get().MakeDirectory(*ModfileDirectory, true);
+	}
+
+	return ModfileDirectory;
+}
+
+FString UModioAPIObject::GetContentStoreDirectoryPath()
+{
+	FString ContentStoreDirectory = GetModsDirectoryPath();
+
+	ContentStoreDirectory.Append("ContentStore/");
+
+	if (!IFileManager::Get().DirectoryExists(*ContentStoreDirectory))
+	{
+		IFileManager::Get().MakeDirectory(*ContentStoreDirectory, true);
+	}
+
+	return ContentStoreDirectory;
+}
+
+FString UModioAPIObject::GetManifestsDirectoryPathForMod(int32 ModID)
+{
+	FString ManifestsDirectory = GetDirectoryPathForMod(ModID);
+
+	ManifestsDirectory.Append("Manifests/");
+
+	if (!IFileManager::Get().DirectoryExists(*ManifestsDirectory))
+	{
+		IFileManager::Get().MakeDirectory(*ManifestsDirectory, true);
+	}
+
+	return ManifestsDirectory;
+}
+
+FString UModioAPIObject::GetManifestFilePathForModfile(int32 ModID, int32 ModfileID)
+{
+	return GetManifestsDirectoryPathForMod(ModID) + FString::FromInt(ModfileID) + ".json";
+}
+
+bool UModioAPIObject::LoadModfileManifest(int32 ModID, int32 ModfileID, FModioAPI_ModfileManifest& Manifest, FString& Message)
+{
+	FString FilePath = GetManifestFilePathForModfile(ModID, ModfileID);
+	if (!FPaths::FileExists(FilePath))
+	{
+		Message = "Modfile is not installed, its Manifest doesn't exist!";
+		return false;
+	}
+
+	// Read File to String
+	FString FileLoadedToString;
+	if (!FFileHelper::LoadFileToString(FileLoadedToString, *FilePath))
+	{
+		Message = "Error reading Modfile Manifest to String!";
+		return false;
+	}
+
+	// Convert String to Struct
+	FModioAPI_ModfileManifest LoadedManifest;
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct<FModioAPI_ModfileManifest>(FileLoadedToString, &LoadedManifest, 0, 0))
+	{
+		Message = "Error converting loaded String to Modfile Manifest!";
+		return false;
+	}
+
+	Manifest = LoadedManifest;
+	MarkCachedModUsed(ModID);
+	Message = "Modfile Manifest loaded successfully from File!";
+	return true;
+}
+
+TArray<FModioAPI_ModfileManifest> UModioAPIObject::LoadModfileManifestsForMod(int32 ModID)
+{
+	TArray<FModioAPI_ModfileManifest> Manifests;
+	TArray<FString> ManifestFileNames;
+
+	IFileManager::Get().FindFiles(ManifestFileNames, *GetManifestsDirectoryPathForMod(ModID), TEXT("json"));
+
+	for (FString ManifestFileName : ManifestFileNames)
+	{
+		FModioAPI_ModfileManifest Manifest;
+		FString LoadMessage;
+		if (LoadModfileManifest(ModID, FCString::Atoi(*FPaths::GetBaseFilename(ManifestFileName)), Manifest, LoadMessage))
+		{
+			Manifests.Add(Manifest);
+		}
+	}
+
+	return Manifests;
+}
+
+/*
+Temporary Cache
+*/
+
+bool UModioAPIObject::CacheGame(FModioAPI_Game Game, FString& Message)
+{
+	if (!TempCache.CachedGames.Find(Game.ID))
+	{
+		Message = "Game was cached!";
+		TempCache.CachedGames.Add(Game.ID, Game);
+	}
+	else
+	{
+		Message = "Game with that ID already existed in Cache. Entry was overwritten!";
+		TempCache.CachedGames.Emplace(Game.ID, Game);
+	}
+
+	return true;
+}
+
+bool UModioAPIObject::CacheTermsOfService(FModioAPI_Terms TermsOfService, FString& Message)
+{
+	TempCache.CachedTerms = TermsOfService;
+
+	Message = "Terms of Service saved to Temporary Cache!";
+	return true;
+}
+
+bool UModioAPIObject::CacheUser(FModioAPI_User User, FString& Message)
+{
+	if (!TempCache.CachedUsers.Find(User.ID))
+	{
+		Message = "User was cached!";
+		TempCache.CachedUsers.Add(User.ID, User);
+	}
+	else
+	{
+		Message = "User with that ID already existed in Cache. Entry was overwritten!";
+		TempCache.CachedUsers.Emplace(User.ID, User);
+	}
+
+	return true;
+}
+
+bool UModioAPIObject::CacheUserEvent(FModioAPI_UserEvent UserEvent, FString& Message)
+{
+	if (!TempCache.CachedEvents.Find(UserEvent.ID))
+	{
+		Message = "User Event was cached!";
+		TempCache.CachedEvents.Add(UserEvent.ID, UserEvent);
+	}
+	else
+	{
+		Message = "User Event with that ID already existed in Cache. Entry was overwritten!";
+		TempCache.CachedEvents.Emplace(UserEvent.ID, UserEvent);
+	}
+
+	return true;
+}
+
+bool UModioAPIObject::CacheModfile(FModioAPI_Modfile Modfile, FString& Message)
+{
+	if (!TempCache.CachedModfiles.Find(Modfile.ID))
+	{
+		Message = "Modfile was cached!";
+		TempCache.CachedModfiles.Add(Modfile.ID, Modfile);
+	}
+	else
+	{
+		Message = "Modfile with that ID already existed in Cache. Entry was overwritten!";
+		TempCache.CachedModfiles.Emplace(Modfile.ID, Modfile);
+	}
+
+	return true;
+}
+
+bool UModioAPIObject::UncacheModfile(int32 ModfileID, FString& Message)
+{
+	if (TempCache.CachedModfiles.Find(ModfileID))
+	{
+		Message = "Modfile was uncached!";
+		TempCache.CachedModfiles.Remove(ModfileID);
+		return true;
+	}
+	else
+	{
+		Message = "Modfile with that ID didn't exist in Cache!";
+		return false;
+	}
+}
+
+bool UModioAPIObject::CacheSubscribedMod(FModioAPI_Mod SubscribedMod, FString& Message)
+{
+	if (!TempCache.CachedSubscribedMods.Find(SubscribedMod.ID))
+	{
+		Message = "Subscribed Mod was cached!";
+		TempCache.CachedSubscribedMods.Add(SubscribedMod.ID, SubscribedMod);
+	}
+	else
+	{
+		Message = "Subscribed Mod with that ID already existed in Cache. Entry was overwritten!";
+		TempCache.CachedSubscribedMods.Emplace(SubscribedMod.ID, SubscribedMod);
+	}
+
+	return true;
+}
+
+bool UModioAPIObject::CacheUnsubscriptionFromMod(int32 UnsubscribedModID, FString& Message)
+{
+	if (TempCache.CachedSubscribedMods.Find(UnsubscribedModID))
+	{
+		Message = "Unsubscription from Mod was cached!";
+		TempCache.CachedSubscribedMods.Remove(UnsubscribedModID);
+		return true;
+	}
+
+	Message = "Unsubscription from Mod couldn't be cached! Mod wasn't in Subscribed Mods Cache!";
+	return false;
+}
+
+bool UModioAPIObject::CacheMod(FModioAPI_Mod Mod, FString& Message)
+{
+	if (!TempCache.CachedMods.Find(Mod.ID))
+	{
+		Message = "Mod was cached!";
+		TempCache.CachedMods.Add(Mod.ID, Mod);
+	}
+	else
+	{
+		Message = "Mod with that ID already existed in Cache. Entry was overwritten!";
+		TempCache.CachedMods.Emplace(Mod.ID, Mod);
+	}
+
+	return true;
+}
+
+bool UModioAPIObject::UncacheMod(int32 ModID, FString& Message)
+{
+	if (TempCache.CachedMods.Find(ModID))
+	{
+		Message = "Mod was uncached!";
+		TempCache.CachedMods.Remove(ModID);
+		return true;
+	}
+	else
+	{
+		Message = "Mod with that ID didn't exist in Cache!";
+		return false;
+	}
+}
+
+bool UModioAPIObject::CachePurchasedMod(FModioAPI_Mod PurchasedMod, FString& Message)
+{
+	if (!TempCache.CachedPurchasedMods.Find(PurchasedMod.ID))
+	{
+		Message = "Purchased Mod was cached!";
+		TempCache.CachedPurchasedMods.Add(PurchasedMod.ID, PurchasedMod);
+	}
+	else
+	{
+		Message = "Purchased Mod with that ID already existed in Cache. Entry was overwritten!";
+		TempCache.CachedPurchasedMods.Emplace(PurchasedMod.ID, PurchasedMod);
+	}
+
+	return true;
+}
+
+bool UModioAPIObject::CacheMutedUser(FModioAPI_User User, FString& Message)
+{
+	if (!TempCache.CachedMutedUsers.Find(User.ID))
+	{
+		Message = "Muted User was cached!";
+		TempCache.CachedMutedUsers.Add(User.ID, User);
+	}
+	else
+	{
+		Message = "Muted User with that ID already existed in Cache. Entry was overwritten!";
+		TempCache.CachedMutedUsers.Emplace(User.ID, User);
+	}
+
+	FString Temp;
+	CacheUser(User, Temp);
+
+	return true;
+}
+
+bool UModioAPIObject::CacheRating(FModioAPI_Rating Rating, FString& Message)
+{
+	if (Rating.Game_ID != ModioGameID)
+	{
+		Message = "Only Ratings for the Game-ID of the Connection are supported right now!";
+		return false;
+	}
+
+	if (!TempCache.CachedModRatings.Find(Rating.Mod_ID))
+	{
+		Message = "Rating was cached!";
+		TempCache.CachedModRatings.Add(Rating.Mod_ID, Rating);
+	}
+	else
+	{
+		Message = "Rating with that Mod-ID already existed in Cache. Entry was overwritten!";
+		TempCache.CachedModRatings.Emplace(Rating.Mod_ID, Rating);
+	}
+
+	return true;
+}
+
+bool UModioAPIObject::CacheWallet(FModioAPI_Wallet Wallet, FString& Message)
+{
+	Message = "Wallet was cached!";
+	TempCache.CachedWallet = Wallet;
+	return true;
+}
+
+bool UModioAPIObject::CacheGameTagOptions(FModioAPI_GetGameTagOptions GameTagOptions, FString& Message)
+{
+	if (TempCache.CachedGames.Find(ModioGameID))
+	{
+		TempCache.CachedGames.Find(ModioGameID)->Tag_Options = GameTagOptions.Data;
+		Message = "Game Tag Options were cached!";
+		return true;
+	}
+	else
+	{
+		Message = "Game wasn't cached before!";
+	}
+
+	return false;
+}
+
+bool UModioAPIObject::GetCachedModfilesForMod(int32 ModID, TArray<int32>& Modfiles, FString& Message)
+{
+	if (ModID < 1)
+	{
+		return false;
+	}
+
+	TArray<FModioAPI_Modfile> CachedModfiles;
+	GetCached_Modfiles(FModioAPI_RequestFilters(), FModioAPI_RequestSorting(), FModioAPI_RequestPagination(), CachedModfiles);
+
+	TArray<int32> CachedModfilesForMod;
+	CachedModfilesForMod.Empty();
+
+	for (FModioAPI_Modfile Modfile : CachedModfiles)
+	{
+		if (Modfile.Mod_ID == ModID)
+		{
+			CachedModfilesForMod.Add(Modfile.ID);
+		}
+	}
+
+	Modfiles = CachedModfilesForMod;
+	return true;
+}
 
 bool UModioAPIObject::GetCachedActiveModfileForPlatform(FModioAPI_Mod Mod, TEnumAsByte<EModioAPI_Platforms> Platform, FModioAPI_Modfile& Modfile, FString& Message)
 {
-	if (Mod.ID < 1)
+	if (Mod.ID < 1)
+	{
+		return false;
+	}
+
+	for (FModioAPI_ModPlatforms ModPlatform : Mod.Platforms)
+	{
+		if (ModPlatform.Platform == UModioAPIFunctionLibrary::ConvertPlatformToPlatformCode(Platform))
+		{
+			if (GetCached_Modfile(ModPlatform.Modfile_Live, Modfile))
+			{
+				return true;
+			}
+		}
+	}
+
+	Modfile = FModioAPI_Modfile();
+	return false;
+}
+
+UTexture2D* UModioAPIObject::GetGameLogoFromCache(FString& Message)
+{
+	UTexture2D* GameLogo;
+
+	FImage LoadedImage;
+	FString FilePath = GetMediaDirectoryPathForGame() + "Logo.png";
+
+	if (!IFileManager::Get().FileExists(*FilePath))
+	{
+		Message = "Can't find Logo for Game from Cache!";
+		return NULL;
+	}
+
+	if (!FImageUtils::LoadImage(*FilePath, LoadedImage))
+	{
+		Message = "Can't load Logo for Game from Cache!";
+		return NULL;
+	}
+
+	GameLogo = FImageUtils::CreateTexture2DFromImage(LoadedImage);
+
+	return GameLogo;
+}
+
+UTexture2D* UModioAPIObject::GetGameHeaderFromCache(FString& Message)
+{
+	UTexture2D* GameHeader;
+
+	FImage LoadedImage;
+	FString FilePath = GetMediaDirectoryPathForGame() + "Header.png";
+
+	if (!IFileManager::Get().FileExists(*FilePath))
+	{
+		Message = "Can't find Header for Game from Cache!";
+		return NULL;
+	}
+
+	if (!FImageUtils::LoadImage(*FilePath, LoadedImage))
+	{
+		Message = "Can't load Header for Game from Cache!";
+		return NULL;
+	}
+
+	GameHeader = FImageUtils::CreateTexture2DFromImage(LoadedImage);
+
+	return GameHeader;
+}
+
+UTexture2D* UModioAPIObject::GetGameIconFromCache(FString& Message)
+{
+	UTexture2D* GameIcon;
+
+	FImage LoadedImage;
+	FString FilePath = GetMediaDirectoryPathForGame() + "Icon.png";
+
+	if (!IFileManager::Get().FileExists(*FilePath))
+	{
+		Message = "Can't find Icon for Game from Cache!";
+		return NULL;
+	}
+
+	if (!FImageUtils::LoadImage(*FilePath, LoadedImage))
+	{
+		Message = "Can't load Icon for Game from Cache!";
+		return NULL;
+	}
+
+	GameIcon = FImageUtils::CreateTexture2DFromImage(LoadedImage);
+
+	return GameIcon;
+}
+
+UTexture2D* UModioAPIObject::GetModLogoFromCache(int32 ModID, FString& Message)
+{
+	UTexture2D* ModLogo;
+
+	FImage LoadedImage;
+	FString FilePath = GetMediaDirectoryPathForMod(ModID) + "Logo.png";
+
+	if (!IFileManager::Get().FileExists(*FilePath))
+	{
+		Message = "Can't find Logo for Mod from Cache!";
+		return NULL;
+	}
+
+	if (!FImageUtils::LoadImage(*FilePath, LoadedImage))
+	{
+		Message = "Can't load Logo for Mod from Cache!";
+		return NULL;
+	}
+
+	ModLogo = FImageUtils::CreateTexture2DFromImage(LoadedImage);
+	MarkCachedModUsed(ModID);
+
+	return ModLogo;
+}
+
+TArray<UTexture2D*> UModioAPIObject::GetModImagesFromCache(int32 ModID, FString& Message)
+{
+	// TODO
+	Message = "Not implemented yet!";
+	return TArray<UTexture2D*>();
+}
+
+bool UModioAPIObject::GetModfilePathFromCache(int32 ModID, int32 ModfileID, FString& PathToModfile, FString& Message)
+{
+	PathToModfile = "";
+
+	if (ModID <= 0)
+	{
+		Message = "Invalid Mod ID!";
+		return false;
+	}
+
+	if (ModfileID <= 0)
+	{
+		Message = "Invalid Modfile ID!";
+		return false;
+	}
+
+	FString ModfileDirectory = GetModfileDirectoryPathForModfile(ModID, ModfileID);
+
+	if (!IFileManager::Get().DirectoryExists(*ModfileDirectory))
+	{
+		Message = "Directory for that Modfile doesn't exist in Cache!";
+		return false;
+	}
+
+	// Get Zip-Archive from Folder
+	TArray<FString> Files = TArray<FString>();
+	IFileManager::Get().FindFiles(Files, *ModfileDirectory);
+
+	for (FString File : Files)
+	{
+		if (File.ToLower().EndsWith(".zip"))
+		{
+			PathToModfile = ModfileDirectory + File;
+			MarkCachedModUsed(ModID);
+			Message = "Found the Modfile Zip-Archive!";
+			return true;
+		}
+	}
+
+	Message = "No Zip-Archive found in the Cache Directory for the Modfile!";
+	return false;
+}
+
+UTexture2D* UModioAPIObject::GetAvatarOfUserFromCache(int32 UserID, FString& Message)
+{
+	UTexture2D* UserAvatar;
+
+	FImage LoadedImage;
+
+	// TODO: This could potentially be a different type of Image-File / Extension (.jpg, .jpeg, etc.)
+	FString FilePath = GetAvatarDirectoryPathForUser(UserID) + "Avatar.png";
+
+	if (!IFileManager::Get().FileExists(*FilePath))
+	{
+		Message = "Can't find Avatar of User in Cache!";
+		return NULL;
+	}
+
+	if (!FImageUtils::LoadImage(*FilePath, LoadedImage))
+	{
+		Message = "Can't load Avatar of User from Cache!";
+		return NULL;
+	}
+
+	UserAvatar = FImageUtils::CreateTexture2DFromImage(LoadedImage);
+
+	return UserAvatar;
+}
+
+bool UModioAPIObject::ClearCachedAvatarForUser(FModioAPI_User User)
+{
+	if (User.ID <= 0)
+	{
+		return false;
+	}
+
+	// Clear Cached Avatar
+	TArray<FString> Files = TArray<FString>();
+	FString UserDirectory = GetAvatarDirectoryPathForUser(User.ID);
+	IFileManager::Get().FindFiles(Files, *UserDirectory);
+
+	for (FString File : Files)
+	{
+		if (File.Contains("Avatar"))
+		{
+			if (IFileManager::Get().Delete(*(UserDirectory + File), true))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool UModioAPIObject::ClearCachedFileStorageForUser(FModioAPI_User User)
+{
+	if (User.ID <= 0)
 	{
 		return false;
 	}
 
-	for (FModioAPI_ModPlatforms ModPlatform : Mod.Platforms)
+	FString UserDirectory = GetAvatarDirectoryPathForUser(User.ID);
+	if (IFileManager::Get().DeleteDirectory(*UserDirectory, true, true))
 	{
-		if (ModPlatform.Platform == UModioAPIFunctionLibrary::ConvertPlatformToPlatformCode(Platform))
+		return true;
+	}
+
+	return false;
+}
+
+bool UModioAPIObject::ClearCachedFileStorageForAllUsers()
+{
+	FString UsersDirectory = GetUsersDirectoryPath();
+	if (IFileManager::Get().DeleteDirectory(*UsersDirectory, true, true))
+	{
+		return true;
+	}
+
+	return false;
+}
+
+bool UModioAPIObject::ClearCachedFileStorageForGuide(FModioAPI_Guide Guide)
+{
+	if (Guide.ID <= 0)
+	{
+		return false;
+	}
+
+	FString GuideDirectory = GetDirectoryPathForGuide(Guide.ID);
+	if (IFileManager::Get().DeleteDirectory(*GuideDirectory, true, true))
+	{
+		return true;
+	}
+
+	return false;
+}
+
+bool UModioAPIObject::ClearCachedFileStorageForAllGuides()
+{
+	FString GuidesDirectory = GetGuidesDirectoryPath();
+	if (IFileManager::Get().DeleteDirectory(*GuidesDirectory, true, true))
+	{
+		return true;
+	}
+
+	return false;
+}
+
+bool UModioAPIObject::ClearCachedMediaForMod(FModioAPI_Mod Mod)
+{
+	FString ModsMediaDirectory = GetMediaDirectoryPathForMod(Mod.ID);
+	if (IFileManager::Get().DeleteDirectory(*ModsMediaDirectory, true, true))
+	{
+		MeasureCachedModSizes(Mod.ID);
+		return true;
+	}
+
+	return false;
+}
+
+bool UModioAPIObject::ClearCachedModfilesForMod(FModioAPI_Mod Mod)
+{
+	FString ModsModfilesDirectory = GetModfilesDirectoryPathForMod(Mod.ID);
+	IFileManager::Get().DeleteDirectory(*GetManifestsDirectoryPathForMod(Mod.ID), true, true);
+
+	// Deleted and swept from the Content Store in the Background, like evicted Mods
+	TArray<FString> EvictedDirectories;
+	if (MoveEvictedDirectory(ModsModfilesDirectory, EvictedDirectories))
+	{
+		DeleteEvictedDirectories(MoveTemp(EvictedDirectories), 0);
+		MeasureCachedModSizes(Mod.ID);
+		return true;
+	}
+
+	return false;
+}
+
+bool UModioAPIObject::ClearCachedModfilesForModExcept(FModioAPI_Mod Mod, int32 ExceptedModfileID)
+{
+	FString ModsModfilesDirectory = GetModfilesDirectoryPathForMod(Mod.ID);
+	TArray<FString> Directories;
+
+	// Only the Modfile Directories themselves, their Contents are deleted in the Background
+	IFileManager::Get().FindFiles(Directories, *(ModsModfilesDirectory + "*"), false, true);
+
+	TArray<FString> EvictedDirectories;
+	for (FString Directory : Directories)
+	{
+		if (Directory != FString::FromInt(ExceptedModfileID))
 		{
-			if (GetCached_Modfile(ModPlatform.Modfile_Live, Modfile))
-			{
-				return true;
-			}
+			MoveEvictedDirectory(ModsModfilesDirectory + Directory + "/", EvictedDirectories);
 		}
 	}
 
-	Modfile = FModioAPI_Modfile();
+	TArray<FString> ManifestFileNames;
+	FString ManifestsDirectory = GetManifestsDirectoryPathForMod(Mod.ID);
+
+	IFileManager::Get().FindFiles(ManifestFileNames, *ManifestsDirectory, TEXT("json"));
+
+	for (FString ManifestFileName : ManifestFileNames)
+	{
+		if (FPaths::GetBaseFilename(ManifestFileName) != FString::FromInt(ExceptedModfileID))
+		{
+			IFileManager::Get().Delete(*(ManifestsDirectory + ManifestFileName), false, true, true);
+		}
+	}
+
+	// Also sweeps the Content Store if no Modfile Directory had to be deleted, as Manifests may have been
+	DeleteEvictedDirectories(MoveTemp(EvictedDirectories), 0);
+	MeasureCachedModSizes(Mod.ID);
+	return true;
+}
+
+bool UModioAPIObject::ClearCachedFileStorageForMod(FModioAPI_Mod Mod)
+{
+	FString ModFileStorageDirectory = GetDirectoryPathForMod(Mod.ID);
+
+	TArray<FString> EvictedDirectories;
+	if (MoveEvictedDirectory(ModFileStorageDirectory, EvictedDirectories))
+	{
+		DeleteEvictedDirectories(MoveTemp(EvictedDirectories), 0);
+		MeasureCachedModSizes(Mod.ID);
+		return true;
+	}
+
 	return false;
 }
 
-UTexture2D* UModioAPIObject::GetGameLogoFromCache(FString& Message)
+bool UModioAPIObject::ClearCachedFileStorageForAllMods()
 {
-	UTexture2D* GameLogo;
+	FString ModsFileStorageDirectory = GetModsDirectoryPath();
+	if (IFileManager::Get().DeleteDirectory(*ModsFileStorageDirectory, true, true))
+	{
+		CachedModSizes.Empty();
+		CachedModsBytes = 0;
+		MeasureCachedModSizes(INDEX_NONE);
+		return true;
+	}
 
-	FImage LoadedImage;
-	FString FilePath = GetMediaDirectoryPathForGame() + "Logo.png";
+	return false;
+}
 
-	if (!IFileManager::Get().FileExists(*FilePath))
+bool UModioAPIObject::ClearUnreferencedContentStoreFiles()
+{
+	return ClearUnreferencedFilesInContentStore(GetModsDirectoryPath(), GetContentStoreDirectoryPath());
+}
+
+bool UModioAPIObject::ClearUnreferencedFilesInContentStore(const FString& ModsDirectoryPath, const FString& ContentStoreDirectoryPath)
+{
+	uint32 InstallRevision = 0;
 	{
-		Message = "Can't find Logo for Game from Cache!";
-		return NULL;
+		FScopeLock Lock(&ContentStoreLock);
+		if (NumOfContentStoreInstalls > 0)
+		{
+			PendingContentStoreSweep = TPair<FString, FString>(ModsDirectoryPath, ContentStoreDirectoryPath);
+			return false;
+		}
+
+		InstallRevision = ContentStoreInstallRevision;
+	}
+
+	// Collect the Hashes of the Files all installed Modfiles refer to
+	TSet<FString> ReferencedHashes;
+	TArray<FString> ManifestFilePaths;
+
+	IFileManager::Get().FindFilesRecursive(ManifestFilePaths, *ModsDirectoryPath, TEXT("*.json"), true, false);
+
+	for (FString ManifestFilePath : ManifestFilePaths)
+	{
+		if (!FPaths::GetPath(ManifestFilePath).EndsWith("Manifests"))
+		{
+			continue;
+		}
+
+		FString FileLoadedToString;
+		FModioAPI_ModfileManifest Manifest;
+		if (!FFileHelper::LoadFileToString(FileLoadedToString, *ManifestFilePath) || !FJsonObjectConverter::JsonObjectStringToUStruct<FModioAPI_ModfileManifest>(FileLoadedToString, &Manifest, 0, 0))
+		{
+			// Without knowing which Files it refers to, nothing can be cleared safely
+			return false;
+		}
+
+		for (FModioAPI_ModfileManifestEntry ManifestEntry : Manifest.Files)
+		{
+			ReferencedHashes.Add(ManifestEntry.Hash);
+		}
+	}
+
+	TArray<FString> StoredFilePaths;
+	IFileManager::Get().FindFilesRecursive(StoredFilePaths, *ContentStoreDirectoryPath, TEXT("*"), true, false);
+
+	// Installations starting now wait until the Files are deleted, the ones started since the Manifests were read make them outdated
+	FScopeLock Lock(&ContentStoreLock);
+	if (NumOfContentStoreInstalls > 0 || ContentStoreInstallRevision != InstallRevision)
+	{
+		PendingContentStoreSweep = TPair<FString, FString>(ModsDirectoryPath, ContentStoreDirectoryPath);
+		return false;
+	}
+
+	for (FString StoredFilePath : StoredFilePaths)
+	{
+		if (!ReferencedHashes.Contains(FPaths::GetCleanFilename(StoredFilePath)))
+		{
+			IFileManager::Get().Delete(*StoredFilePath, false, true, true);
+		}
+	}
+
+	return true;
+}
+
+void UModioAPIObject::BeginContentStoreInstall()
+{
+	FScopeLock Lock(&ContentStoreLock);
+	NumOfContentStoreInstalls++;
+	ContentStoreInstallRevision++;
+}
+
+void UModioAPIObject::EndContentStoreInstall()
+{
+	TOptional<TPair<FString, FString>> PendingSweep;
+	{
+		FScopeLock Lock(&ContentStoreLock);
+		NumOfContentStoreInstalls = FMath::Max(NumOfContentStoreInstalls - 1, 0);
+
+		if (NumOfContentStoreInstalls == 0)
+		{
+			PendingSweep = MoveTemp(PendingContentStoreSweep);
+			PendingContentStoreSweep.Reset();
+		}
+	}
+
+	if (PendingSweep.IsSet())
+	{
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [PendingSweep = PendingSweep.GetValue()]()
+		{
+			ClearUnreferencedFilesInContentStore(PendingSweep.Key, PendingSweep.Value);
+		});
+	}
+}
+
+bool UModioAPIObject::ClearPersistingCache()
+{
+	FString PersistingCacheFilePath = GetPersistingCacheFilePath();
+	if (IFileManager::Get().Delete(*PersistingCacheFilePath, true))
+	{
+		return true;
+	}
+
+	return false;
+}
+
+bool UModioAPIObject::ClearResponseCache()
+{
+	ResponseCache = FModioAPI_ResponseCache();
+	DecodedResponses.Empty();
+	bResponseCacheDirty = false;
+
+	FString ResponseCacheFilePath = GetResponseCacheFilePath();
+	if (IFileManager::Get().Delete(*ResponseCacheFilePath, true))
+	{
+		return true;
+	}
+
+	return false;
+}
+
+void UModioAPIObject::SetMaxResponseCacheEntries(int32 MaxEntries)
+{
+	MaxResponseCacheEntries = FMath::Max(1, MaxEntries);
+
+	EvictResponseCacheEntries();
+}
+
+bool UModioAPIObject::FlushResponseCache(FString& Message)
+{
+	if (ResponseCacheSaveTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ResponseCacheSaveTickerHandle);
+		ResponseCacheSaveTickerHandle.Reset();
+	}
+
+	if (!bResponseCacheDirty)
+	{
+		Message = "Response Cache has no unsaved Changes!";
+		return true;
+	}
+
+	if (!SaveResponseCacheToFile(Message))
+	{
+		return false;
+	}
+
+	bResponseCacheDirty = false;
+	return true;
+}
+
+/*
+Cache Quota
+*/
+
+void UModioAPIObject::SetCacheQuota(int64 QuotaBytes)
+{
+	CacheQuota = FMath::Max<int64>(QuotaBytes, 0);
+}
+
+void UModioAPIObject::SetMinFreeDiskSpace(int64 Bytes)
+{
+	MinFreeDiskSpace = FMath::Max<int64>(Bytes, 0);
+}
+
+FModioAPI_CacheSpaceInfo UModioAPIObject::GetCacheSpaceInfo()
+{
+	FModioAPI_CacheSpaceInfo CacheSpaceInfo;
+	CacheSpaceInfo.CacheSize = GetCacheSize();
+	CacheSpaceInfo.CacheQuota = CacheQuota;
+	CacheSpaceInfo.ReservedBytes = GetReservedCacheSpace();
+	CacheSpaceInfo.MinFreeDiskSpace = MinFreeDiskSpace;
+
+	int64 FreeDiskSpace;
+	if (GetFreeDiskSpace(FreeDiskSpace))
+	{
+		CacheSpaceInfo.FreeDiskSpace = FreeDiskSpace;
+	}
+
+	return CacheSpaceInfo;
+}
+
+void UModioAPIObject::MarkCachedModUsed(int32 ModID)
+{
+	if (!bCacheUsageLoaded)
+	{
+		FString LoadMessage;
+		LoadCacheUsageFromFile(LoadMessage);
+	}
+
+	// Saved along with the next Reservation or Eviction, not on every Access
+	CacheUsage.ModsLastUsed.Add(ModID, FDateTime::UtcNow());
+}
+
+bool UModioAPIObject::ReserveCacheSpace(int32 ModID, int64 RequiredBytes, FString& Message)
+{
+	if (!IsInitialized())
+	{
+		Message = "Mod.io not yet initialized!";
+		return false;
+	}
+
+	RequiredBytes = FMath::Max<int64>(RequiredBytes, 0);
+	MarkCachedModUsed(ModID);
+
+	// Check Cache Quota
+	if (CacheQuota > 0)
+	{
+		if (RequiredBytes > CacheQuota)
+		{
+			Message = FString::Printf(TEXT("Insufficient Cache Quota! %lld Bytes are required, but the Cache Quota is only %lld Bytes!"), RequiredBytes, CacheQuota);
+			return false;
+		}
+
+		int64 QuotaExcess = GetCacheSize() + GetReservedCacheSpace() + RequiredBytes - CacheQuota;
+		if (QuotaExcess > 0)
+		{
+			EvictLeastRecentlyUsedMods(QuotaExcess, ModID);
+			QuotaExcess = GetCacheSize() + GetReservedCacheSpace() + RequiredBytes - CacheQuota;
+		}
+
+		if (QuotaExcess > 0)
+		{
+			Message = FString::Printf(TEXT("Insufficient Cache Quota! %lld Bytes are required, but only %lld Bytes could be made available!"), RequiredBytes, RequiredBytes - QuotaExcess);
+			return false;
+		}
 	}
 
-	if (!FImageUtils::LoadImage(*FilePath, LoadedImage))
+	// Check free Disk Space, the Space reserved by others is still to be written and evicted Directories are still being deleted
+	int64 FreeDiskSpace;
+	if (GetFreeDiskSpace(FreeDiskSpace))
 	{
-		Message = "Can't load Logo for Game from Cache!";
-		return NULL;
+		int64 DiskExcess = GetReservedCacheSpace() + RequiredBytes + MinFreeDiskSpace - FreeDiskSpace - PendingEvictionBytes;
+		if (DiskExcess > 0)
+		{
+			EvictLeastRecentlyUsedMods(DiskExcess, ModID);
+			GetFreeDiskSpace(FreeDiskSpace);
+			DiskExcess = GetReservedCacheSpace() + RequiredBytes + MinFreeDiskSpace - FreeDiskSpace - PendingEvictionBytes;
+		}
+
+		if (DiskExcess > 0)
+		{
+			Message = FString::Printf(TEXT("Insufficient Disk Space! %lld Bytes are required, but only %lld Bytes are free!"), RequiredBytes, FMath::Max<int64>(RequiredBytes - DiskExcess, 0));
+			return false;
+		}
 	}
 
-	GameLogo = FImageUtils::CreateTexture2DFromImage(LoadedImage);
+	CacheReservations.FindOrAdd(ModID) += RequiredBytes;
 
-	return GameLogo;
+	FString SaveMessage;
+	SaveCacheUsageToFile(SaveMessage);
+
+	Message = "Cache Space reserved successfully!";
+	return true;
 }
 
-UTexture2D* UModioAPIObject::GetGameHeaderFromCache(FString& Message)
+void UModioAPIObject::ReleaseCacheSpace(int32 ModID, int64 ReservedBytes)
 {
-	UTexture2D* GameHeader;
-
-	FImage LoadedImage;
-	FString FilePath = GetMediaDirectoryPathForGame() + "Header.png";
-
-	if (!IFileManager::Get().FileExists(*FilePath))
+	int64* Reservation = CacheReservations.Find(ModID);
+	if (!Reservation)
 	{
-		Message = "Can't find Header for Game from Cache!";
-		return NULL;
+		return;
 	}
 
-	if (!FImageUtils::LoadImage(*FilePath, LoadedImage))
+	*Reservation -= ReservedBytes;
+	if (*Reservation <= 0)
 	{
-		Message = "Can't load Header for Game from Cache!";
-		return NULL;
+		CacheReservations.Remove(ModID);
 	}
 
-	GameHeader = FImageUtils::CreateTexture2DFromImage(LoadedImage);
-
-	return GameHeader;
+	// The reserved Bytes are counted until the Mod was measured with the Files written
+	const FModioAPI_CachedModSize* CachedModSize = CachedModSizes.Find(ModID);
+	SetCachedModSize(ModID, (CachedModSize ? CachedModSize->Bytes : 0) + FMath::Max<int64>(ReservedBytes, 0), CachedModSize ? CachedModSize->MediaBytes : 0, ++CacheSizeRevision);
+	MeasureCachedModSizes(ModID);
 }
 
-UTexture2D* UModioAPIObject::GetGameIconFromCache(FString& Message)
+int64 UModioAPIObject::EvictLeastRecentlyUsedMods(int64 BytesToFree, int32 ExceptedModID)
 {
-	UTexture2D* GameIcon;
-
-	FImage LoadedImage;
-	FString FilePath = GetMediaDirectoryPathForGame() + "Icon.png";
-
-	if (!IFileManager::Get().FileExists(*FilePath))
+	if (BytesToFree <= 0)
 	{
-		Message = "Can't find Icon for Game from Cache!";
-		return NULL;
+		return 0;
 	}
 
-	if (!FImageUtils::LoadImage(*FilePath, LoadedImage))
+	if (!bCacheUsageLoaded)
 	{
-		Message = "Can't load Icon for Game from Cache!";
-		return NULL;
+		FString LoadMessage;
+		LoadCacheUsageFromFile(LoadMessage);
 	}
 
-	GameIcon = FImageUtils::CreateTexture2DFromImage(LoadedImage);
+	EnsureCachedModSizesMeasured();
 
-	return GameIcon;
-}
+	// Mods without recorded Usage were last used when their Directory was modified
+	TArray<TPair<FDateTime, int32>> EvictionCandidates;
+	for (const TPair<int32, FModioAPI_CachedModSize>& CachedModSize : CachedModSizes)
+	{
+		const int32 ModID = CachedModSize.Key;
+		if (CachedModSize.Value.Bytes <= 0 || ModID == ExceptedModID || CacheReservations.Contains(ModID))
+		{
+			continue;
+		}
 
-UTexture2D* UModioAPIObject::GetModLogoFromCache(int32 ModID, FString& Message)
-{
-	UTexture2D* ModLogo;
+		if (GetSubscriptionSync()->IsModRequired(ModID))
+		{
+			continue;
+		}
 
-	FImage LoadedImage;
-	FString FilePath = GetMediaDirectoryPathForMod(ModID) + "Logo.png";
+		const FDateTime* LastUsed = CacheUsage.ModsLastUsed.Find(ModID);
+		EvictionCandidates.Add(TPair<FDateTime, int32>(LastUsed ? *LastUsed : IFileManager::Get().GetTimeStamp(*(GetModsDirectoryPath() + FString::FromInt(ModID))), ModID));
+	}
 
-	if (!IFileManager::Get().FileExists(*FilePath))
+	EvictionCandidates.Sort([](const TPair<FDateTime, int32>& A, const TPair<FDateTime, int32>& B)
 	{
-		Message = "Can't find Logo for Mod from Cache!";
-		return NULL;
+		return A.Key < B.Key;
+	});
+
+	int64 FreedBytes = 0;
+	TArray<FString> EvictedDirectories;
+
+	// Whole Directories of unsubscribed Mods first, then only the Media of subscribed Mods
+	for (int32 Pass = 0; Pass < 2 && FreedBytes < BytesToFree; Pass++)
+	{
+		for (const TPair<FDateTime, int32>& Candidate : EvictionCandidates)
+		{
+			if (FreedBytes >= BytesToFree)
+			{
+				break;
+			}
+
+			int32 ModID = Candidate.Value;
+			bool bSubscribed = !bSubscriptionsCached || TempCache.CachedSubscribedMods.Contains(ModID);
+			FString ModDirectory = GetModsDirectoryPath() + FString::FromInt(ModID) + "/";
+			const FModioAPI_CachedModSize CachedModSize = CachedModSizes.FindRef(ModID);
+
+			if (Pass == 0 && !bSubscribed)
+			{
+				if (MoveEvictedDirectory(ModDirectory, EvictedDirectories))
+				{
+					FreedBytes += CachedModSize.Bytes;
+					SetCachedModSize(ModID, 0, 0, ++CacheSizeRevision);
+					CacheUsage.ModsLastUsed.Remove(ModID);
+				}
+			}
+			else if (Pass == 1 && bSubscribed && CachedModSize.MediaBytes > 0)
+			{
+				if (MoveEvictedDirectory(ModDirectory + "Media/", EvictedDirectories))
+				{
+					FreedBytes += CachedModSize.MediaBytes;
+					SetCachedModSize(ModID, CachedModSize.Bytes - CachedModSize.MediaBytes, 0, ++CacheSizeRevision);
+				}
+			}
+		}
 	}
 
-	if (!FImageUtils::LoadImage(*FilePath, LoadedImage))
+	if (EvictedDirectories.Num() > 0)
 	{
-		Message = "Can't load Logo for Mod from Cache!";
-		return NULL;
+		DeleteEvictedDirectories(MoveTemp(EvictedDirectories), FreedBytes);
 	}
 
-	ModLogo = FImageUtils::CreateTexture2DFromImage(LoadedImage);
+	FString SaveMessage;
+	SaveCacheUsageToFile(SaveMessage);
 
-	return ModLogo;
+	return FreedBytes;
 }
 
-TArray<UTexture2D*> UModioAPIObject::GetModImagesFromCache(int32 ModID, FString& Message)
+FString UModioAPIObject::GetCacheUsageFilePath()
 {
-	// TODO
-	Message = "Not implemented yet!";
-	return TArray<UTexture2D*>();
+	return GetModsDirectoryPath() + "CacheUsage.json";
 }
 
-bool UModioAPIObject::GetModfilePathFromCache(int32 ModID, int32 ModfileID, FString& PathToModfile, FString& Message)
+bool UModioAPIObject::SaveCacheUsageToFile(FString& Message)
 {
-	PathToModfile = "";
-
-	if (ModID <= 0)
+	if (!IsInitialized())
 	{
-		Message = "Invalid Mod ID!";
+		Message = "Mod.io not yet initialized!";
 		return false;
 	}
 
-	if (ModfileID <= 0)
+	// Convert Cache Usage Struct to JSON String
+	FString JsonString;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(CacheUsage, JsonString, 0, 0, 0, nullptr, false))
 	{
-		Message = "Invalid Modfile ID!";
+		Message = "Error converting Cache Usage to JSON String!";
 		return false;
 	}
 
-	FString ModfileDirectory = GetModfileDirectoryPathForModfile(ModID, ModfileID);
-
-	if (!IFileManager::Get().DirectoryExists(*ModfileDirectory))
+	// Write String to File
+	if (!FFileHelper::SaveStringToFile(JsonString, *GetCacheUsageFilePath()))
 	{
-		Message = "Directory for that Modfile doesn't exist in Cache!";
+		Message = "Error writing Cache Usage File!";
 		return false;
 	}
 
-	// Get Zip-Archive from Folder
-	TArray<FString> Files = TArray<FString>();
-	IFileManager::Get().FindFiles(Files, *ModfileDirectory);
-
-	for (FString File : Files)
-	{
-		if (File.ToLower().EndsWith(".zip"))
-		{
-			PathToModfile = File;
-			Message = "Found the Modfile Zip-Archive!";
-			return true;
-		}
-	}
-
-	Message = "No Zip-Archive found in the Cache Directory for the Modfile!";
-	return false;
+	Message = "Cache Usage saved successfully to File!";
+	return true;
 }
 
-UTexture2D* UModioAPIObject::GetAvatarOfUserFromCache(int32 UserID, FString& Message)
+bool UModioAPIObject::LoadCacheUsageFromFile(FString& Message)
 {
-	UTexture2D* UserAvatar;
+	if (!IsInitialized())
+	{
+		Message = "Mod.io not yet initialized!";
+		return false;
+	}
 
-	FImage LoadedImage;
+	bCacheUsageLoaded = true;
 
-	// TODO: This could potentially be a different type of Image-File / Extension (.jpg, .jpeg, etc.)
-	FString FilePath = GetAvatarDirectoryPathForUser(UserID) + "Avatar.png";
+	// Check if File exists
+	FString FilePath = GetCacheUsageFilePath();
+	if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*FilePath))
+	{
+		Message = "Cache Usage file doesn't exist!";
+		return false;
+	}
 
-	if (!IFileManager::Get().FileExists(*FilePath))
+	// Read File to String
+	FString FileLoadedToString;
+	if (!FFileHelper::LoadFileToString(FileLoadedToString, *FilePath))
 	{
-		Message = "Can't find Avatar of User in Cache!";
-		return NULL;
+		Message = "Error reading Cache Usage file to String!";
+		return false;
 	}
 
-	if (!FImageUtils::LoadImage(*FilePath, LoadedImage))
+	// Convert String to Struct
+	FModioAPI_CacheUsage LoadedCacheUsage;
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(FileLoadedToString, &LoadedCacheUsage, 0, 0))
 	{
-		Message = "Can't load Avatar of User from Cache!";
-		return NULL;
+		Message = "Error converting loaded String to Cache Usage!";
+		return false;
 	}
 
-	UserAvatar = FImageUtils::CreateTexture2DFromImage(LoadedImage);
+	// Usage recorded before loading is more recent
+	LoadedCacheUsage.ModsLastUsed.Append(CacheUsage.ModsLastUsed);
+	CacheUsage = LoadedCacheUsage;
 
-	return UserAvatar;
+	Message = "Cache Usage loaded successfully from File!";
+	return true;
 }
 
-bool UModioAPIObject::ClearCachedAvatarForUser(FModioAPI_User User)
+int64 UModioAPIObject::GetCacheSize()
 {
-	if (User.ID <= 0)
-	{
-		return false;
-	}
+	EnsureCachedModSizesMeasured();
+	return CachedModsBytes;
+}
 
-	// Clear Cached Avatar
-	TArray<FString> Files = TArray<FString>();
-	FString UserDirectory = GetAvatarDirectoryPathForUser(User.ID);
-	IFileManager::Get().FindFiles(Files, *UserDirectory);
+void UModioAPIObject::MeasureCachedModSizes(int32 ModID)
+{
+	TWeakObjectPtr<UModioAPIObject> WeakThis(this);
+	const FString ModsDirectoryPath = GetModsDirectoryPath();
+	const uint32 MeasuredAtRevision = CacheSizeRevision;
 
-	for (FString File : Files)
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, ModsDirectoryPath, ModID, MeasuredAtRevision]()
 	{
-		if (File.Contains("Avatar"))
+		TMap<int32, FModioAPI_CachedModSize> MeasuredSizes = MeasureModDirectories(ModsDirectoryPath, ModID);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, MeasuredSizes = MoveTemp(MeasuredSizes), ModID, MeasuredAtRevision]()
 		{
-			if (IFileManager::Get().Delete(*(UserDirectory + File), true))
+			if (WeakThis.IsValid())
 			{
-				return true;
+				WeakThis->ApplyCachedModSizes(MeasuredSizes, MeasuredAtRevision, ModID);
 			}
-		}
+		});
+	});
+}
+
+void UModioAPIObject::EnsureCachedModSizesMeasured()
+{
+	if (bCachedModSizesMeasured)
+	{
+		return;
 	}
 
-	return false;
+	ApplyCachedModSizes(MeasureModDirectories(GetModsDirectoryPath(), INDEX_NONE), CacheSizeRevision, INDEX_NONE);
 }
 
-bool UModioAPIObject::ClearCachedFileStorageForUser(FModioAPI_User User)
+void UModioAPIObject::ApplyCachedModSizes(const TMap<int32, FModioAPI_CachedModSize>& MeasuredSizes, uint32 MeasuredAtRevision, int32 ModID)
 {
-	if (User.ID <= 0)
+	// Mods changed since the Measurement started keep their Size, the Measurement started with the Change will update it
+	for (auto It = CachedModSizes.CreateIterator(); It; ++It)
 	{
-		return false;
+		if ((ModID == INDEX_NONE || It.Key() == ModID) && It.Value().Revision <= MeasuredAtRevision && !MeasuredSizes.Contains(It.Key()))
+		{
+			CachedModsBytes -= It.Value().Bytes;
+			It.RemoveCurrent();
+		}
 	}
 
-	FString UserDirectory = GetAvatarDirectoryPathForUser(User.ID);
-	if (IFileManager::Get().DeleteDirectory(*UserDirectory, true, true))
+	for (const TPair<int32, FModioAPI_CachedModSize>& MeasuredSize : MeasuredSizes)
 	{
-		return true;
+		const FModioAPI_CachedModSize* CachedModSize = CachedModSizes.Find(MeasuredSize.Key);
+		if (!CachedModSize || CachedModSize->Revision <= MeasuredAtRevision)
+		{
+			SetCachedModSize(MeasuredSize.Key, MeasuredSize.Value.Bytes, MeasuredSize.Value.MediaBytes, MeasuredAtRevision);
+		}
 	}
 
-	return false;
+	if (ModID == INDEX_NONE)
+	{
+		bCachedModSizesMeasured = true;
+	}
 }
 
-bool UModioAPIObject::ClearCachedFileStorageForAllUsers()
+void UModioAPIObject::SetCachedModSize(int32 ModID, int64 Bytes, int64 MediaBytes, uint32 Revision)
 {
-	FString UsersDirectory = GetUsersDirectoryPath();
-	if (IFileManager::Get().DeleteDirectory(*UsersDirectory, true, true))
-	{
-		return true;
-	}
+	FModioAPI_CachedModSize& CachedModSize = CachedModSizes.FindOrAdd(ModID);
+	CachedModsBytes += Bytes - CachedModSize.Bytes;
 
-	return false;
+	CachedModSize.Bytes = Bytes;
+	CachedModSize.MediaBytes = MediaBytes;
+	CachedModSize.Revision = Revision;
 }
 
-bool UModioAPIObject::ClearCachedFileStorageForGuide(FModioAPI_Guide Guide)
+TMap<int32, FModioAPI_CachedModSize> UModioAPIObject::MeasureModDirectories(const FString& ModsDirectoryPath, int32 ModID)
 {
-	if (Guide.ID <= 0)
+	TArray<int32> ModIDs;
+	if (ModID != INDEX_NONE)
 	{
-		return false;
+		ModIDs.Add(ModID);
+	}
+	else
+	{
+		TArray<FString> DirectoryNames;
+		IFileManager::Get().FindFiles(DirectoryNames, *(ModsDirectoryPath + "*"), false, true);
+
+		// The Content Store and other non-numeric Directories don't belong to a Mod
+		for (const FString& DirectoryName : DirectoryNames)
+		{
+			if (DirectoryName.IsNumeric())
+			{
+				ModIDs.Add(FCString::Atoi(*DirectoryName));
+			}
+		}
 	}
 
-	FString GuideDirectory = GetDirectoryPathForGuide(Guide.ID);
-	if (IFileManager::Get().DeleteDirectory(*GuideDirectory, true, true))
+	TMap<int32, FModioAPI_CachedModSize> MeasuredSizes;
+	for (int32 MeasuredModID : ModIDs)
 	{
-		return true;
+		const FString ModDirectory = ModsDirectoryPath + FString::FromInt(MeasuredModID) + "/";
+		if (!FPlatformFileManager::Get().GetPlatformFile().DirectoryExists(*ModDirectory))
+		{
+			continue;
+		}
+
+		FModioAPI_CachedModSize& MeasuredSize = MeasuredSizes.Add(MeasuredModID);
+		MeasuredSize.Bytes = GetDirectorySize(ModDirectory);
+		MeasuredSize.MediaBytes = GetDirectorySize(ModDirectory + "Media/");
 	}
 
-	return false;
+	return MeasuredSizes;
 }
 
-bool UModioAPIObject::ClearCachedFileStorageForAllGuides()
+int64 UModioAPIObject::GetDirectorySize(const FString& DirectoryPath)
 {
-	FString GuidesDirectory = GetGuidesDirectoryPath();
-	if (IFileManager::Get().DeleteDirectory(*GuidesDirectory, true, true))
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.DirectoryExists(*DirectoryPath))
 	{
-		return true;
+		return 0;
 	}
 
-	return false;
-}
-
-bool UModioAPIObject::ClearCachedMediaForMod(FModioAPI_Mod Mod)
-{
-	FString ModsMediaDirectory = GetMediaDirectoryPathForMod(Mod.ID);
-	if (IFileManager::Get().DeleteDirectory(*ModsMediaDirectory, true, true))
+	int64 DirectorySize = 0;
+	PlatformFile.IterateDirectoryStatRecursively(*DirectoryPath, [&DirectorySize](const TCHAR* Path, const FFileStatData& StatData)
 	{
+		if (!StatData.bIsDirectory && StatData.FileSize > 0)
+		{
+			DirectorySize += StatData.FileSize;
+		}
 		return true;
-	}
+	});
 
-	return false;
+	return DirectorySize;
 }
 
-bool UModioAPIObject::ClearCachedModfilesForMod(FModioAPI_Mod Mod)
+bool UModioAPIObject::MoveEvictedDirectory(const FString& DirectoryPath, TArray<FString>& EvictedDirectories)
 {
-	FString ModsModfilesDirectory = GetModfilesDirectoryPathForMod(Mod.ID);
-	if (IFileManager::Get().DeleteDirectory(*ModsModfilesDirectory, true, true))
+	// Renaming is instant, whereas deleting walks the whole Directory
+	const FString EvictedDirectory = GetModsDirectoryPath() + "Evicted_" + FGuid::NewGuid().ToString();
+	if (!FPlatformFileManager::Get().GetPlatformFile().MoveFile(*EvictedDirectory, *FPaths::GetPath(DirectoryPath)))
 	{
-		return true;
+		return false;
 	}
 
-	return false;
+	EvictedDirectories.Add(EvictedDirectory);
+	return true;
 }
 
-bool UModioAPIObject::ClearCachedModfilesForModExcept(FModioAPI_Mod Mod, int32 ExceptedModfileID)
+void UModioAPIObject::DeleteEvictedDirectories(TArray<FString> EvictedDirectories, int64 EvictedBytes)
 {
-	FString ModsModfilesDirectory = GetModfilesDirectoryPathForMod(Mod.ID);
-	TArray<FString> Directories;
+	PendingEvictionBytes += EvictedBytes;
 
-	IFileManager::Get().FindFilesRecursive(Directories, *ModsModfilesDirectory, TEXT("*"), false, true, true);
+	TWeakObjectPtr<UModioAPIObject> WeakThis(this);
+	const FString ModsDirectoryPath = GetModsDirectoryPath();
+	const FString ContentStoreDirectoryPath = GetContentStoreDirectoryPath();
 
-	for (FString Directory : Directories)
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, EvictedDirectories = MoveTemp(EvictedDirectories), EvictedBytes, ModsDirectoryPath, ContentStoreDirectoryPath]()
 	{
-		if (!Directory.EndsWith(FString::FromInt(ExceptedModfileID)))
+		for (const FString& EvictedDirectory : EvictedDirectories)
 		{
-			IFileManager::Get().DeleteDirectory(*Directory, true, true);
+			FPlatformFileManager::Get().GetPlatformFile().DeleteDirectoryRecursively(*EvictedDirectory);
 		}
-	}
 
-	return true;
+		ClearUnreferencedFilesInContentStore(ModsDirectoryPath, ContentStoreDirectoryPath);
+
+		// The freed Space shows up in the free Disk Space from now on
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, EvictedBytes]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->PendingEvictionBytes = FMath::Max<int64>(WeakThis->PendingEvictionBytes - EvictedBytes, 0);
+			}
+		});
+	});
 }
 
-bool UModioAPIObject::ClearCachedFileStorageForMod(FModioAPI_Mod Mod)
+int64 UModioAPIObject::GetReservedCacheSpace()
 {
-	FString ModFileStorageDirectory = GetDirectoryPathForMod(Mod.ID);
-	if (IFileManager::Get().DeleteDirectory(*ModFileStorageDirectory, true, true))
+	int64 ReservedBytes = 0;
+	for (const TPair<int32, int64>& Reservation : CacheReservations)
 	{
-		return true;
+		ReservedBytes += Reservation.Value;
 	}
 
-	return false;
+	return ReservedBytes;
 }
 
-bool UModioAPIObject::ClearCachedFileStorageForAllMods()
+bool UModioAPIObject::GetFreeDiskSpace(int64& FreeDiskSpace)
 {
-	FString ModsFileStorageDirectory = GetModsDirectoryPath();
-	if (IFileManager::Get().DeleteDirectory(*ModsFileStorageDirectory, true, true))
+	uint64 TotalBytes = 0;
+	uint64 FreeBytes = 0;
+	if (!FPlatformMisc::GetDiskTotalAndFreeSpace(FPaths::ConvertRelativePathToFull(GetModsDirectoryPath()), TotalBytes, FreeBytes))
 	{
-		return true;
+		return false;
 	}
 
-	return false;
+	FreeDiskSpace = static_cast<int64>(FreeBytes);
+	return true;
 }
 
-bool UModioAPIObject::ClearPersistingCache()
+/*
+Subscription Sync
+*/
+
+UModioAPISubscriptionSyncObject* UModioAPIObject::GetSubscriptionSync()
 {
-	FString PersistingCacheFilePath = GetPersistingCacheFilePath();
-	if (IFileManager::Get().Delete(*PersistingCacheFilePath, true))
+	if (!SubscriptionSync)
 	{
-		return true;
+		SubscriptionSync = NewObject<UModioAPISubscriptionSyncObject>(this);
+		SubscriptionSync->ModioConnection = this;
 	}
 
-	return false;
+	return SubscriptionSync;
 }
 
 /*
@@ -1256,7 +3512,7 @@ bool UModioAPIObject::RequestTermsOfService(FString& Message)
 	Request->SetURL(GetApiPath() + EndpointAuthenticate + EndpointTerms + GetApiKey());
 	Request->SetVerb("GET");
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Terms of Service'!";
 		return true;
@@ -1339,7 +3595,7 @@ bool UModioAPIObject::RequestEmailSecurityCode(FString Email, FString& Message)
 	Request->AppendToHeader("Accept", "application/json");
 	Request->SetContentAsString("email=" + Email);
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Email Security Code'!";
 		return true;
@@ -1362,7 +3618,7 @@ bool UModioAPIObject::RequestExchangeSecurityCodeForAccessToken(FString Security
 	Request->AppendToHeader("Accept", "application/json");
 	Request->SetContentAsString("security_code=" + SecurityCode);
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Exchange Security Code for Access Token'!";
 		return true;
@@ -1398,7 +3654,7 @@ bool UModioAPIObject::RequestGetGame(FString& Message)
 	Request->AppendToHeader("Content-Type", "application/x-www-form-urlencoded");
 	Request->AppendToHeader("Accept", "application/json");
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Game Info'!";
 		return true;
@@ -1466,7 +3722,7 @@ bool UModioAPIObject::RequestGetMods(FModioAPI_RequestFilters Filters, FModioAPI
 	Request->AppendToHeader("Content-Type", "application/x-www-form-urlencoded");
 	Request->AppendToHeader("Accept", "application/json");
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Mods'!";
 		return true;
@@ -1495,7 +3751,7 @@ bool UModioAPIObject::RequestGetMod(int32 ModID, FString& Message)
 	Request->AppendToHeader("Content-Type", "application/x-www-form-urlencoded");
 	Request->AppendToHeader("Accept", "application/json");
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Mod'!";
 		return true;
@@ -1566,7 +3822,7 @@ bool UModioAPIObject::RequestAddMod(FString AccessToken, FModioAPI_AddMod Mod, F
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Mod'!";
 		return true;
@@ -1637,7 +3893,7 @@ bool UModioAPIObject::RequestEditMod(FString AccessToken, int32 ModID, FModioAPI
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Edit Mod'!";
 		return true;
@@ -1689,7 +3945,7 @@ bool UModioAPIObject::RequestDeleteMod(FString AccessToken, int32 ModID, FString
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Mod'!";
 		return true;
@@ -1724,7 +3980,7 @@ bool UModioAPIObject::RequestGetModfiles(int32 ModID, FString& Message)
 	Request->AppendToHeader("Content-Type", "application/x-www-form-urlencoded");
 	Request->AppendToHeader("Accept", "application/json");
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Modfiles'!";
 		return true;
@@ -1763,7 +4019,7 @@ bool UModioAPIObject::RequestGetModfile(int32 ModID, int32 ModfileID, FString& M
 	Request->AppendToHeader("Content-Type", "application/x-www-form-urlencoded");
 	Request->AppendToHeader("Accept", "application/json");
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Modfiles'!";
 		return true;
@@ -1816,7 +4072,7 @@ bool UModioAPIObject::RequestAddModfile(FString AccessToken, int32 ModID, FModio
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Mod'!";
 		return true;
@@ -1919,7 +4175,7 @@ bool UModioAPIObject::RequestEditModfile(FString AccessToken, int32 ModID, int32
 
 	Request->SetContentAsString(EditModfilePayload);
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Edit Mod'!";
 		return true;
@@ -1976,7 +4232,7 @@ bool UModioAPIObject::RequestDeleteModfile(FString AccessToken, int32 ModID, int
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Delete Modfile'!";
 		return true;
@@ -2087,7 +4343,7 @@ bool UModioAPIObject::RequestManageModfilePlatformStatus(FString AccessToken, in
 
 	Request->SetContentAsString(RequestPayload);
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Delete Modfile'!";
 		return true;
@@ -2136,7 +4392,7 @@ bool UModioAPIObject::RequestGetMultipartUploadParts(FString AccessToken, int32
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Modfiles'!";
 		return true;
@@ -2229,7 +4485,8 @@ bool UModioAPIObject::RequestAddMultipartUploadPart(FString AccessToken, int32 M
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	// Uploading the same Content Range again overwrites the Part, so it's safe to retry
+	if (DispatchRequest(Request, true))
 	{
 		Message = "Successfully processed Request for 'Get Modfiles'!";
 		return true;
@@ -2300,7 +4557,8 @@ bool UModioAPIObject::RequestCreateMultipartUploadSession(FString AccessToken, i
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	// mod.io returns the existing Session for a known Nonce, so only then it's safe to retry
+	if (DispatchRequest(Request, !Nonce.IsEmpty()))
 	{
 		Message = "Successfully processed Request for 'Get Modfiles'!";
 		return true;
@@ -2347,7 +4605,7 @@ bool UModioAPIObject::RequestDeleteMultipartUploadSession(FString AccessToken, i
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Delete Multipart Upload Sessions'!";
 		return true;
@@ -2388,7 +4646,7 @@ bool UModioAPIObject::RequestGetMultipartUploadSessions(FString AccessToken, int
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Multipart Upload Sessions'!";
 		return true;
@@ -2429,7 +4687,7 @@ bool UModioAPIObject::RequestCompleteMultipartUploadSession(FString AccessToken,
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Multipart Upload Sessions'!";
 		return true;
@@ -2485,7 +4743,7 @@ bool UModioAPIObject::RequestSubscribeToMod(FString AccessToken, int32 ModID, bo
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Mod'!";
 		return true;
@@ -2539,7 +4797,7 @@ bool UModioAPIObject::RequestUnsubscribeFromMod(FString AccessToken, int32 ModID
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Mod'!";
 		return true;
@@ -2687,7 +4945,7 @@ bool UModioAPIObject::RequestGetGameTagOptions(FString& Message)
 	Request->AppendToHeader("Content-Type", "application/x-www-form-urlencoded");
 	Request->AppendToHeader("Accept", "application/json");
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Game Tag Options'!";
 		return true;
@@ -2741,7 +4999,7 @@ bool UModioAPIObject::RequestGetModTags(int32 ModID, FString& Message)
 	Request->AppendToHeader("Content-Type", "application/x-www-form-urlencoded");
 	Request->AppendToHeader("Accept", "application/json");
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Game Tag Options'!";
 		return true;
@@ -2801,7 +5059,7 @@ bool UModioAPIObject::RequestAddModTags(FString AccessToken, int32 ModID, TArray
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Game Tag Options'!";
 		return true;
@@ -2869,10 +5127,48 @@ bool UModioAPIObject::RequestDeleteModKVP_Metadata(FString AccessToken, int32 Mo
 
 // Dependencies
 
-bool UModioAPIObject::RequestGetModDependencies(int32 ModID, FString& Message)
+bool UModioAPIObject::RequestGetModDependencies(int32 ModID, FModioAPI_RequestPagination Pagination, FString& Message)
 {
-	Message = "Not yet implemented!";
-	return false;
+	if (!IsInitialized())
+	{
+		Message = "Mod.io not yet initialized!";
+		return false;
+	}
+
+	if (ModID <= 0)
+	{
+		Message = "Mod ID is invalid!";
+		return false;
+	}
+
+	// Without Pagination, mod.io answers with the first Page
+	FString PaginationParameters;
+	if (Pagination.Limit > 0)
+	{
+		PaginationParameters += "&_limit=" + LexToString(Pagination.Limit);
+	}
+	if (Pagination.Offset > 0)
+	{
+		PaginationParameters += "&_offset=" + LexToString(Pagination.Offset);
+	}
+
+	FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
+	Request->OnProcessRequestComplete().BindUObject(this, &UModioAPIObject::GetModDependencies_ResponseReceived);
+	Request->SetURL(GetApiPath() + EndpointGames + "/" + FString::FromInt(ModioGameID) + EndpointMods + "/" + FString::FromInt(ModID) + EndpointDependencies + GetApiKey() + PaginationParameters);
+	Request->SetVerb("GET");
+	Request->AppendToHeader("Content-Type", "application/x-www-form-urlencoded");
+	Request->AppendToHeader("Accept", "application/json");
+
+	if (DispatchRequest(Request))
+	{
+		Message = "Successfully processed Request for 'Get Mod Dependencies'!";
+		return true;
+	}
+	else
+	{
+		Message = "Error when Processing Request for 'Get Mod Dependencies'!";
+		return false;
+	}
 }
 
 bool UModioAPIObject::RequestAddModDependencies(FString AccessToken, int32 ModID, TArray<int32> Dependencies, FString& Message)
@@ -2967,7 +5263,7 @@ bool UModioAPIObject::RequestGetAuthenticatedUser(FString AccessToken, FString&
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Me User Info'!";
 		return true;
@@ -3013,7 +5309,7 @@ bool UModioAPIObject::RequestGetUserEvents(FString AccessToken, FString& Message
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Me User Info'!";
 		return true;
@@ -3059,7 +5355,7 @@ bool UModioAPIObject::RequestGetUserModfiles(FString AccessToken, FString& Messa
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get User Modfiles'!";
 		return true;
@@ -3105,7 +5401,7 @@ bool UModioAPIObject::RequestGetUserGames(FString AccessToken, FString& Message)
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get User Games'!";
 		return true;
@@ -3117,7 +5413,7 @@ bool UModioAPIObject::RequestGetUserGames(FString AccessToken, FString& Message)
 	}
 }
 
-bool UModioAPIObject::RequestGetUserSubscriptions(FString AccessToken, FString& Message)
+bool UModioAPIObject::RequestGetUserSubscriptions(FString AccessToken, FModioAPI_RequestPagination Pagination, FString& Message)
 {
 	if (!IsInitialized())
 	{
@@ -3134,10 +5430,21 @@ bool UModioAPIObject::RequestGetUserSubscriptions(FString AccessToken, FString&
 		}
 	}
 
+	// Without Pagination, mod.io answers with the first Page
+	FString PaginationParameters;
+	if (Pagination.Limit > 0)
+	{
+		PaginationParameters += "&_limit=" + LexToString(Pagination.Limit);
+	}
+	if (Pagination.Offset > 0)
+	{
+		PaginationParameters += "&_offset=" + LexToString(Pagination.Offset);
+	}
+
 	FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
 
 	Request->OnProcessRequestComplete().BindUObject(this, &UModioAPIObject::GetUserSubscriptions_ResponseReceived);
-	Request->SetURL(GetApiPath() + EndpointMe + EndpointSubscribed + GetApiKey());
+	Request->SetURL(GetApiPath() + EndpointMe + EndpointSubscribed + GetApiKey() + PaginationParameters);
 	Request->SetVerb("GET");
 	Request->AppendToHeader("Content-Type", "application/x-www-form-urlencoded");
 	Request->AppendToHeader("Accept", "application/json");
@@ -3151,7 +5458,7 @@ bool UModioAPIObject::RequestGetUserSubscriptions(FString AccessToken, FString&
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get User Subscriptions'!";
 		return true;
@@ -3197,7 +5504,7 @@ bool UModioAPIObject::RequestGetUserMods(FString AccessToken, FString& Message)
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get User Mods'!";
 		return true;
@@ -3243,7 +5550,7 @@ bool UModioAPIObject::RequestGetUserPurchases(FString AccessToken, FString& Mess
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get User Purchases'!";
 		return true;
@@ -3289,7 +5596,7 @@ bool UModioAPIObject::RequestGetUsersMuted(FString AccessToken, FString& Message
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get Users Muted'!";
 		return true;
@@ -3335,7 +5642,7 @@ bool UModioAPIObject::RequestGetUserRatings(FString AccessToken, FString& Messag
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get User Ratings'!";
 		return true;
@@ -3381,7 +5688,7 @@ bool UModioAPIObject::RequestGetUserWallet(FString AccessToken, FString& Message
 		Request->AppendToHeader("Authorization", EndpointAuthenticationBearer + AccessToken);
 	}
 
-	if (Request->ProcessRequest())
+	if (DispatchRequest(Request))
 	{
 		Message = "Successfully processed Request for 'Get User Ratings'!";
 		return true;
@@ -3417,14 +5724,24 @@ Responses
 
 void UModioAPIObject::TermsOfService_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
-	if (!Response.Get())
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_TermsOfService.Broadcast(FModioAPI_Terms(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
+	// Serve the cached Response if it hasn't been modified since
+	FModioAPI_Terms CachedTerms;
+	if (GetNotModifiedResponse(Request, Response, CachedTerms))
 	{
-		OnResponseReceived_TermsOfService.Broadcast(FModioAPI_Terms(), FModioAPI_Error_Object());
+		FString CachingMessage;
+		CacheTermsOfService(CachedTerms, CachingMessage);
+		OnResponseReceived_TermsOfService.Broadcast(CachedTerms, FModioAPI_Error_Object());
+		return;
 	}
 
-	TSharedPtr<FJsonObject> ResponseObj;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
-	FJsonSerializer::Deserialize(Reader, ResponseObj);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
@@ -3433,6 +5750,7 @@ void UModioAPIObject::TermsOfService_ResponseReceived(FHttpRequestPtr Request, F
 	if (ConvertSuccess)
 	{
 		CacheTermsOfService(Terms, ConvertMessage);
+		StoreResponseInCache(Request, Response, Terms);
 		OnResponseReceived_TermsOfService.Broadcast(Terms, FModioAPI_Error_Object());
 	}
 	else
@@ -3492,14 +5810,14 @@ void UModioAPIObject::OpenIDAuthentication_ResponseReceived(FHttpRequestPtr Requ
 
 void UModioAPIObject::EmailSecurityCode_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
-	if (!Response.Get())
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
 	{
+		OnResponseReceived_EmailSecurityCode.Broadcast(FModioAPI_Message_Object(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
 		return;
 	}
 
-	TSharedPtr<FJsonObject> ResponseObj;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
-	FJsonSerializer::Deserialize(Reader, ResponseObj);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
@@ -3526,14 +5844,14 @@ void UModioAPIObject::EmailSecurityCode_ResponseReceived(FHttpRequestPtr Request
 
 void UModioAPIObject::ExchangeForAccessToken_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
-	if (!Response.Get())
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
 	{
+		OnResponseReceived_ExchangeForAccessToken.Broadcast(FModioAPI_AccessToken_Response(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
 		return;
 	}
 
-	TSharedPtr<FJsonObject> ResponseObj;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
-	FJsonSerializer::Deserialize(Reader, ResponseObj);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
@@ -3583,14 +5901,24 @@ void UModioAPIObject::Logout_ResponseReceived(FHttpRequestPtr Request, FHttpResp
 
 void UModioAPIObject::GetGame_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
-	if (!Response.Get())
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetGame.Broadcast(FModioAPI_Game(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
+	// Serve the cached Response if it hasn't been modified since
+	FModioAPI_Game CachedGameInfo;
+	if (GetNotModifiedResponse(Request, Response, CachedGameInfo))
 	{
+		FString CachingMessage;
+		CacheGame(CachedGameInfo, CachingMessage);
+		OnResponseReceived_GetGame.Broadcast(CachedGameInfo, FModioAPI_Error_Object());
 		return;
 	}
 
-	TSharedPtr<FJsonObject> ResponseObj;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
-	FJsonSerializer::Deserialize(Reader, ResponseObj);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
@@ -3599,6 +5927,7 @@ void UModioAPIObject::GetGame_ResponseReceived(FHttpRequestPtr Request, FHttpRes
 	if (ConvertSuccess)
 	{
 		CacheGame(GameInfo, ConvertMessage);
+		StoreResponseInCache(Request, Response, GameInfo);
 		OnResponseReceived_GetGame.Broadcast(GameInfo, FModioAPI_Error_Object());
 	}
 	else
@@ -3647,10 +5976,17 @@ void UModioAPIObject::GetGuidesTags_ResponseReceived(FHttpRequestPtr Request, FH
 void UModioAPIObject::GetMods_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetMods.Broadcast(FModioAPI_GetMods(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -3679,16 +6015,37 @@ void UModioAPIObject::GetMods_ResponseReceived(FHttpRequestPtr Request, FHttpRes
 
 void UModioAPIObject::GetMod_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
+	// Serve the cached Response if it hasn't been modified since
+	FModioAPI_Mod CachedMod;
+	if (GetNotModifiedResponse(Request, Response, CachedMod))
+	{
+		FString CachingMessage;
+		CacheMod(CachedMod, CachingMessage);
+		OnResponseReceived_GetMod.Broadcast(CachedMod, FModioAPI_Error_Object());
+		return;
+	}
+
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Listeners need to know which Mod the Response belongs to, even if it failed
+	FModioAPI_Mod FailedMod;
+	FailedMod.ID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointMods);
+
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetMod.Broadcast(FailedMod, UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
 		FModioAPI_Error_Object ErrorResponse = UModioAPIFunctionLibrary::ConvertJsonObjectToError(ResponseObj, ConvertSuccess, ConvertMessage);
-		OnResponseReceived_GetMod.Broadcast(FModioAPI_Mod(), ErrorResponse);
+		OnResponseReceived_GetMod.Broadcast(FailedMod, ErrorResponse);
 		return;
 	}
 
@@ -3698,21 +6055,29 @@ void UModioAPIObject::GetMod_ResponseReceived(FHttpRequestPtr Request, FHttpResp
 	if (!ConvertSuccess)
 	{
 		FModioAPI_Error_Object ErrorResponse = UModioAPIFunctionLibrary::ConvertJsonObjectToError(ResponseObj, ConvertSuccess, ConvertMessage);
-		OnResponseReceived_GetMod.Broadcast(FModioAPI_Mod(), ErrorResponse);
+		OnResponseReceived_GetMod.Broadcast(FailedMod, ErrorResponse);
 		return;
 	}
 
 	CacheMod(Mod, ConvertMessage);
+	StoreResponseInCache(Request, Response, Mod);
 	OnResponseReceived_GetMod.Broadcast(Mod, FModioAPI_Error_Object());
 }
 
 void UModioAPIObject::AddMod_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_AddMod.Broadcast(FModioAPI_Mod(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 201 for Successful Request
 	if (Response.Get()->GetResponseCode() != 201)
 	{
@@ -3738,10 +6103,17 @@ void UModioAPIObject::AddMod_ResponseReceived(FHttpRequestPtr Request, FHttpResp
 void UModioAPIObject::EditMod_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_EditMod.Broadcast(FModioAPI_Mod(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -3767,12 +6139,19 @@ void UModioAPIObject::EditMod_ResponseReceived(FHttpRequestPtr Request, FHttpRes
 void UModioAPIObject::DeleteMod_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
 	int32 ModID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointMods);
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_DeleteMod.Broadcast(ModID, UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 204 for Successful Request
 	if (Response.Get()->GetResponseCode() != 204)
 	{
@@ -3790,10 +6169,17 @@ void UModioAPIObject::DeleteMod_ResponseReceived(FHttpRequestPtr Request, FHttpR
 void UModioAPIObject::GetModfiles_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetModfiles.Broadcast(FModioAPI_GetModfiles(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -3822,11 +6208,28 @@ void UModioAPIObject::GetModfiles_ResponseReceived(FHttpRequestPtr Request, FHtt
 
 void UModioAPIObject::GetModfile_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
+	// Serve the cached Response if it hasn't been modified since
+	FModioAPI_Modfile CachedModfile;
+	if (GetNotModifiedResponse(Request, Response, CachedModfile))
+	{
+		FString CachingMessage;
+		CacheModfile(CachedModfile, CachingMessage);
+		OnResponseReceived_GetModfile.Broadcast(CachedModfile, FModioAPI_Error_Object());
+		return;
+	}
+
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetModfile.Broadcast(FModioAPI_Modfile(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -3846,16 +6249,24 @@ void UModioAPIObject::GetModfile_ResponseReceived(FHttpRequestPtr Request, FHttp
 	}
 
 	CacheModfile(Modfile, ConvertMessage);
+	StoreResponseInCache(Request, Response, Modfile);
 	OnResponseReceived_GetModfile.Broadcast(Modfile, FModioAPI_Error_Object());
 }
 
 void UModioAPIObject::AddModfile_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_AddModfile.Broadcast(FModioAPI_Modfile(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 201 for Successful Request
 	if (Response.Get()->GetResponseCode() != 201)
 	{
@@ -3881,10 +6292,17 @@ void UModioAPIObject::AddModfile_ResponseReceived(FHttpRequestPtr Request, FHttp
 void UModioAPIObject::EditModfile_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_EditModfile.Broadcast(FModioAPI_Modfile(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -3910,13 +6328,20 @@ void UModioAPIObject::EditModfile_ResponseReceived(FHttpRequestPtr Request, FHtt
 void UModioAPIObject::DeleteModfile_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
 	int32 ModID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointMods);
 	int32 ModfileID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointFiles);
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_DeleteModfile.Broadcast(ModID, ModfileID, UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 204 for Successful Request
 	if (Response.Get()->GetResponseCode() != 204)
 	{
@@ -3932,13 +6357,20 @@ void UModioAPIObject::DeleteModfile_ResponseReceived(FHttpRequestPtr Request, FH
 void UModioAPIObject::ManageModfilePlatformStatus_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
 	int32 ModID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointMods);
 	int32 ModfileID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointFiles);
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_ManageModfilePlatformStatus.Broadcast(FModioAPI_Modfile(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -3966,12 +6398,19 @@ void UModioAPIObject::ManageModfilePlatformStatus_ResponseReceived(FHttpRequestP
 void UModioAPIObject::GetMultipartUploadParts_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
 	int32 ModID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointMods);
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetMultipartUploadParts.Broadcast(FModioAPI_GetMultipartUploadParts(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -3996,12 +6435,19 @@ void UModioAPIObject::GetMultipartUploadParts_ResponseReceived(FHttpRequestPtr R
 void UModioAPIObject::AddMultipartUploadPart_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
 	int32 ModID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointMods);
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_AddMultipartUploadPart.Broadcast(FModioAPI_MultipartUploadPart(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4026,12 +6472,19 @@ void UModioAPIObject::AddMultipartUploadPart_ResponseReceived(FHttpRequestPtr Re
 void UModioAPIObject::CreateMultipartUploadSession_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
 	int32 ModID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointMods);
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_CreateMultipartUploadSession.Broadcast(FModioAPI_MultipartUpload(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4056,12 +6509,19 @@ void UModioAPIObject::CreateMultipartUploadSession_ResponseReceived(FHttpRequest
 void UModioAPIObject::DeleteMultipartUploadSession_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
 	int32 ModID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointMods);
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_DeleteMultipartUploadSession.Broadcast(ModID, UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 204 for Successful Request
 	if (Response.Get()->GetResponseCode() != 204)
 	{
@@ -4076,12 +6536,19 @@ void UModioAPIObject::DeleteMultipartUploadSession_ResponseReceived(FHttpRequest
 void UModioAPIObject::GetMultipartUploadSessions_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
 	int32 ModID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointMods);
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetMultipartUploadSessions.Broadcast(FModioAPI_GetMultipartUploadSessions(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4106,12 +6573,19 @@ void UModioAPIObject::GetMultipartUploadSessions_ResponseReceived(FHttpRequestPt
 void UModioAPIObject::CompleteMultipartUploadSession_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
 	int32 ModID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointMods);
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_CompleteMultipartUploadSession.Broadcast(FModioAPI_MultipartUpload(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4138,10 +6612,17 @@ void UModioAPIObject::CompleteMultipartUploadSession_ResponseReceived(FHttpReque
 void UModioAPIObject::SubscribeToMod_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_SubscribeToMod.Broadcast(FModioAPI_Mod(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 201 for Successful Subscription
 	if (Response.Get()->GetResponseCode() != 201)
 	{
@@ -4167,12 +6648,19 @@ void UModioAPIObject::SubscribeToMod_ResponseReceived(FHttpRequestPtr Request, F
 void UModioAPIObject::UnsubscribeFromMod_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
 	int32 ModID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointMods);
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_UnsubscribeFromMod.Broadcast(ModID, UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 204 for Successful Unsubscription
 	if (Response.Get()->GetResponseCode() != 204)
 	{
@@ -4269,11 +6757,28 @@ void UModioAPIObject::GetModEvents_ResponseReceived(FHttpRequestPtr Request, FHt
 
 void UModioAPIObject::GetGameTagOptions_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
+	// Serve the cached Response if it hasn't been modified since
+	FModioAPI_GetGameTagOptions CachedGameTagOptions;
+	if (GetNotModifiedResponse(Request, Response, CachedGameTagOptions))
+	{
+		FString CachingMessage;
+		CacheGameTagOptions(CachedGameTagOptions, CachingMessage);
+		OnResponseReceived_GetGameTagOptions.Broadcast(CachedGameTagOptions, FModioAPI_Error_Object());
+		return;
+	}
+
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetGameTagOptions.Broadcast(FModioAPI_GetGameTagOptions(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4293,6 +6798,7 @@ void UModioAPIObject::GetGameTagOptions_ResponseReceived(FHttpRequestPtr Request
 	}
 
 	CacheGameTagOptions(GetGameTagOptions, ConvertMessage);
+	StoreResponseInCache(Request, Response, GetGameTagOptions);
 	OnResponseReceived_GetGameTagOptions.Broadcast(GetGameTagOptions, FModioAPI_Error_Object());
 }
 
@@ -4310,11 +6816,26 @@ void UModioAPIObject::RenameGameTag_ResponseReceived(FHttpRequestPtr Request, FH
 
 void UModioAPIObject::GetModTags_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
+	// Serve the cached Response if it hasn't been modified since
+	FModioAPI_GetModTags CachedModTags;
+	if (GetNotModifiedResponse(Request, Response, CachedModTags))
+	{
+		OnResponseReceived_GetModTags.Broadcast(CachedModTags, FModioAPI_Error_Object());
+		return;
+	}
+
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetModTags.Broadcast(FModioAPI_GetModTags(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4334,6 +6855,7 @@ void UModioAPIObject::GetModTags_ResponseReceived(FHttpRequestPtr Request, FHttp
 	}
 
 	//CacheGameTagOptions(GetGameTagOptions, ConvertMessage);
+	StoreResponseInCache(Request, Response, GetModTags);
 	OnResponseReceived_GetModTags.Broadcast(GetModTags, FModioAPI_Error_Object());
 }
 
@@ -4383,6 +6905,52 @@ void UModioAPIObject::DeleteModMetadataKVP_ResponseReceived(FHttpRequestPtr Requ
 
 void UModioAPIObject::GetModDependencies_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
+	// Prepare received Response and Variables
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
+	bool ConvertSuccess = false;
+	FString ConvertMessage = "";
+
+	// Listeners need to know which Mod the Response belongs to, even if it failed
+	FModioAPI_GetModDependencies FailedModDependencies = FModioAPI_GetModDependencies();
+	FailedModDependencies.Mod_ID = UModioAPIFunctionLibrary::ExtractModIDFromRequestURL(Request.Get()->GetURL(), EndpointMods);
+	FailedModDependencies.Result_Offset = UModioAPIFunctionLibrary::ExtractOffsetFromRequestURL(Request.Get()->GetURL());
+
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetModDependencies.Broadcast(FailedModDependencies, UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
+	// Expects Response Code 200 for Successful Request
+	if (Response.Get()->GetResponseCode() != 200)
+	{
+		FModioAPI_Error_Object ErrorResponse = UModioAPIFunctionLibrary::ConvertJsonObjectToError(ResponseObj, ConvertSuccess, ConvertMessage);
+		OnResponseReceived_GetModDependencies.Broadcast(FailedModDependencies, ErrorResponse);
+		return;
+	}
+
+	FModioAPI_GetModDependencies GetModDependencies = UModioAPIFunctionLibrary::ConvertJsonObjectToGetModDependencies(ResponseObj, ConvertSuccess, ConvertMessage);
+
+	// Did we receive what we expected?
+	if (!ConvertSuccess)
+	{
+		FModioAPI_Error_Object ErrorResponse = UModioAPIFunctionLibrary::ConvertJsonObjectToError(ResponseObj, ConvertSuccess, ConvertMessage);
+		OnResponseReceived_GetModDependencies.Broadcast(FailedModDependencies, ErrorResponse);
+		return;
+	}
+
+	GetModDependencies.Mod_ID = FailedModDependencies.Mod_ID;
+
+	for (FModioAPI_ModDependencies ModDependency : GetModDependencies.Data)
+	{
+		if (ModDependency.Modfile.ID > 0)
+		{
+			CacheModfile(ModDependency.Modfile, ConvertMessage);
+		}
+	}
+
+	OnResponseReceived_GetModDependencies.Broadcast(GetModDependencies, FModioAPI_Error_Object());
 }
 
 void UModioAPIObject::AddModDependencies_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
@@ -4430,10 +6998,17 @@ void UModioAPIObject::UnmuteUser_ResponseReceived(FHttpRequestPtr Request, FHttp
 void UModioAPIObject::GetAuthenticatedUser_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetAuthenticatedUser.Broadcast(FModioAPI_User(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4460,10 +7035,17 @@ void UModioAPIObject::GetAuthenticatedUser_ResponseReceived(FHttpRequestPtr Requ
 void UModioAPIObject::GetUserEvents_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetUserEvents.Broadcast(FModioAPI_GetUserEvents(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4494,10 +7076,17 @@ void UModioAPIObject::GetUserEvents_ResponseReceived(FHttpRequestPtr Request, FH
 void UModioAPIObject::GetUserModfiles_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetUserModfiles.Broadcast(FModioAPI_GetModfiles(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4527,10 +7116,17 @@ void UModioAPIObject::GetUserModfiles_ResponseReceived(FHttpRequestPtr Request,
 void UModioAPIObject::GetUserGames_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetUserGames.Broadcast(FModioAPI_GetGames(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4560,15 +7156,26 @@ void UModioAPIObject::GetUserGames_ResponseReceived(FHttpRequestPtr Request, FHt
 void UModioAPIObject::GetUserSubscriptions_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Listeners need to know which Page the Response belongs to, even if it failed
+	FModioAPI_GetMods FailedSubscribedMods = FModioAPI_GetMods();
+	FailedSubscribedMods.Result_Offset = UModioAPIFunctionLibrary::ExtractOffsetFromRequestURL(Request.Get()->GetURL());
+
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetUserSubscriptions.Broadcast(FailedSubscribedMods, UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
 		FModioAPI_Error_Object ErrorResponse = UModioAPIFunctionLibrary::ConvertJsonObjectToError(ResponseObj, ConvertSuccess, ConvertMessage);
-		OnResponseReceived_GetUserSubscriptions.Broadcast(FModioAPI_GetMods(), ErrorResponse);
+		OnResponseReceived_GetUserSubscriptions.Broadcast(FailedSubscribedMods, ErrorResponse);
 		return;
 	}
 
@@ -4578,7 +7185,7 @@ void UModioAPIObject::GetUserSubscriptions_ResponseReceived(FHttpRequestPtr Requ
 	if (!ConvertSuccess)
 	{
 		FModioAPI_Error_Object ErrorResponse = UModioAPIFunctionLibrary::ConvertJsonObjectToError(ResponseObj, ConvertSuccess, ConvertMessage);
-		OnResponseReceived_GetUserSubscriptions.Broadcast(FModioAPI_GetMods(), ErrorResponse);
+		OnResponseReceived_GetUserSubscriptions.Broadcast(FailedSubscribedMods, ErrorResponse);
 		return;
 	}
 
@@ -4587,16 +7194,38 @@ void UModioAPIObject::GetUserSubscriptions_ResponseReceived(FHttpRequestPtr Requ
 		CacheSubscribedMod(Mod, ConvertMessage);
 	}
 
+	// Pages are only merged in Order, Mods on a Page that wasn't received yet mustn't be treated as unsubscribed
+	if (SubscribedMods.Result_Offset == 0)
+	{
+		SubscriptionsMergedUpToOffset = SubscribedMods.Result_Count;
+	}
+	else if (SubscribedMods.Result_Offset == SubscriptionsMergedUpToOffset)
+	{
+		SubscriptionsMergedUpToOffset += SubscribedMods.Result_Count;
+	}
+
+	if (SubscriptionsMergedUpToOffset >= SubscribedMods.Result_Total)
+	{
+		bSubscriptionsCached = true;
+	}
+
 	OnResponseReceived_GetUserSubscriptions.Broadcast(SubscribedMods, FModioAPI_Error_Object());
 }
 
 void UModioAPIObject::GetUserMods_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetUserMods.Broadcast(FModioAPI_GetMods(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4626,10 +7255,17 @@ void UModioAPIObject::GetUserMods_ResponseReceived(FHttpRequestPtr Request, FHtt
 void UModioAPIObject::GetUserPurchases_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetUserPurchases.Broadcast(FModioAPI_GetMods(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4659,10 +7295,17 @@ void UModioAPIObject::GetUserPurchases_ResponseReceived(FHttpRequestPtr Request,
 void UModioAPIObject::GetUsersMuted_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetUsersMuted.Broadcast(FModioAPI_GetMutedUsers(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4692,10 +7335,17 @@ void UModioAPIObject::GetUsersMuted_ResponseReceived(FHttpRequestPtr Request, FH
 void UModioAPIObject::GetUserRatings_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetUserRatings.Broadcast(FModioAPI_GetUserRatings(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -4725,10 +7375,17 @@ void UModioAPIObject::GetUserRatings_ResponseReceived(FHttpRequestPtr Request, F
 void UModioAPIObject::GetUserWallet_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
 {
 	// Prepare received Response and Variables
-	TSharedPtr<FJsonObject> ResponseObj = UModioAPIFunctionLibrary::ConvertResponseToJsonObject(Response);
+	TSharedPtr<FJsonObject> ResponseObj = ParseResponseToJsonObject(Response);
 	bool ConvertSuccess = false;
 	FString ConvertMessage = "";
 
+	// Connection failed or timed out, there is no Response to read
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		OnResponseReceived_GetUserWallet.Broadcast(FModioAPI_Wallet(), UModioAPIFunctionLibrary::MakeConnectionFailedError());
+		return;
+	}
+
 	// Expects Response Code 200 for Successful Request
 	if (Response.Get()->GetResponseCode() != 200)
 	{
@@ -0,0 +1,256 @@
+/*
+Copyright © 2023 Arvur GmbH / Robin Hasenbach.
+Released under GNU AGPLv3 License.
+*/
+
+#include "Objects/ModioAPIPrefetchObject.h"
+#include "ModioAPIObject.h"
+#include "Misc/Paths.h"
+
+bool UModioAPIPrefetchObject::PrefetchAdjacentPage(FModioAPI_RequestFilters Filters, FModioAPI_RequestSorting Sorting, FModioAPI_GetMods VisiblePage, bool ScrollingForward, FString& Message)
+{
+	if (!ModioConnection || !ModioConnection->IsInitialized())
+	{
+		Message = "Mod.io not yet initialized!";
+		return false;
+	}
+
+	const int32 PageSize = VisiblePage.Result_Limit > 0 ? VisiblePage.Result_Limit : VisiblePage.Result_Count;
+	if (PageSize <= 0)
+	{
+		Message = "The visible Page is empty!";
+		return false;
+	}
+
+	// The adjacent Page is requested the same Way the visible one was, only its Offset differs
+	FModioAPI_RequestPagination Pagination;
+	Pagination.Limit = VisiblePage.Result_Limit;
+	Pagination.Offset = ScrollingForward ? VisiblePage.Result_Offset + PageSize : VisiblePage.Result_Offset - PageSize;
+
+	if (Pagination.Offset < 0 || Pagination.Offset >= VisiblePage.Result_Total)
+	{
+		if (!PageTag.IsEmpty())
+		{
+			ModioConnection->CancelPrefetches(PageTag);
+			PageTag.Empty();
+		}
+
+		Message = "There is no Page in Scroll Direction!";
+		return false;
+	}
+
+	const FString Tag = FString::Printf(TEXT("Page:%lld"), Pagination.Offset);
+
+	// The User scrolled past the Page prefetched before
+	if (!PageTag.IsEmpty() && PageTag != Tag)
+	{
+		ModioConnection->CancelPrefetches(PageTag);
+	}
+
+	PageTag = Tag;
+
+	ModioConnection->BeginPrefetch(Tag);
+	const bool bRequested = ModioConnection->RequestGetMods(Filters, Sorting, Pagination, Message);
+	ModioConnection->EndPrefetch();
+
+	return bRequested;
+}
+
+bool UModioAPIPrefetchObject::PrefetchHoveredMod(FModioAPI_Mod Mod, FString& Message)
+{
+	if (!ModioConnection || !ModioConnection->IsInitialized())
+	{
+		Message = "Mod.io not yet initialized!";
+		return false;
+	}
+
+	if (Mod.ID <= 0)
+	{
+		Message = "ModID is invalid!";
+		return false;
+	}
+
+	HoveredModIDs.Remove(Mod.ID);
+	HoveredModIDs.Add(Mod.ID);
+
+	// Mods hovered long ago are unlikely to be opened
+	while (HoveredModIDs.Num() > MaxHoveredMods)
+	{
+		CancelModPrefetches(HoveredModIDs[0]);
+	}
+
+	FString RequestMessage;
+	bool bRequested = true;
+
+	ModioConnection->BeginPrefetch(GetModTag(Mod.ID));
+	bRequested &= ModioConnection->RequestGetMod(Mod.ID, RequestMessage);
+	bRequested &= ModioConnection->RequestGetModfiles(Mod.ID, RequestMessage);
+	bRequested &= ModioConnection->RequestGetModDependencies(Mod.ID, FModioAPI_RequestPagination(), RequestMessage);
+	bRequested &= ModioConnection->RequestGetModStats(Mod.ID, RequestMessage);
+	ModioConnection->EndPrefetch();
+
+	PrefetchLogo(Mod);
+
+	if (!bRequested)
+	{
+		Message = "Not every Request of the Mod could be prefetched! " + RequestMessage;
+		return false;
+	}
+
+	Message = "Prefetching Mod!";
+	return true;
+}
+
+void UModioAPIPrefetchObject::CancelModPrefetches(int32 ModID)
+{
+	HoveredModIDs.Remove(ModID);
+
+	if (ModioConnection)
+	{
+		ModioConnection->CancelPrefetches(GetModTag(ModID));
+	}
+
+	QueuedLogos.RemoveAll([ModID](const TPair<int32, FModioAPI_Logo_Object>& QueuedLogo) { return QueuedLogo.Key == ModID; });
+
+	UFileToStorageDownloader* LogoDownload;
+	if (LogoDownloads.RemoveAndCopyValue(ModID, LogoDownload) && LogoDownload)
+	{
+		LogoDownload->CancelDownload();
+		LogosCancelled++;
+	}
+}
+
+void UModioAPIPrefetchObject::CancelAllPrefetches()
+{
+	if (ModioConnection)
+	{
+		ModioConnection->CancelPrefetches("");
+	}
+
+	QueuedLogos.Empty();
+
+	TMap<int32, UFileToStorageDownloader*> CancelledLogoDownloads = MoveTemp(LogoDownloads);
+	LogoDownloads.Empty();
+
+	for (const TPair<int32, UFileToStorageDownloader*>& LogoDownload : CancelledLogoDownloads)
+	{
+		if (LogoDownload.Value)
+		{
+			LogoDownload.Value->CancelDownload();
+			LogosCancelled++;
+		}
+	}
+
+	HoveredModIDs.Empty();
+	PageTag.Empty();
+}
+
+void UModioAPIPrefetchObject::SetMaxHoveredMods(int32 MaxMods)
+{
+	MaxHoveredMods = FMath::Max(1, MaxMods);
+
+	while (HoveredModIDs.Num() > MaxHoveredMods)
+	{
+		CancelModPrefetches(HoveredModIDs[0]);
+	}
+}
+
+FModioAPI_PrefetchStats UModioAPIPrefetchObject::GetPrefetchStats()
+{
+	FModioAPI_PrefetchStats Stats;
+
+	if (ModioConnection)
+	{
+		Stats = ModioConnection->GetPrefetchStats();
+	}
+
+	Stats.LogosPrefetched = LogosPrefetched;
+	Stats.LogosCancelled = LogosCancelled;
+
+	return Stats;
+}
+
+void UModioAPIPrefetchObject::ResetPrefetchStats()
+{
+	if (ModioConnection)
+	{
+		ModioConnection->ResetPrefetchStats();
+	}
+
+	LogosPrefetched = 0;
+	LogosCancelled = 0;
+}
+
+FString UModioAPIPrefetchObject::GetModTag(int32 ModID)
+{
+	return "Mod:" + FString::FromInt(ModID);
+}
+
+void UModioAPIPrefetchObject::PrefetchLogo(const FModioAPI_Mod& Mod)
+{
+	if (Mod.Logo.Original.IsEmpty() || LogoDownloads.Contains(Mod.ID) || QueuedLogos.ContainsByPredicate([&Mod](const TPair<int32, FModioAPI_Logo_Object>& QueuedLogo) { return QueuedLogo.Key == Mod.ID; }))
+	{
+		return;
+	}
+
+	// Logos wait behind the prefetched Requests like them, for a Prefetch Slot of the Connection
+	QueuedLogos.Add(TPair<int32, FModioAPI_Logo_Object>(Mod.ID, Mod.Logo));
+	ModioConnection->SchedulePrefetchQueue();
+}
+
+void UModioAPIPrefetchObject::ProcessLogoQueue()
+{
+	while (QueuedLogos.Num() > 0 && ModioConnection && ModioConnection->AcquirePrefetchSlot())
+	{
+		const TPair<int32, FModioAPI_Logo_Object> QueuedLogo = QueuedLogos[0];
+		QueuedLogos.RemoveAt(0);
+
+		StartLogoDownload(QueuedLogo.Key, QueuedLogo.Value);
+	}
+}
+
+bool UModioAPIPrefetchObject::HasQueuedLogos()
+{
+	return QueuedLogos.Num() > 0;
+}
+
+void UModioAPIPrefetchObject::StartLogoDownload(int32 ModID, const FModioAPI_Logo_Object& Logo)
+{
+	// Same Path the Logo is downloaded to when it is shown
+	FString LogoFilePath = ModioConnection->GetMediaDirectoryPathForMod(ModID) + "Logo" + FPaths::GetExtension(Logo.Filename, true);
+	if (FPaths::FileExists(LogoFilePath))
+	{
+		ModioConnection->ReleasePrefetchSlot();
+		return;
+	}
+
+	// A Prefetch isn't worth failing other Downloads for, it is dropped if the Cache has no Space for it
+	FString ReserveMessage;
+	if (!ModioConnection->ReserveCacheSpace(ModID, LogoCacheReservationBytes, ReserveMessage))
+	{
+		ModioConnection->ReleasePrefetchSlot();
+		return;
+	}
+
+	FOnDownloadProgressNative OnProgress;
+	FOnFileToStorageDownloadCompleteNative OnCompleted;
+	OnCompleted.BindUObject(this, &UModioAPIPrefetchObject::LogoDownloadCompleted, ModID);
+
+	UFileToStorageDownloader* LogoDownload = UFileToStorageDownloader::DownloadFileToStorage(Logo.Original, LogoFilePath, 0, "", false, OnProgress, OnCompleted);
+	if (LogoDownload)
+	{
+		LogoDownloads.Add(ModID, LogoDownload);
+		LogosPrefetched++;
+	}
+}
+
+void UModioAPIPrefetchObject::LogoDownloadCompleted(EDownloadToStorageResult Result, int32 ModID)
+{
+	LogoDownloads.Remove(ModID);
+
+	if (ModioConnection)
+	{
+		ModioConnection->ReleaseCacheSpace(ModID, LogoCacheReservationBytes);
+		ModioConnection->ReleasePrefetchSlot();
+	}
+}
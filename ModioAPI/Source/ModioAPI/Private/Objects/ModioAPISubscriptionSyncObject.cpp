@@ -0,0 +1,817 @@
+/*
+Copyright © 2023 Arvur GmbH / Robin Hasenbach.
+Released under GNU AGPLv3 License.
+*/
+
+#include "Objects/ModioAPISubscriptionSyncObject.h"
+#include "ModioAPIObject.h"
+#include "AsyncActions/InstallModfile.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+bool UModioAPISubscriptionSyncObject::StartSync(FString AccessToken, TEnumAsByte<EModioAPI_Platforms> Platform, FString& Message)
+{
+	if (!ModioConnection || !ModioConnection->IsInitialized())
+	{
+		Message = "Mod.io not yet initialized!";
+		return false;
+	}
+
+	if (bSyncing)
+	{
+		Message = "Subscription Sync is already running!";
+		return false;
+	}
+
+	FString LoadMessage;
+	LoadSyncStateFromFile(LoadMessage);
+
+	// Installations interrupted by a Restart start over, failed ones get another Chance
+	for (FModioAPI_SyncQueueEntry& Entry : SyncState.Queue)
+	{
+		Entry.State = EModioAPI_SyncEntryState::SyncEntryState_Queued;
+		Entry.Attempts = 0;
+	}
+
+	SyncAccessToken = AccessToken;
+	SyncPlatform = Platform;
+	SyncProgress = FModioAPI_SyncProgress();
+	PendingDependencyRequests.Empty();
+	PendingDependencyMods.Empty();
+	UnresolvableDependencies.Empty();
+	BytesReceivedPerMod.Empty();
+	SubscribedModIDs.Empty();
+	NextSubscriptionsOffset = 0;
+	NumOfInstalled = 0;
+	InstalledBytes = 0;
+
+	ModioConnection->OnResponseReceived_GetUserSubscriptions.AddUniqueDynamic(this, &UModioAPISubscriptionSyncObject::SubscriptionsReceived);
+	ModioConnection->OnResponseReceived_GetModDependencies.AddUniqueDynamic(this, &UModioAPISubscriptionSyncObject::DependenciesReceived);
+	ModioConnection->OnResponseReceived_GetMod.AddUniqueDynamic(this, &UModioAPISubscriptionSyncObject::DependencyModReceived);
+
+	bSyncing = true;
+	bAwaitingSubscriptions = true;
+
+	FString RequestMessage;
+	if (!ModioConnection->RequestGetUserSubscriptions(SyncAccessToken, FModioAPI_RequestPagination(), RequestMessage))
+	{
+		bAwaitingSubscriptions = false;
+		Message = "Subscriptions couldn't be requested, installing the remaining Queue! " + RequestMessage;
+		ScheduleInstalls();
+		return true;
+	}
+
+	Message = "Subscription Sync started!";
+	return true;
+}
+
+void UModioAPISubscriptionSyncObject::CancelSync()
+{
+	if (!bSyncing)
+	{
+		return;
+	}
+
+	bSyncing = false;
+	bAwaitingSubscriptions = false;
+	StopListening();
+
+	// The cancelled Installations must not report back to a later Sync
+	TArray<UAsyncAction_InstallModfile*> CancelledInstalls = RunningInstalls;
+	RunningInstalls.Empty();
+
+	for (UAsyncAction_InstallModfile* Install : CancelledInstalls)
+	{
+		Install->Progress.RemoveAll(this);
+		Install->Completed.RemoveAll(this);
+		Install->Error.RemoveAll(this);
+		Install->Cancel();
+	}
+
+	for (FModioAPI_SyncQueueEntry& Entry : SyncState.Queue)
+	{
+		if (Entry.State == EModioAPI_SyncEntryState::SyncEntryState_Installing)
+		{
+			Entry.State = EModioAPI_SyncEntryState::SyncEntryState_Queued;
+		}
+	}
+
+	PendingDependencyRequests.Empty();
+	PendingDependencyMods.Empty();
+	BytesReceivedPerMod.Empty();
+
+	FString SaveMessage;
+	SaveSyncStateToFile(SaveMessage);
+}
+
+bool UModioAPISubscriptionSyncObject::IsSyncing()
+{
+	return bSyncing;
+}
+
+FModioAPI_SyncProgress UModioAPISubscriptionSyncObject::GetSyncProgress()
+{
+	return SyncProgress;
+}
+
+FModioAPI_SyncState UModioAPISubscriptionSyncObject::GetSyncState()
+{
+	return SyncState;
+}
+
+bool UModioAPISubscriptionSyncObject::IsModfileInstalled(int32 ModID, int32 ModfileID)
+{
+	const int32* InstalledModfileID = SyncState.InstalledModfiles.Find(ModID);
+	if (!InstalledModfileID || *InstalledModfileID != ModfileID)
+	{
+		return false;
+	}
+
+	// The Modfile may have been deleted from Disk since, its Manifest only exists while it is installed completely
+	return ModioConnection && FPaths::FileExists(ModioConnection->GetManifestFilePathForModfile(ModID, ModfileID));
+}
+
+bool UModioAPISubscriptionSyncObject::IsModRequired(int32 ModID)
+{
+	// The State of a previous Session is known without starting a Sync
+	if (!bSyncStateLoaded)
+	{
+		FString LoadMessage;
+		LoadSyncStateFromFile(LoadMessage);
+	}
+
+	return SyncState.InstalledModfiles.Contains(ModID) || FindQueueEntry(ModID) != nullptr;
+}
+
+void UModioAPISubscriptionSyncObject::SetMaxConcurrentInstalls(int32 MaxInstalls)
+{
+	MaxConcurrentInstalls = FMath::Max(MaxInstalls, 1);
+	ScheduleInstalls();
+}
+
+void UModioAPISubscriptionSyncObject::SubscriptionsReceived(FModioAPI_GetMods SubscribedMods, FModioAPI_Error_Object ErrorResponse)
+{
+	if (!bSyncing || !bAwaitingSubscriptions)
+	{
+		return;
+	}
+
+	// Pages requested by other Callers are ignored, Errors included
+	if (SubscribedMods.Result_Offset != NextSubscriptionsOffset)
+	{
+		return;
+	}
+
+	// Without Subscriptions, the Queue left over from the last Sync is installed
+	if (!ErrorResponse.Error.Message.IsEmpty())
+	{
+		bAwaitingSubscriptions = false;
+		ScheduleInstalls();
+		return;
+	}
+
+	for (FModioAPI_Mod Mod : SubscribedMods.Data)
+	{
+		SubscribedModIDs.Add(Mod.ID);
+		EnqueueModfile(Mod.ID, GetLiveModfile(Mod), Mod.Dependencies);
+	}
+
+	// Mods on Pages not received yet would count as unsubscribed
+	NextSubscriptionsOffset = SubscribedMods.Result_Offset + SubscribedMods.Result_Count;
+	if (NextSubscriptionsOffset < SubscribedMods.Result_Total)
+	{
+		FModioAPI_RequestPagination Pagination;
+		Pagination.Limit = SubscribedMods.Result_Limit;
+		Pagination.Offset = NextSubscriptionsOffset;
+
+		FString RequestMessage;
+		if (SubscribedMods.Result_Count > 0 && ModioConnection->RequestGetUserSubscriptions(SyncAccessToken, Pagination, RequestMessage))
+		{
+			return;
+		}
+
+		// The Subscriptions are incomplete, nothing is removed until the next Sync
+		bAwaitingSubscriptions = false;
+
+		FString SaveMessage;
+		SaveSyncStateToFile(SaveMessage);
+
+		ScheduleInstalls();
+		return;
+	}
+
+	bAwaitingSubscriptions = false;
+	RemoveUnsubscribedMods();
+
+	FString SaveMessage;
+	SaveSyncStateToFile(SaveMessage);
+
+	ScheduleInstalls();
+}
+
+void UModioAPISubscriptionSyncObject::RemoveUnsubscribedMods()
+{
+	TSet<int32> RequiredModIDs = SubscribedModIDs;
+
+	// Dependencies of subscribed Mods stay required, whether they are queued or installed already
+	bool bAddedRequiredMod = true;
+	while (bAddedRequiredMod)
+	{
+		bAddedRequiredMod = false;
+		for (const FModioAPI_SyncQueueEntry& Entry : SyncState.Queue)
+		{
+			if (!RequiredModIDs.Contains(Entry.Mod_ID))
+			{
+				continue;
+			}
+
+			for (int32 DependencyModID : Entry.DependsOn)
+			{
+				if (!RequiredModIDs.Contains(DependencyModID))
+				{
+					RequiredModIDs.Add(DependencyModID);
+					bAddedRequiredMod = true;
+				}
+			}
+		}
+
+		for (const TPair<int32, FModioAPI_SyncDependencies>& Dependencies : SyncState.InstalledDependencies)
+		{
+			if (!RequiredModIDs.Contains(Dependencies.Key))
+			{
+				continue;
+			}
+
+			for (int32 DependencyModID : Dependencies.Value.Mod_IDs)
+			{
+				if (!RequiredModIDs.Contains(DependencyModID))
+				{
+					RequiredModIDs.Add(DependencyModID);
+					bAddedRequiredMod = true;
+				}
+			}
+		}
+	}
+
+	SyncState.Queue.RemoveAll([&RequiredModIDs](const FModioAPI_SyncQueueEntry& Entry)
+	{
+		return !RequiredModIDs.Contains(Entry.Mod_ID);
+	});
+
+	// Unsubscribed Mods are no longer required and may be evicted from the Cache
+	for (auto It = SyncState.InstalledModfiles.CreateIterator(); It; ++It)
+	{
+		if (!RequiredModIDs.Contains(It.Key()))
+		{
+			SyncState.InstalledDependencies.Remove(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UModioAPISubscriptionSyncObject::DependenciesReceived(FModioAPI_GetModDependencies ModDependencies, FModioAPI_Error_Object ErrorResponse)
+{
+	// Responses to Requests of other Callers are ignored, including other Pages of the same Mod
+	const int32* PendingOffset = PendingDependencyRequests.Find(ModDependencies.Mod_ID);
+	if (!bSyncing || !PendingOffset || *PendingOffset != ModDependencies.Result_Offset)
+	{
+		return;
+	}
+
+	PendingDependencyRequests.Remove(ModDependencies.Mod_ID);
+
+	FModioAPI_SyncQueueEntry* Entry = FindQueueEntry(ModDependencies.Mod_ID);
+	if (!Entry)
+	{
+		ScheduleInstalls();
+		return;
+	}
+
+	if (!ErrorResponse.Error.Message.IsEmpty())
+	{
+		UnresolvableDependencies.Add(ModDependencies.Mod_ID);
+		ScheduleInstalls();
+		return;
+	}
+
+	// The first Page replaces the Dependencies known from the last Sync, the following ones add to them
+	if (ModDependencies.Result_Offset == 0)
+	{
+		Entry->DependsOn.Empty();
+	}
+
+	for (const FModioAPI_ModDependencies& Dependency : ModDependencies.Data)
+	{
+		if (Dependency.Mod_ID != ModDependencies.Mod_ID)
+		{
+			Entry->DependsOn.AddUnique(Dependency.Mod_ID);
+		}
+	}
+
+	// The Mod waits for Dependencies on Pages not received yet
+	const int32 NextDependenciesOffset = ModDependencies.Result_Offset + ModDependencies.Result_Count;
+	const bool bHasNextPage = NextDependenciesOffset < ModDependencies.Result_Total && ModDependencies.Result_Count > 0;
+	Entry->bDependenciesResolved = !bHasNextPage;
+
+	if (bHasNextPage)
+	{
+		FModioAPI_RequestPagination Pagination;
+		Pagination.Limit = ModDependencies.Result_Limit;
+		Pagination.Offset = NextDependenciesOffset;
+
+		FString RequestMessage;
+		PendingDependencyRequests.Add(ModDependencies.Mod_ID, NextDependenciesOffset);
+		if (!ModioConnection->RequestGetModDependencies(ModDependencies.Mod_ID, Pagination, RequestMessage))
+		{
+			// The Mod is installed with the Dependencies known so far
+			PendingDependencyRequests.Remove(ModDependencies.Mod_ID);
+			UnresolvableDependencies.Add(ModDependencies.Mod_ID);
+		}
+	}
+
+	// The Modfile listed with the Dependency is its primary one, the Mod is requested to find its live Modfile for the Platform of the Sync
+	for (const FModioAPI_ModDependencies& Dependency : ModDependencies.Data)
+	{
+		if (Dependency.Mod_ID == ModDependencies.Mod_ID || PendingDependencyMods.Contains(Dependency.Mod_ID))
+		{
+			continue;
+		}
+
+		FString RequestMessage;
+		PendingDependencyMods.Add(Dependency.Mod_ID, Dependency.Modfile);
+		if (!ModioConnection->RequestGetMod(Dependency.Mod_ID, RequestMessage))
+		{
+			PendingDependencyMods.Remove(Dependency.Mod_ID);
+			EnqueueModfile(Dependency.Mod_ID, Dependency.Modfile, true);
+		}
+	}
+
+	FString SaveMessage;
+	SaveSyncStateToFile(SaveMessage);
+
+	ScheduleInstalls();
+}
+
+void UModioAPISubscriptionSyncObject::DependencyModReceived(FModioAPI_Mod Mod, FModioAPI_Error_Object ErrorResponse)
+{
+	// Responses to Requests of other Callers are ignored
+	FModioAPI_Modfile PrimaryModfile;
+	if (!bSyncing || !PendingDependencyMods.RemoveAndCopyValue(Mod.ID, PrimaryModfile))
+	{
+		return;
+	}
+
+	// Without the Mod, the primary Modfile is the best Guess
+	if (ErrorResponse.Error.Message.IsEmpty())
+	{
+		EnqueueModfile(Mod.ID, GetLiveModfile(Mod), Mod.Dependencies);
+	}
+	else
+	{
+		EnqueueModfile(Mod.ID, PrimaryModfile, true);
+	}
+
+	FString SaveMessage;
+	SaveSyncStateToFile(SaveMessage);
+
+	ScheduleInstalls();
+}
+
+void UModioAPISubscriptionSyncObject::InstallProgress(FModioAPI_DownloadModfileMessage Message)
+{
+	if (Message.ProgressInfo.BytesReceived < 0)
+	{
+		return;
+	}
+
+	BytesReceivedPerMod.Add(Message.Modfile.Mod_ID, Message.ProgressInfo.BytesReceived);
+	UpdateProgress();
+}
+
+void UModioAPISubscriptionSyncObject::InstallFinished(FModioAPI_DownloadModfileMessage Message)
+{
+	RunningInstalls.RemoveAll([&Message](const UAsyncAction_InstallModfile* Install)
+	{
+		return Install->Modfile.ID == Message.Modfile.ID;
+	});
+
+	const int32 ModID = Message.Modfile.Mod_ID;
+	BytesReceivedPerMod.Remove(ModID);
+
+	FModioAPI_SyncQueueEntry* Entry = FindQueueEntry(ModID);
+	if (!bSyncing || !Entry || Entry->Modfile.ID != Message.Modfile.ID)
+	{
+		ScheduleInstalls();
+		return;
+	}
+
+	if (Message.Result == EModioAPI_DownloadResult::DownloadResult_CompletedSuccessfully)
+	{
+		SyncState.InstalledModfiles.Add(ModID, Message.Modfile.ID);
+
+		// The Queue Entry is removed, but the Dependencies must stay required as long as the Mod is
+		if (Entry->DependsOn.Num() > 0)
+		{
+			SyncState.InstalledDependencies.Add(ModID).Mod_IDs = Entry->DependsOn;
+		}
+		else
+		{
+			SyncState.InstalledDependencies.Remove(ModID);
+		}
+		SyncState.Queue.RemoveAll([ModID](const FModioAPI_SyncQueueEntry& QueueEntry)
+		{
+			return QueueEntry.Mod_ID == ModID;
+		});
+
+		NumOfInstalled++;
+		InstalledBytes += Message.Modfile.Filesize;
+
+		// Only the installed Modfile is kept
+		FModioAPI_Mod Mod;
+		Mod.ID = ModID;
+		ModioConnection->ClearCachedModfilesForModExcept(Mod, Message.Modfile.ID);
+
+		OnModInstalled.Broadcast(Message);
+	}
+	else
+	{
+		// Retrying can't free any Space, the Entry is queued again by the next Sync
+		Entry->Attempts++;
+		if (Entry->Attempts < MaxInstallAttempts && Message.Result != EModioAPI_DownloadResult::DownloadResult_InsufficientSpace)
+		{
+			Entry->State = EModioAPI_SyncEntryState::SyncEntryState_Queued;
+		}
+		else
+		{
+			Entry->State = EModioAPI_SyncEntryState::SyncEntryState_Failed;
+			OnModFailed.Broadcast(Message);
+		}
+	}
+
+	FString SaveMessage;
+	SaveSyncStateToFile(SaveMessage);
+
+	UpdateProgress();
+	ScheduleInstalls();
+}
+
+bool UModioAPISubscriptionSyncObject::EnqueueModfile(int32 ModID, const FModioAPI_Modfile& Modfile, bool bHasDependencies)
+{
+	// There is no Modfile to install
+	if (ModID <= 0 || Modfile.ID <= 0)
+	{
+		return false;
+	}
+
+	if (IsModfileInstalled(ModID, Modfile.ID))
+	{
+		return false;
+	}
+
+	if (FModioAPI_SyncQueueEntry* Entry = FindQueueEntry(ModID))
+	{
+		// A newer Modfile was released since the Mod was queued
+		if (Entry->Modfile.ID != Modfile.ID && Entry->State != EModioAPI_SyncEntryState::SyncEntryState_Installing)
+		{
+			Entry->Modfile = Modfile;
+			Entry->State = EModioAPI_SyncEntryState::SyncEntryState_Queued;
+			Entry->Attempts = 0;
+		}
+		return true;
+	}
+
+	FModioAPI_SyncQueueEntry NewEntry;
+	NewEntry.Mod_ID = ModID;
+	NewEntry.Modfile = Modfile;
+	NewEntry.bDependenciesResolved = !bHasDependencies;
+	SyncState.Queue.Add(NewEntry);
+	return true;
+}
+
+FModioAPI_Modfile UModioAPISubscriptionSyncObject::GetLiveModfile(const FModioAPI_Mod& Mod)
+{
+	FModioAPI_Modfile LiveModfile;
+	FString CacheMessage;
+	if (!ModioConnection->GetCachedActiveModfileForPlatform(Mod, SyncPlatform, LiveModfile, CacheMessage))
+	{
+		LiveModfile = Mod.Modfile;
+	}
+
+	return LiveModfile;
+}
+
+FModioAPI_SyncQueueEntry* UModioAPISubscriptionSyncObject::FindQueueEntry(int32 ModID)
+{
+	return SyncState.Queue.FindByPredicate([ModID](const FModioAPI_SyncQueueEntry& Entry)
+	{
+		return Entry.Mod_ID == ModID;
+	});
+}
+
+int32 UModioAPISubscriptionSyncObject::GetNumOfUnmetDependencies(const FModioAPI_SyncQueueEntry& Entry)
+{
+	int32 NumOfUnmetDependencies = 0;
+
+	for (int32 DependencyModID : Entry.DependsOn)
+	{
+		// Dependencies whose Mod is still requested aren't queued yet
+		const FModioAPI_SyncQueueEntry* DependencyEntry = FindQueueEntry(DependencyModID);
+		if ((DependencyEntry && DependencyEntry->State != EModioAPI_SyncEntryState::SyncEntryState_Failed) || PendingDependencyMods.Contains(DependencyModID))
+		{
+			NumOfUnmetDependencies++;
+		}
+	}
+
+	return NumOfUnmetDependencies;
+}
+
+void UModioAPISubscriptionSyncObject::RequestDependencies()
+{
+	// Collected first, as a failing Request could modify the Queue
+	TArray<int32> UnresolvedModIDs;
+	for (const FModioAPI_SyncQueueEntry& Entry : SyncState.Queue)
+	{
+		if (!Entry.bDependenciesResolved && Entry.State == EModioAPI_SyncEntryState::SyncEntryState_Queued && !PendingDependencyRequests.Contains(Entry.Mod_ID) && !UnresolvableDependencies.Contains(Entry.Mod_ID))
+		{
+			UnresolvedModIDs.Add(Entry.Mod_ID);
+		}
+	}
+
+	for (int32 ModID : UnresolvedModIDs)
+	{
+		FString RequestMessage;
+		PendingDependencyRequests.Add(ModID, 0);
+		if (!ModioConnection->RequestGetModDependencies(ModID, FModioAPI_RequestPagination(), RequestMessage))
+		{
+			PendingDependencyRequests.Remove(ModID);
+			UnresolvableDependencies.Add(ModID);
+		}
+	}
+}
+
+void UModioAPISubscriptionSyncObject::FailDependents()
+{
+	bool bFailedEntry = true;
+	while (bFailedEntry)
+	{
+		bFailedEntry = false;
+		for (FModioAPI_SyncQueueEntry& Entry : SyncState.Queue)
+		{
+			if (Entry.State != EModioAPI_SyncEntryState::SyncEntryState_Queued)
+			{
+				continue;
+			}
+
+			for (int32 DependencyModID : Entry.DependsOn)
+			{
+				const FModioAPI_SyncQueueEntry* DependencyEntry = FindQueueEntry(DependencyModID);
+				if (DependencyEntry && DependencyEntry->State == EModioAPI_SyncEntryState::SyncEntryState_Failed)
+				{
+					Entry.State = EModioAPI_SyncEntryState::SyncEntryState_Failed;
+					bFailedEntry = true;
+
+					FModioAPI_DownloadModfileMessage FailedMessage;
+					FailedMessage.Modfile = Entry.Modfile;
+					FailedMessage.ErrorMessage = "Dependency with Mod ID " + FString::FromInt(DependencyModID) + " failed to install!";
+					FailedMessage.Result = EModioAPI_DownloadResult::DownloadResult_CompletedFailed;
+					OnModFailed.Broadcast(FailedMessage);
+					break;
+				}
+			}
+		}
+	}
+}
+
+void UModioAPISubscriptionSyncObject::ScheduleInstalls()
+{
+	// Installations failing right away report back while they are started
+	if (!bSyncing || bScheduling)
+	{
+		return;
+	}
+
+	TGuardValue<bool> SchedulingGuard(bScheduling, true);
+
+	RequestDependencies();
+	FailDependents();
+
+	auto IsResolved = [this](const FModioAPI_SyncQueueEntry& Entry)
+	{
+		return Entry.State == EModioAPI_SyncEntryState::SyncEntryState_Queued && (Entry.bDependenciesResolved || UnresolvableDependencies.Contains(Entry.Mod_ID));
+	};
+
+	// Kahn's Algorithm: Mods are installed once none of their Dependencies are left in the Queue
+	while (RunningInstalls.Num() < MaxConcurrentInstalls)
+	{
+		const FModioAPI_SyncQueueEntry* ReadyEntry = SyncState.Queue.FindByPredicate([this, &IsResolved](const FModioAPI_SyncQueueEntry& Entry)
+		{
+			return IsResolved(Entry) && GetNumOfUnmetDependencies(Entry) == 0;
+		});
+
+		if (!ReadyEntry)
+		{
+			break;
+		}
+
+		StartInstall(ReadyEntry->Mod_ID);
+		FailDependents();
+	}
+
+	if (RunningInstalls.Num() > 0 || PendingDependencyRequests.Num() > 0 || PendingDependencyMods.Num() > 0 || bAwaitingSubscriptions)
+	{
+		UpdateProgress();
+		return;
+	}
+
+	// Nothing is running, but Mods are left: their Dependencies form a Cycle, which is broken up at the Mod with the fewest unmet Dependencies
+	int32 CycleModID = 0;
+	int32 FewestUnmetDependencies = MAX_int32;
+	for (const FModioAPI_SyncQueueEntry& Entry : SyncState.Queue)
+	{
+		if (IsResolved(Entry) && GetNumOfUnmetDependencies(Entry) < FewestUnmetDependencies)
+		{
+			CycleModID = Entry.Mod_ID;
+			FewestUnmetDependencies = GetNumOfUnmetDependencies(Entry);
+		}
+	}
+
+	if (CycleModID > 0)
+	{
+		StartInstall(CycleModID);
+	}
+
+	if (RunningInstalls.Num() > 0)
+	{
+		UpdateProgress();
+		return;
+	}
+
+	FinishSync();
+}
+
+void UModioAPISubscriptionSyncObject::StartInstall(int32 ModID)
+{
+	FModioAPI_SyncQueueEntry* Entry = FindQueueEntry(ModID);
+	if (!Entry)
+	{
+		return;
+	}
+
+	Entry->State = EModioAPI_SyncEntryState::SyncEntryState_Installing;
+
+	// Not registered with a Game Instance, the Sync keeps the Installation alive
+	UAsyncAction_InstallModfile* Install = NewObject<UAsyncAction_InstallModfile>(this);
+	Install->ModioConnection = ModioConnection;
+	Install->AccessToken = SyncAccessToken;
+	Install->Modfile = Entry->Modfile;
+
+	Install->Progress.AddDynamic(this, &UModioAPISubscriptionSyncObject::InstallProgress);
+	Install->Completed.AddDynamic(this, &UModioAPISubscriptionSyncObject::InstallFinished);
+	Install->Error.AddDynamic(this, &UModioAPISubscriptionSyncObject::InstallFinished);
+
+	RunningInstalls.Add(Install);
+	Install->Activate();
+}
+
+void UModioAPISubscriptionSyncObject::StopListening()
+{
+	if (ModioConnection)
+	{
+		ModioConnection->OnResponseReceived_GetUserSubscriptions.RemoveDynamic(this, &UModioAPISubscriptionSyncObject::SubscriptionsReceived);
+		ModioConnection->OnResponseReceived_GetModDependencies.RemoveDynamic(this, &UModioAPISubscriptionSyncObject::DependenciesReceived);
+		ModioConnection->OnResponseReceived_GetMod.RemoveDynamic(this, &UModioAPISubscriptionSyncObject::DependencyModReceived);
+	}
+}
+
+void UModioAPISubscriptionSyncObject::FinishSync()
+{
+	bSyncing = false;
+	StopListening();
+
+	FString SaveMessage;
+	SaveSyncStateToFile(SaveMessage);
+
+	UpdateProgress();
+	OnSyncCompleted.Broadcast(SyncProgress, SyncProgress.NumOfFailed == 0);
+}
+
+void UModioAPISubscriptionSyncObject::UpdateProgress()
+{
+	SyncProgress.NumOfMods = SyncState.Queue.Num() + NumOfInstalled;
+	SyncProgress.NumOfInstalled = NumOfInstalled;
+	SyncProgress.NumOfFailed = 0;
+	SyncProgress.BytesReceived = InstalledBytes;
+	SyncProgress.BytesTotal = InstalledBytes;
+
+	for (const FModioAPI_SyncQueueEntry& Entry : SyncState.Queue)
+	{
+		if (Entry.State == EModioAPI_SyncEntryState::SyncEntryState_Failed)
+		{
+			SyncProgress.NumOfFailed++;
+		}
+		SyncProgress.BytesTotal += Entry.Modfile.Filesize;
+	}
+
+	for (const TPair<int32, int64>& BytesReceived : BytesReceivedPerMod)
+	{
+		SyncProgress.BytesReceived += BytesReceived.Value;
+	}
+
+	if (SyncProgress.BytesTotal > 0)
+	{
+		SyncProgress.Progress = FMath::Clamp(static_cast<float>(static_cast<double>(SyncProgress.BytesReceived) / SyncProgress.BytesTotal), 0.0f, 1.0f);
+	}
+	else
+	{
+		SyncProgress.Progress = SyncProgress.NumOfMods > 0 ? static_cast<float>(SyncProgress.NumOfInstalled + SyncProgress.NumOfFailed) / SyncProgress.NumOfMods : 1.0f;
+	}
+
+	OnSyncProgress.Broadcast(SyncProgress);
+}
+
+FString UModioAPISubscriptionSyncObject::GetSyncStateFilePath()
+{
+	return ModioConnection->GetModioGameDirectory() + "SubscriptionSync.json";
+}
+
+bool UModioAPISubscriptionSyncObject::SaveSyncStateToFile(FString& Message)
+{
+	if (!ModioConnection || !ModioConnection->IsInitialized())
+	{
+		Message = "Mod.io not yet initialized!";
+		return false;
+	}
+
+	// Convert Sync State Struct to JSON Object
+	TSharedPtr<FJsonObject> JsonObject = FJsonObjectConverter::UStructToJsonObject(SyncState);
+	if (!JsonObject)
+	{
+		Message = "Error converting Subscription Sync State to JSON Object!";
+		return false;
+	}
+
+	// Serialize JSON Object to String
+	FString JsonString;
+	if (!FJsonSerializer::Serialize(JsonObject.ToSharedRef(), TJsonWriterFactory<>::Create(&JsonString, 0)))
+	{
+		Message = "Error serializing Subscription Sync State JSON Object!";
+		return false;
+	}
+
+	// Write String to File
+	if (!FFileHelper::SaveStringToFile(JsonString, *GetSyncStateFilePath()))
+	{
+		Message = "Error writing Subscription Sync State File!";
+		return false;
+	}
+
+	Message = "Subscription Sync State saved successfully to File!";
+	return true;
+}
+
+bool UModioAPISubscriptionSyncObject::LoadSyncStateFromFile(FString& Message)
+{
+	if (!ModioConnection || !ModioConnection->IsInitialized())
+	{
+		Message = "Mod.io not yet initialized!";
+		return false;
+	}
+
+	bSyncStateLoaded = true;
+
+	// Check if File exists
+	FString FilePath = GetSyncStateFilePath();
+	if (!FPaths::FileExists(FilePath))
+	{
+		Message = "Subscription Sync State file doesn't exist!";
+		return false;
+	}
+
+	// Read File to String
+	FString FileLoadedToString;
+	if (!FFileHelper::LoadFileToString(FileLoadedToString, *FilePath))
+	{
+		Message = "Error reading Subscription Sync State file to String!";
+		return false;
+	}
+
+	// Convert String to JSON Object
+	TSharedPtr<FJsonObject> JsonObject;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(FileLoadedToString), JsonObject) || !JsonObject)
+	{
+		Message = "Error converting loaded String to JSON Object!";
+		return false;
+	}
+
+	// Convert JSON Object to Struct
+	FModioAPI_SyncState LoadedSyncState;
+	if (!FJsonObjectConverter::JsonObjectToUStruct<FModioAPI_SyncState>(JsonObject.ToSharedRef(), &LoadedSyncState))
+	{
+		Message = "Error converting loaded JSON Object to Subscription Sync State!";
+		return false;
+	}
+
+	SyncState = LoadedSyncState;
+	Message = "Subscription Sync State loaded successfully from File!";
+	return true;
+}
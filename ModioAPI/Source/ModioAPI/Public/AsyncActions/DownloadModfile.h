@@ -34,6 +34,9 @@ protected:
 	UFUNCTION()
 	void DownloadCompleted(EDownloadToStorageResult DownloadResult);
 
+	// Bytes reserved in the Cache for the Zip-Archive until the Download is completed
+	int64 ReservedCacheBytes = 0;
+
 public:
 
 	/** Execute the actual Action */
@@ -0,0 +1,140 @@
+/*
+Copyright © 2023 Arvur GmbH / Robin Hasenbach.
+Released under GNU AGPLv3 License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "ModioAPIObject.h"
+#include "FileToStorageDownloader.h"
+#include "ArchiverZip/RuntimeArchiverZipCentralDirectory.h"
+#include "DownloadModfileUpdate.generated.h"
+
+class FRuntimeChunkDownloader;
+class FModioAPI_ModfileRebuild;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FModioAPI_OnDownloadModfileUpdate, FModioAPI_DownloadModfileUpdateMessage, Message);
+
+/**
+ * Range of the new Zip-Archive that is either copied from the previous Zip-Archive or downloaded
+ */
+struct FModioAPI_ModfileSegment
+{
+	int64 Offset = 0;
+	int64 Size = 0;
+
+	// Offset in the previous Zip-Archive the Segment is copied from, INDEX_NONE if it is downloaded
+	int64 SourceOffset = INDEX_NONE;
+
+	// Zip-Entries starting in the Segment
+	int32 NumOfEntries = 0;
+
+	bool IsReused() const { return SourceOffset != INDEX_NONE; }
+};
+
+/**
+ * Downloads the new Modfile of a Mod whose previous Modfile is in the Cache, transferring only the Parts of the Zip-Archive that changed.
+ * The Central Directories of both Zip-Archives are compared, unchanged Entries are copied from the previous Zip-Archive and only the others are requested as Ranges.
+ * The rebuilt Zip-Archive is verified against the MD5 of the Modfile. It is downloaded in full if it doesn't match or the previous Zip-Archive can't be used.
+ */
+UCLASS()
+class MODIOAPI_API UAsyncAction_DownloadModfileUpdate : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+protected:
+	void DownloadStarted();
+
+	void DownloadProgress(int64 DownloadBytesReceived, int64 DownloadBytesTotal);
+
+	void DownloadCompleted(EModioAPI_DownloadResult DownloadResult, const FString& Message);
+
+	// Requests the End of the new Zip-Archive containing its Central Directory, in front of the already received End
+	void RequestCentralDirectory(int64 TailSize);
+
+	void CentralDirectoryReceived(EDownloadToMemoryResult Result, TArray64<uint8>&& Data);
+
+	// Copies or downloads the next Segment of the new Zip-Archive
+	void RebuildNextSegment();
+
+	void SegmentRebuilt(int64 SegmentSize, bool bReused, bool bSuccess, const FString& Message);
+
+	// Writes the End of the Zip-Archive, verifies it and moves it into place
+	void FinishRebuild();
+
+	void StartFullDownload(const FString& Reason);
+
+	void FullDownloadProgress(int64 DownloadBytesReceived, int64 DownloadBytesTotal, float DownloadProgressRatio);
+
+	void FullDownloadCompleted(EDownloadToStorageResult DownloadResult);
+
+	FString GetChunkURL() const;
+
+	TSharedPtr<FRuntimeChunkDownloader> ChunkDownloader;
+	TSharedPtr<FModioAPI_ModfileRebuild, ESPMode::ThreadSafe> Rebuild;
+	UFileToStorageDownloader* Downloader = nullptr;
+
+	FOnDownloadProgressNative OnFullDownloadProgress;
+	FOnFileToStorageDownloadCompleteNative OnFullDownloadCompleted;
+
+	FString FileDownloadURL;
+	FString FileDownloadPath;
+	FString PreviousFilePath;
+	int64 ContentSize = 0;
+
+	// Bytes reserved in the Cache for the new Zip-Archive until the Download is completed, it is written in full either way
+	int64 ReservedCacheBytes = 0;
+
+	FRuntimeArchiverZipCentralDirectory PreviousCentralDirectory;
+	FRuntimeArchiverZipCentralDirectory CentralDirectory;
+
+	// End of the new Zip-Archive, received while reading its Central Directory
+	TArray64<uint8> TailData;
+	int32 NumOfCentralDirectoryRequests = 0;
+
+	TArray<FModioAPI_ModfileSegment> Segments;
+	int32 NextSegmentIndex = 0;
+	int64 RebuiltBytes = 0;
+
+	// Why the Zip-Archive is downloaded in full
+	FString FullDownloadReason;
+	int64 FullDownloadBytesReceived = 0;
+
+	bool bCancelled = false;
+
+public:
+
+	/** Execute the actual Action */
+	virtual void Activate() override;
+
+	/** Cancels the Download, 'Completed' is broadcast as cancelled once it has stopped */
+	UFUNCTION(BlueprintCallable, Category = "mod.io API|Async Actions")
+	void Cancel();
+
+	/** Used for the creation of the Async Action Blueprint Node */
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Download Modfile Update to Cache",BlueprintInternalUseOnly = "true", Category = "mod.io API|Async Actions", WorldContext = "WorldContextObject", AdvancedDisplay = "AccessToken"))
+	static UAsyncAction_DownloadModfileUpdate* AsyncActionDownloadModfileUpdate(UObject* WorldContextObject, UModioAPIObject* ModioConnection, FString AccessToken, FModioAPI_Modfile PreviousModfile, FModioAPI_Modfile Modfile);
+
+	UPROPERTY(BlueprintAssignable)
+	FModioAPI_OnDownloadModfileUpdate Error;
+
+	UPROPERTY(BlueprintAssignable)
+	FModioAPI_OnDownloadModfileUpdate Started;
+
+	UPROPERTY(BlueprintAssignable)
+	FModioAPI_OnDownloadModfileUpdate Progress;
+
+	UPROPERTY(BlueprintAssignable)
+	FModioAPI_OnDownloadModfileUpdate Completed;
+
+	UModioAPIObject* ModioConnection;
+	FString AccessToken;
+
+	// Modfile of the same Mod whose Zip-Archive is in the Cache
+	FModioAPI_Modfile PreviousModfile;
+	FModioAPI_Modfile Modfile;
+
+	FModioAPI_DownloadModfileUpdateMessage DownloadMessage;
+};
@@ -0,0 +1,75 @@
+/*
+Copyright © 2023 Arvur GmbH / Robin Hasenbach.
+Released under GNU AGPLv3 License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "ModioAPIObject.h"
+#include "InstallModfile.generated.h"
+
+class FRuntimeChunkDownloader;
+class FModioAPI_InstallModfilePipeline;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FModioAPI_OnInstallModfile, FModioAPI_DownloadModfileMessage, Message);
+
+/**
+ * Downloads a Modfile and extracts its Zip-Archive while it is still being downloaded.
+ * Each downloaded range is extracted in the background while the next one is downloaded, and the Zip-Archive itself is never stored.
+ * Extracted Files are kept once in the Content Store and hardlinked into the Modfile Directory, Files unchanged since a previously installed Modfile aren't extracted again.
+ * Installed Files may be shared with other Modfiles and must not be modified in place.
+ */
+UCLASS()
+class MODIOAPI_API UAsyncAction_InstallModfile : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+protected:
+	void DownloadStarted();
+
+	void DownloadProgress(int64 DownloadBytesReceived, int64 DownloadBytesTotal);
+
+	void InstallCompleted(bool bSuccess, const FString& Message);
+
+	TSharedPtr<FRuntimeChunkDownloader> ChunkDownloader;
+	TSharedPtr<FModioAPI_InstallModfilePipeline, ESPMode::ThreadSafe> InstallPipeline;
+
+	// Bytes reserved in the Cache for the extracted Files until the Installation is completed
+	int64 ReservedCacheBytes = 0;
+
+public:
+
+	/** Execute the actual Action */
+	virtual void Activate() override;
+
+	/** Cancels the Download, 'Completed' is broadcast as failed once the Extraction has stopped */
+	UFUNCTION(BlueprintCallable, Category = "mod.io API|Async Actions")
+	void Cancel();
+
+	/** Used for the creation of the Async Action Blueprint Node */
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Download and Install Modfile",BlueprintInternalUseOnly = "true", Category = "mod.io API|Async Actions", WorldContext = "WorldContextObject", AdvancedDisplay = "AccessToken,InstallDirectory"))
+	static UAsyncAction_InstallModfile* AsyncActionInstallModfile(UObject* WorldContextObject, UModioAPIObject* ModioConnection, FString AccessToken, FModioAPI_Modfile Modfile, FString InstallDirectory);
+	
+	UPROPERTY(BlueprintAssignable)
+	FModioAPI_OnInstallModfile Error;
+
+	UPROPERTY(BlueprintAssignable)
+	FModioAPI_OnInstallModfile Started;
+
+	UPROPERTY(BlueprintAssignable)
+	FModioAPI_OnInstallModfile Progress;
+
+	UPROPERTY(BlueprintAssignable)
+	FModioAPI_OnInstallModfile Completed;
+
+	UModioAPIObject* ModioConnection;
+	FString AccessToken;
+	FModioAPI_Modfile Modfile;
+
+	// Directory the Modfile is extracted to. The Cache-Directory of the Modfile is used if empty
+	FString InstallDirectory;
+
+	FModioAPI_DownloadModfileMessage DownloadMessage;
+};
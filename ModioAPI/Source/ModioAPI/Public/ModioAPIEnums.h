@@ -195,6 +195,7 @@ enum EModioAPI_DownloadResult
 	DownloadResult_Paused						UMETA(DisplayName = "Paused"),
 	DownloadResult_Cancelled					UMETA(DisplayName = "Cancelled"),
 	DownloadResult_CompletedFailed				UMETA(DisplayName = "Failed"),
+	DownloadResult_InsufficientSpace			UMETA(DisplayName = "Insufficient Space"),
 };
 
 /*
@@ -222,4 +223,20 @@ enum EModioAPI_CacheTimeFilterMode
 	CacheTimeFilterMode_Later			UMETA(DisplayName = "Later Only"),
 	CacheTimeFilterMode_SameOrBefore	UMETA(DisplayName = "Same or Before"),
 	CacheTimeFilterMode_BeforeOnly		UMETA(DisplayName = "Before Only"),
+};
+
+UENUM(BlueprintType, DisplayName = "mod.io Request Class", Category = "mod.io API|Requests", meta = (Tooltip = "Decides if and how a Request is retried"))
+enum EModioAPI_RequestClass
+{
+	RequestClass_Read				UMETA(DisplayName = "Read (GET)"),
+	RequestClass_IdempotentWrite	UMETA(DisplayName = "Idempotent Write (Multipart Upload Parts, Sessions with Nonce)"),
+	RequestClass_Write				UMETA(DisplayName = "Write (never retried)"),
+};
+
+UENUM(BlueprintType, DisplayName = "mod.io Subscription Sync Entry State", Category = "mod.io API|Subscription Sync", meta = (Tooltip = "State of a Mod in the Subscription Sync Queue"))
+enum EModioAPI_SyncEntryState
+{
+	SyncEntryState_Queued		UMETA(DisplayName = "Queued"),
+	SyncEntryState_Installing	UMETA(DisplayName = "Installing"),
+	SyncEntryState_Failed		UMETA(DisplayName = "Failed"),
 };
\ No newline at end of file
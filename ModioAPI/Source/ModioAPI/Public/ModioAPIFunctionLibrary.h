@@ -24,6 +24,7 @@ class MODIOAPI_API UModioAPIFunctionLibrary : public UBlueprintFunctionLibrary
 	
 public:
 	static FModioAPI_Error_Object ConvertJsonObjectToError(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message);
+	static FModioAPI_Error_Object MakeConnectionFailedError();
 	static FModioAPI_Message_Object ConvertJsonObjectToMessage(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message);
 	static FModioAPI_Terms ConvertJsonObjectToTermsOfService(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message);
 	static FModioAPI_AccessToken_Response ConvertJsonObjectToAccessToken(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message);
@@ -42,6 +43,7 @@ public:
 	static TArray<uint8> CreateBoundaryForZipArchive(FString Key, FString ArchiveName, TArray<uint8> ZipArchiveData, FString BoundaryLabel);
 	static FModioAPI_GetUserEvents ConvertJsonObjectToGetUserEvents(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message);
 	static FModioAPI_GetModfiles ConvertJsonObjectToGetModfiles(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message);
+	static FModioAPI_GetModDependencies ConvertJsonObjectToGetModDependencies(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message);
 	static FModioAPI_GetMultipartUploadParts ConvertJsonObjectToGetMultipartUploadParts(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message);
 	static FModioAPI_GetMultipartUploadSessions ConvertJsonObjectToGetMultipartUploadSessions(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message);
 	static FModioAPI_GetMutedUsers ConvertJsonObjectToGetMutedUsers(TSharedPtr<FJsonObject> JsonObject, bool& Success, FString& Message);
@@ -63,6 +65,7 @@ public:
 	static FModioAPI_UserEvent ConvertUserEventObjectToUserEvent(FModioAPI_UserEvent_Object UserEventObject);
 	static FModioAPI_GetUserEvents ConvertGetUserEventsSchemaToGetUserEvents(FModioAPI_GetUserEvents_Schema GetUserEventsSchema);
 	static FModioAPI_GetModfiles ConvertGetModfilesSchemaToGetModfiles(FModioAPI_GetModfiles_Schema GetUserModfilesSchema);
+	static FModioAPI_GetModDependencies ConvertGetModDependenciesSchemaToGetModDependencies(FModioAPI_GetModDependencies_Schema GetModDependenciesSchema);
 	static FModioAPI_MultipartUploadPart ConvertMultipartUploadPartObjectToMultipartUploadPart(FModioAPI_MultipartUploadPart_Object MultipartUploadPartObject);
 	static FModioAPI_GetMultipartUploadParts ConvertGetMultipartUploadPartsSchemaToGetMultipartUploadParts(FModioAPI_GetMultipartUploadParts_Schema GetMultipartUploadPartsSchema);
 	static FModioAPI_GetMultipartUploadSessions ConvertGetMultipartUploadSessionsSchemaToGetMultipartUploadSessions(FModioAPI_GetMultipartUploadSessions_Schema GetMultipartUploadSessionsSchema);
@@ -75,6 +78,7 @@ public:
 	static FModioAPI_Wallet ConvertWalletObjectToWallet(FModioAPI_Wallet_Object WalletObject);
 	static FModioAPI_MultipartUpload ConvertMultipartUploadObjectToMultipartUpload(FModioAPI_MultipartUpload_Object MultipartUploadObject);
 	static int32 ExtractModIDFromRequestURL(FString RequestURL, FString EndpointMods);
+	static int32 ExtractOffsetFromRequestURL(FString RequestURL);
 	static FModioAPI_ModStats ConvertModStatsObjectToModStats(FModioAPI_ModStats_Object ModstatsObject);
 	static FModioAPI_ModTag ConvertModTagObjectToModTag(FModioAPI_ModTag_Object ModTagObject);
 	static TArray<FModioAPI_ModTag> ConvertModTagObjectsToModTags(TArray<FModioAPI_ModTag_Object> ModTagObjects);
@@ -11,9 +11,14 @@ Released under GNU AGPLv3 License.
 #include "Blueprint/UserWidget.h"
 #include "Http.h"
 #include "JsonObjectConverter.h"
+#include "UObject/StructOnScope.h"
+#include "Containers/Ticker.h"
 #include "ModioAPIFunctionLibrary.h"
 #include "ModioAPIObject.generated.h"
 
+class UModioAPISubscriptionSyncObject;
+class UModioAPIPrefetchObject;
+
 // Authentication
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FModioAPI_GetTermsOfServiceDelegate, FModioAPI_Terms, TermsOfService, FModioAPI_Error_Object, ErrorResponse);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FModioAPI_SteamAuthenticationDelegate, FModioAPI_AccessToken_Response, AccessToken, FModioAPI_Error_Object, ErrorResponse);
@@ -153,6 +158,101 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FModioAPI_GetResourceOwnerDelegate,
 // Checkout
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FModioAPI_PurchaseAnItemDelegate, FModioAPI_Pay_Object, Payment, FModioAPI_Error_Object, ErrorResponse);
 
+// Platform Times in Seconds of the current Attempt, filled in while the Request is on its way
+struct FModioAPI_RequestTiming
+{
+	double QueuedAt = 0.0;
+	double SentAt = 0.0;
+	double FirstByteAt = 0.0;
+
+	// Connection of the Pool the Attempt is sent over, and whether it was probably still open
+	int32 ConnectionIndex = INDEX_NONE;
+	bool EstimatedReuse = false;
+
+	// Set if the HTTP Module refused to send the queued Attempt
+	bool ProcessFailed = false;
+};
+
+// A speculative GET Request whose Response is kept for the next Caller dispatching the identical Request
+struct FModioAPI_PrefetchedRequest
+{
+	FHttpRequestPtr Request;
+
+	// Relevance the Prefetch was issued for, e.g. a Page or a hovered Mod
+	FString Tag;
+
+	bool Sent = false;
+
+	// Set once the Response arrived, until then Callers wait for it
+	FHttpResponsePtr Response;
+	double ReceivedAt = 0.0;
+
+	// Request of the first Caller dispatched while the Prefetch was in flight, later Callers are coalesced with it
+	FHttpRequestPtr WaitingRequest;
+
+	// Decoded Response the Validators were sent for, served on '304 Not Modified' even if the Response Cache dropped it meanwhile
+	TSharedPtr<FStructOnScope> NotModifiedResponse;
+
+	TSharedPtr<FModioAPI_RequestTiming> Timing;
+};
+
+// Size of a cached Mod Directory, kept up to Date instead of walking the Directory whenever Cache Space is reserved
+struct FModioAPI_CachedModSize
+{
+	int64 Bytes = 0;
+	int64 MediaBytes = 0;
+
+	// Cache Size Revision of the last Change, Measurements started before it don't overwrite the Size
+	uint32 Revision = 0;
+};
+
+// A Connection to the mod.io API Host as far as it can be told from the Requests sent over it
+struct FModioAPI_ApiConnection
+{
+	bool Busy = false;
+
+	// Platform Time in Seconds the last Response was received at, 0 if the Connection is closed
+	double LastUsedAt = 0.0;
+
+	FModioAPI_ConnectionStats Stats;
+};
+
+// A Request waiting for Rate Limit Budget or for its Retry
+struct FModioAPI_QueuedRequest
+{
+	FHttpRequestRef Request;
+
+	// Platform Time in Seconds the Request may be sent at
+	double NotBefore;
+
+	TSharedPtr<FModioAPI_RequestTiming> Timing;
+};
+
+// State carried along a dispatched Request across its Attempts
+struct FModioAPI_DispatchedRequest
+{
+	// Key of an in-flight GET Request other Callers may attach to, empty for other Verbs
+	FString RequestKey;
+
+	// The Response Handler the Request was created with
+	FHttpRequestCompleteDelegate ResponseHandler;
+
+	TEnumAsByte<EModioAPI_RequestClass> RequestClass = RequestClass_Write;
+
+	int32 Attempt = 0;
+
+	// Platform Time in Seconds of the first Attempt
+	double FirstSentAt = 0.0;
+
+	// Verb and Path the Metrics are recorded for
+	FString EndpointName;
+
+	TSharedPtr<FModioAPI_RequestTiming> Timing;
+
+	// Decoded Response the Validators were sent for, served on '304 Not Modified' even if the Response Cache dropped it meanwhile
+	TSharedPtr<FStructOnScope> NotModifiedResponse;
+};
+
 /**
  * 
  */
@@ -231,6 +331,85 @@ class MODIOAPI_API UModioAPIObject : public UObject
 		UPROPERTY()
 		FModioAPI_PersistingCache PersistingCache;
 
+		// Identical GET Requests currently in flight, mapped to the number of Callers attached to them
+		TMap<FString, int32> InFlightRequests;
+
+		UPROPERTY()
+		FModioAPI_ResponseCache ResponseCache;
+
+		// Token Bucket limiting the Requests sent to mod.io, refilled continuously
+		float RequestBudget = 60.0f;
+		float RequestBudgetCapacity = 60.0f;
+		float RequestBudgetRefillPerSecond = 1.0f;
+		double RequestBudgetLastRefill = 0.0;
+
+		// Platform Time in Seconds mod.io accepts Requests again after answering '429 Too Many Requests'
+		double RateLimitedUntil = 0.0;
+		int32 RateLimitedResponses = 0;
+
+		UPROPERTY()
+		int32 MaxRateLimitRetries = 5;
+
+		UPROPERTY()
+		float RetryBackoffBaseSeconds = 1.0f;
+
+		UPROPERTY()
+		float RetryBackoffMaxSeconds = 60.0f;
+
+		TArray<FModioAPI_QueuedRequest> RequestQueue;
+		FTSTicker::FDelegateHandle RequestQueueTickerHandle;
+
+		// Retry Policies overriding the Defaults of their Request Class
+		TMap<TEnumAsByte<EModioAPI_RequestClass>, FModioAPI_RetryPolicy> RetryPolicies;
+
+		UPROPERTY()
+		FModioAPI_RequestMetrics RequestMetrics;
+
+		// Endpoint whose Response Handler is currently running and the Time it spent parsing so far
+		FString HandledEndpointName;
+		double HandledEndpointParseSeconds = 0.0;
+
+		// Key = Request URL | Value = Response decoded to its Struct, served again on '304 Not Modified'
+		TMap<FString, TSharedPtr<FStructOnScope>> DecodedResponses;
+
+		// Key = Request URL | Value = Decoded Response pinned for the Response Handler currently running, in case it was evicted while the Request was in flight
+		TMap<FString, TSharedPtr<FStructOnScope>> PinnedResponses;
+
+		int32 MaxResponseCacheEntries = 512;
+
+		// Changes to the Response Cache are saved to File at most once per Delay
+		float ResponseCacheSaveDelaySeconds = 5.0f;
+		bool bResponseCacheDirty = false;
+		FTSTicker::FDelegateHandle ResponseCacheSaveTickerHandle;
+
+		UPROPERTY()
+		FModioAPI_ConnectionPolicy ConnectionPolicy;
+
+		TArray<FModioAPI_ApiConnection> ApiConnections;
+
+		UPROPERTY()
+		FModioAPI_ConnectionPoolStats ConnectionPoolStats;
+
+		// Key = In-Flight Request Key | Value = Prefetch queued, in flight or waiting for its Caller
+		TMap<FString, FModioAPI_PrefetchedRequest> Prefetches;
+
+		// Keys of the Prefetches not sent yet, oldest first
+		TArray<FString> PrefetchQueue;
+		int32 PrefetchesInFlight = 0;
+
+		// Tag of the Prefetch the Requests are currently dispatched for, empty for regular Requests
+		FString DispatchingPrefetchTag;
+
+		int32 MaxConcurrentPrefetches = 2;
+
+		// Share of the Rate Limit Budget that is left to regular Requests
+		float PrefetchBudgetReserve = 0.25f;
+
+		float PrefetchLifetimeSeconds = 30.0f;
+
+		UPROPERTY()
+		FModioAPI_PrefetchStats PrefetchStats;
+
 	public:
 		UFUNCTION()
 		FModioAPI_AccessToken GetPersistingCacheAccessToken();
@@ -597,6 +776,252 @@ class MODIOAPI_API UModioAPIObject : public UObject
 		UFUNCTION()
 		bool LoadPersistingCacheFromFile(FString& Message);
 
+	public:
+		/*
+		Request Dispatching
+		*/
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API", meta = (DisplayName = "Get In-Flight Request Count"))
+		int32 GetInFlightRequestCount();
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Rate Limit", meta = (DisplayName = "Get Rate Limit Status"))
+		FModioAPI_RateLimitStatus GetRateLimitStatus();
+
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Rate Limit", meta = (DisplayName = "Configure Rate Limit", Tooltip = "Gets overridden by the Limit mod.io reports in its Responses!"))
+		void ConfigureRateLimit(int32 RequestsPerMinute, int32 MaxRetries, float BackoffBaseSeconds, float BackoffMaxSeconds);
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Requests", meta = (DisplayName = "Get Retry Policy"))
+		FModioAPI_RetryPolicy GetRetryPolicy(TEnumAsByte<EModioAPI_RequestClass> RequestClass);
+
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Requests", meta = (DisplayName = "Set Retry Policy", Tooltip = "Non idempotent Writes are never retried, only their Timeout applies!"))
+		void SetRetryPolicy(TEnumAsByte<EModioAPI_RequestClass> RequestClass, FModioAPI_RetryPolicy RetryPolicy);
+
+		virtual void BeginDestroy() override;
+
+		/*
+		Request Metrics
+		*/
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Metrics", meta = (DisplayName = "Get Request Metrics"))
+		FModioAPI_RequestMetrics GetRequestMetrics();
+
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Metrics", meta = (DisplayName = "Reset Request Metrics"))
+		void ResetRequestMetrics();
+
+		/*
+		Connections
+		*/
+
+		/*
+		Caps the Connections to the mod.io API Host and decides if they are kept open
+		The HTTP Module keeps its own Connection Limits per Host, they are left to the Project. To match the Cap set '[HTTP] HttpMaxConnectionsPerServer' and '[HTTP.Curl] MaxHostConnections' in DefaultEngine.ini
+		*/
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Connections", meta = (DisplayName = "Set Connection Policy"))
+		void SetConnectionPolicy(FModioAPI_ConnectionPolicy Policy);
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Connections", meta = (DisplayName = "Get Connection Policy"))
+		FModioAPI_ConnectionPolicy GetConnectionPolicy();
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Connections", meta = (DisplayName = "Get Connection Pool Stats"))
+		FModioAPI_ConnectionPoolStats GetConnectionPoolStats();
+
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Connections", meta = (DisplayName = "Reset Connection Pool Stats"))
+		void ResetConnectionPoolStats();
+
+		/*
+		Opens idle Connections to the mod.io API Host with 'HEAD' Requests, so following Requests skip DNS, Connect and TLS Handshake
+		Called on Initialization if the Policy asks for Warm-Up Connections. Warm-Ups don't take Rate Limit Budget, Connections that are busy or still open are skipped
+		@return Number of Connections being opened
+		*/
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Connections", meta = (DisplayName = "Warm up Connections"))
+		int32 WarmUpConnections(int32 NumOfConnections);
+
+	protected:
+		// Resizes the tracked Connections to the Cap
+		void ApplyConnectionPolicy();
+
+		// Slots within the Cap, or all of them if there is no Cap
+		int32 GetNumOfConnectionSlots();
+
+		bool HasIdleConnection();
+
+		// Assigns an idle Connection to the Attempt, preferring ones that are probably still open. Warm-Ups only take closed ones
+		int32 AcquireConnection(TSharedPtr<FModioAPI_RequestTiming> Timing, bool bOnlyClosed = false);
+
+		// Frees the Connection once the Response arrived, it stays open unless it failed or mod.io closed it
+		void ReleaseConnection(int32 ConnectionIndex, FHttpResponsePtr Response, bool bConnectedSuccessfully);
+
+	public:
+		/*
+		Prefetching
+		*/
+
+		/*
+		Limits the Requests sent speculatively by the Prefetcher
+		@param MaxConcurrent Prefetches in flight at the same Time
+		@param BudgetReserve Share of the Rate Limit Budget Prefetches never use, so regular Requests don't get queued because of them
+		@param LifetimeSeconds Seconds a prefetched Response is kept for its Caller
+		*/
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Prefetching", meta = (DisplayName = "Configure Prefetching"))
+		void ConfigurePrefetching(int32 MaxConcurrent, float BudgetReserve, float LifetimeSeconds);
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Prefetching", meta = (DisplayName = "Get Prefetcher"))
+		UModioAPIPrefetchObject* GetPrefetcher();
+
+		// Stats of the prefetched Requests, Logos are counted by the Prefetcher
+		FModioAPI_PrefetchStats GetPrefetchStats();
+
+		void ResetPrefetchStats();
+
+		/*
+		GET Requests dispatched between Begin and End are prefetched instead of sent
+		They wait until no regular Request is queued and enough Budget is left, and their Response isn't broadcast but kept for the next identical Request
+		*/
+		void BeginPrefetch(const FString& Tag);
+
+		void EndPrefetch();
+
+		/*
+		Drops the Prefetches issued with the Tag, all of them if it is empty. Prefetches a Caller is waiting for are kept
+		@return Number of Prefetches dropped
+		*/
+		int32 CancelPrefetches(const FString& Tag);
+
+		/*
+		Slots of the Prefetches in flight, for Downloads the Prefetcher sends itself like Logos
+		A Slot is only acquired when queued Prefetches could be sent: none is queued before, no regular Request is waiting, their Budget Share is left and a Connection is idle
+		The Downloads don't go to mod.io API, so they take no Budget. Every acquired Slot has to be released once its Download has ended
+		*/
+		bool AcquirePrefetchSlot();
+
+		void ReleasePrefetchSlot();
+
+		// Keeps processing the Queues until the Prefetcher has started its queued Downloads
+		void SchedulePrefetchQueue();
+
+	protected:
+		bool DispatchPrefetch(FHttpRequestRef Request);
+
+		// Answers the Request with a Prefetch of the identical Request, returns false if there is none that was sent
+		bool ServeFromPrefetch(FHttpRequestRef Request, const FString& RequestKey);
+
+		bool CanSendPrefetch();
+
+		void ProcessPrefetchQueue();
+
+		void Prefetch_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString RequestKey, TSharedPtr<FModioAPI_RequestTiming> Timing);
+
+		// Runs the Response Handler of the Request with the prefetched Response, as if it was received for the Request itself
+		void HandlePrefetchedResponse(FHttpRequestRef Request, FHttpResponsePtr Response, TSharedPtr<FStructOnScope> NotModifiedResponse);
+
+		void ExpirePrefetches();
+
+		/*
+		Sends the Request to mod.io API
+		Identical GET Requests (Verb, URL and Authorization) that are still in flight are not sent twice, the Caller is attached to the pending Request instead
+		and receives the same Response broadcast
+		Requests exceeding the Rate Limit are queued and sent as soon as there is Budget again
+		GET Requests and Writes marked as idempotent are retried on Connection Failures, Timeouts and Server Errors following their Retry Policy
+		*/
+		bool DispatchRequest(FHttpRequestRef Request, bool IsIdempotent = false);
+
+		FString GetInFlightRequestKey(FHttpRequestRef Request);
+
+		// Sends the Request right away if the Rate Limit allows it, queues it otherwise
+		bool SendOrQueueRequest(FHttpRequestRef Request, double NotBefore, TSharedPtr<FModioAPI_RequestTiming> Timing);
+
+		void RefillRequestBudget();
+
+		bool ProcessRequestQueue(float DeltaTime);
+
+		// Reads 'X-RateLimit-*' and 'Retry-After' Headers
+		void UpdateRateLimitFromResponse(FHttpResponsePtr Response);
+
+		// Exponential Backoff with full Jitter, never shorter than the Delay requested by mod.io
+		float GetRetryDelay(int32 Attempt, float MinimumDelay);
+
+		// Decides if the failed Attempt gets retried and returns the Delay to wait before
+		bool ShouldRetryRequest(FHttpResponsePtr Response, bool bConnectedSuccessfully, const FModioAPI_DispatchedRequest& DispatchedRequest, float& RetryDelay);
+
+		void DispatchedRequest_ResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FModioAPI_DispatchedRequest DispatchedRequest);
+
+		// Verb and Path of the Request with IDs replaced, e.g. 'GET /games/{id}/mods'
+		FString GetEndpointName(FHttpRequestPtr Request);
+
+		// Deserializes the Response and records the Time spent for the Endpoint currently handled
+		TSharedPtr<FJsonObject> ParseResponseToJsonObject(FHttpResponsePtr Response);
+
+		void AddHistogramSample(FModioAPI_LatencyHistogram& Histogram, double Seconds);
+
+		void RecordResponseMetrics(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, const FModioAPI_DispatchedRequest& DispatchedRequest);
+
+	public:
+		/*
+		Response Cache
+		*/
+
+		UFUNCTION()
+		FString GetResponseCacheFilePath();
+
+	protected:
+		/*
+		Returns the cached decoded Response if the Server answered '304 Not Modified'
+		No JSON is parsed in this case, the Struct decoded from the last '200' Response is copied instead
+		*/
+		template<typename StructType>
+		bool GetNotModifiedResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, StructType& CachedResponse)
+		{
+			TSharedPtr<FStructOnScope> DecodedResponse = FindNotModifiedResponse(Request, Response, StructType::StaticStruct());
+			if (!DecodedResponse.IsValid())
+			{
+				return false;
+			}
+
+			CachedResponse = *reinterpret_cast<const StructType*>(DecodedResponse->GetStructMemory());
+			return true;
+		}
+
+		/*
+		Stores the decoded Response together with its 'ETag' / 'Last-Modified' Header
+		Responses without any of these Headers can't be validated and are not cached
+		*/
+		template<typename StructType>
+		void StoreResponseInCache(FHttpRequestPtr Request, FHttpResponsePtr Response, const StructType& DecodedResponse)
+		{
+			TSharedPtr<FStructOnScope> ScopedResponse = MakeShared<FStructOnScope>(StructType::StaticStruct());
+			StructType::StaticStruct()->CopyScriptStruct(ScopedResponse->GetStructMemory(), &DecodedResponse);
+			StoreScopedResponseInCache(Request, Response, ScopedResponse);
+		}
+
+		TSharedPtr<FStructOnScope> FindNotModifiedResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, UScriptStruct* ExpectedStruct);
+
+		void StoreScopedResponseInCache(FHttpRequestPtr Request, FHttpResponsePtr Response, TSharedPtr<FStructOnScope> ScopedResponse);
+
+		/*
+		Adds 'If-None-Match' / 'If-Modified-Since' for Requests with a cached Response
+		@return The decoded Response the Validators belong to, which the Request keeps until it is handled. Null if none were added
+		*/
+		TSharedPtr<FStructOnScope> AddResponseCacheValidators(FHttpRequestRef Request);
+
+		// Makes the decoded Response available to FindNotModifiedResponse while the Response Handler runs. Returns the Response pinned for the URL before
+		TSharedPtr<FStructOnScope> PinNotModifiedResponse(FHttpRequestPtr Request, TSharedPtr<FStructOnScope> NotModifiedResponse);
+
+		void UnpinNotModifiedResponse(FHttpRequestPtr Request, TSharedPtr<FStructOnScope> PreviousPinnedResponse);
+
+		UFUNCTION()
+		bool SaveResponseCacheToFile(FString& Message);
+
+		UFUNCTION()
+		bool LoadResponseCacheFromFile(FString& Message);
+
+		// Evicts the least recently used Entries beyond the Limit
+		void EvictResponseCacheEntries();
+
+		// Marks the Response Cache to be saved with the next Flush, several Changes in a Row are written at once
+		void MarkResponseCacheDirty();
+
+		bool FlushResponseCache_Tick(float DeltaTime);
+
 	public:
 		/*
 		File Storage
@@ -626,6 +1051,12 @@ class MODIOAPI_API UModioAPIObject : public UObject
 		UFUNCTION()
 		FString GetUploadSessionsDirectoryPath();
 
+		UFUNCTION()
+		FString GetContentStoreDirectoryPath();
+
+		UFUNCTION()
+		FString GetManifestsDirectoryPathForMod(int32 ModID);
+
 		UFUNCTION(BlueprintPure, Category = "mod.io API|File Storage|Users")
 		FString GetAvatarDirectoryPathForUser(int32 UserID);
 
@@ -635,6 +1066,16 @@ class MODIOAPI_API UModioAPIObject : public UObject
 		UFUNCTION(BlueprintPure, Category = "mod.io API|File Storage|Mods")
 		FString GetModfileDirectoryPathForModfile(int32 ModID, int32 ModfileID);
 
+		// The Manifest is written once a Modfile is installed completely
+		UFUNCTION(BlueprintPure, Category = "mod.io API|File Storage|Mods")
+		FString GetManifestFilePathForModfile(int32 ModID, int32 ModfileID);
+
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|File Storage|Mods", meta = (DisplayName = "Load Modfile Manifest"))
+		bool LoadModfileManifest(int32 ModID, int32 ModfileID, FModioAPI_ModfileManifest& Manifest, FString& Message);
+
+		UFUNCTION()
+		TArray<FModioAPI_ModfileManifest> LoadModfileManifestsForMod(int32 ModID);
+
 		UFUNCTION(BlueprintPure, Category = "mod.io API|File Storage|Guides")
 		FString GetMediaDirectoryPathForGuide(int32 GuideID);
 
@@ -1110,8 +1551,8 @@ class MODIOAPI_API UModioAPIObject : public UObject
 
 		// Dependencies
 
-		UFUNCTION(BlueprintCallable, Category = "mod.io API|Requests|Dependencies", meta = (DisplayName = "Request 'Get Mod Dependencies' - Not Implemented yet!"))
-		bool RequestGetModDependencies(int32 ModID, FString& Message);
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Requests|Dependencies", meta = (DisplayName = "Request 'Get Mod Dependencies'"))
+		bool RequestGetModDependencies(int32 ModID, FModioAPI_RequestPagination Pagination, FString& Message);
 
 		/*
 		Send Request to mod.io API
@@ -1198,9 +1639,10 @@ class MODIOAPI_API UModioAPIObject : public UObject
 		/*
 		Send Request to mod.io API
 		@param AccessToken The Access Token used as override. Only necessary if you disabled Automated Caching of Access Token when creating the mod.io API Connection!
+		@param Pagination Page of Subscriptions to request, the first one if Limit and Offset are left unset
 		*/
-		UFUNCTION(BlueprintCallable, Category = "mod.io API|Requests|Me", meta = (DisplayName = "Request 'Get User Subscriptions'", AdvancedDisplay = "AccessToken"))
-		bool RequestGetUserSubscriptions(FString AccessToken, FString& Message);
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Requests|Me", meta = (DisplayName = "Request 'Get User Subscriptions'", AdvancedDisplay = "AccessToken, Pagination"))
+		bool RequestGetUserSubscriptions(FString AccessToken, FModioAPI_RequestPagination Pagination, FString& Message);
 
 		/*
 		Send Request to mod.io API
@@ -1541,8 +1983,150 @@ class MODIOAPI_API UModioAPIObject : public UObject
 		UFUNCTION(BlueprintCallable, Category = "mod.io API|File Storage|Clearing", meta = (DisplayName = "Clear cached File Storage for all Mods"))
 		bool ClearCachedFileStorageForAllMods();
 
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|File Storage|Clearing", meta = (DisplayName = "Clear unreferenced Content Store Files", Tooltip = "Deletes the stored Files no installed Modfile refers to anymore!"))
+		bool ClearUnreferencedContentStoreFiles();
+
 		// Persisting Cache
 
 		UFUNCTION(BlueprintCallable, Category = "mod.io API|Persisting Cache", meta = (DisplayName = "Clear Persisting Cache", Tooltip = "Clears the Access Token!"))
 		bool ClearPersistingCache();
+
+		// Response Cache
+
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Response Cache", meta = (DisplayName = "Clear Response Cache", Tooltip = "Forces the next Requests to download and decode full Responses again!"))
+		bool ClearResponseCache();
+
+		// Cached Responses kept at most, the least recently used ones are evicted beyond
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Response Cache", meta = (DisplayName = "Set max Response Cache Entries"))
+		void SetMaxResponseCacheEntries(int32 MaxEntries);
+
+		// Writes pending Changes of the Response Cache to File right away instead of with the next delayed Save
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Response Cache", meta = (DisplayName = "Flush Response Cache"))
+		bool FlushResponseCache(FString& Message);
+
+		/*
+		Cache Quota
+		*/
+
+		// Limits the Size of all cached Mods. With 0, the Cache is only limited by the free Disk Space
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|File Storage|Quota", meta = (DisplayName = "Set Cache Quota"))
+		void SetCacheQuota(int64 QuotaBytes);
+
+		// Disk Space that is kept free when reserving Cache Space, so a Download never fills the Disk completely
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|File Storage|Quota", meta = (DisplayName = "Set min free Disk Space"))
+		void SetMinFreeDiskSpace(int64 Bytes);
+
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|File Storage|Quota", meta = (DisplayName = "Get Cache Space Info"))
+		FModioAPI_CacheSpaceInfo GetCacheSpaceInfo();
+
+		// Mods used the longest Time ago are evicted first
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|File Storage|Quota", meta = (DisplayName = "Mark cached Mod as used"))
+		void MarkCachedModUsed(int32 ModID);
+
+		/*
+		Reserves Space for Files of a Mod that are about to be written to the Cache. Has to be released once they are written
+		Least recently used Mods are evicted if the Space doesn't fit into the Cache Quota or onto the Disk
+		@param RequiredBytes Bytes the Files will occupy, e.g. the Filesize of a Modfile or its uncompressed Filesize if it is extracted
+		@return False if the Space can't be made available. Nothing should be written then, as it would fail on the Way
+		*/
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|File Storage|Quota", meta = (DisplayName = "Reserve Cache Space"))
+		bool ReserveCacheSpace(int32 ModID, int64 RequiredBytes, FString& Message);
+
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|File Storage|Quota", meta = (DisplayName = "Release Cache Space"))
+		void ReleaseCacheSpace(int32 ModID, int64 ReservedBytes);
+
+		/*
+		Keeps the Content Store from being swept while a Modfile is installed, its stored Files aren't referenced by a Manifest until it is complete
+		Sweeps skipped in the meantime run once the last Installation has ended. Thread-safe, every Begin needs exactly one End
+		*/
+		static void BeginContentStoreInstall();
+
+		static void EndContentStoreInstall();
+
+		/*
+		Evicts cached Mods the User isn't subscribed to, least recently used first, until the Bytes are freed
+		Media of subscribed Mods is evicted only afterwards, Modfiles of subscribed Mods and Mods installed or queued by the Subscription Sync never.
+		Without cached Subscriptions, every Mod is treated as subscribed. The evicted Directories are moved aside right away and deleted in the Background
+		@return Bytes freed. Files shared through the Content Store count for every Mod using them
+		*/
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|File Storage|Clearing", meta = (DisplayName = "Evict least recently used Mods"))
+		int64 EvictLeastRecentlyUsedMods(int64 BytesToFree, int32 ExceptedModID);
+
+	protected:
+		FString GetCacheUsageFilePath();
+
+		bool SaveCacheUsageToFile(FString& Message);
+
+		bool LoadCacheUsageFromFile(FString& Message);
+
+		// Bytes of all cached Mods, without the Content Store whose Files are hardlinked into the Mod Directories
+		int64 GetCacheSize();
+
+		// Measures the Directory of the Mod on a Background Thread, those of all Mods with INDEX_NONE. The Sizes are applied on the Game Thread once done
+		void MeasureCachedModSizes(int32 ModID);
+
+		// Measures the Cache on the Game Thread, only if the Measurement started at Initialization didn't finish in Time
+		void EnsureCachedModSizesMeasured();
+
+		void ApplyCachedModSizes(const TMap<int32, FModioAPI_CachedModSize>& MeasuredSizes, uint32 MeasuredAtRevision, int32 ModID);
+
+		void SetCachedModSize(int32 ModID, int64 Bytes, int64 MediaBytes, uint32 Revision);
+
+		// Touches nothing but the Files, so it can run on Background Threads
+		static TMap<int32, FModioAPI_CachedModSize> MeasureModDirectories(const FString& ModsDirectoryPath, int32 ModID);
+
+		static int64 GetDirectorySize(const FString& DirectoryPath);
+
+		// Moves the Directory aside, so nothing gets written into it while it is deleted in the Background
+		bool MoveEvictedDirectory(const FString& DirectoryPath, TArray<FString>& EvictedDirectories);
+
+		void DeleteEvictedDirectories(TArray<FString> EvictedDirectories, int64 EvictedBytes);
+
+		// Thread-safe Part of ClearUnreferencedContentStoreFiles
+		static bool ClearUnreferencedFilesInContentStore(const FString& ModsDirectoryPath, const FString& ContentStoreDirectoryPath);
+
+		int64 GetReservedCacheSpace();
+
+		bool GetFreeDiskSpace(int64& FreeDiskSpace);
+
+		UPROPERTY()
+		FModioAPI_CacheUsage CacheUsage;
+
+		bool bCacheUsageLoaded = false;
+
+		// Set once every Page of the Subscriptions of the User was received, until then no Mod is known to be unsubscribed
+		bool bSubscriptionsCached = false;
+
+		// End of the Subscriptions received without Gap from the first Page on
+		int32 SubscriptionsMergedUpToOffset = 0;
+
+		int64 CacheQuota = 0;
+		int64 MinFreeDiskSpace = 256 * 1024 * 1024;
+
+		// Key = Mod ID | Value = Bytes reserved for Files of the Mod that are being written
+		TMap<int32, int64> CacheReservations;
+
+		// Key = Mod ID | Value = Size of its Directory, as measured or changed by Reservations and Evictions since
+		TMap<int32, FModioAPI_CachedModSize> CachedModSizes;
+		int64 CachedModsBytes = 0;
+		uint32 CacheSizeRevision = 0;
+		bool bCachedModSizesMeasured = false;
+
+		// Bytes of evicted Directories still being deleted, they count as free Disk Space
+		int64 PendingEvictionBytes = 0;
+
+	public:
+		/*
+		Subscription Sync
+		*/
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Get Subscription Sync"))
+		UModioAPISubscriptionSyncObject* GetSubscriptionSync();
+
+	protected:
+		UPROPERTY()
+		UModioAPISubscriptionSyncObject* SubscriptionSync;
+
+		UPROPERTY()
+		UModioAPIPrefetchObject* Prefetcher;
 };
@@ -609,6 +609,10 @@ struct FModioAPI_GetModDependencies
 {
     GENERATED_BODY()
 
+    // Mod the Dependencies were requested for, not part of the mod.io Response
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Get Mod Dependencies")
+    int32 Mod_ID = 0;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Get Mod Dependencies")
     TArray<FModioAPI_ModDependencies> Data;
 
@@ -1536,6 +1540,493 @@ struct FModioAPI_PersistingCache
     FModioAPI_AccessToken CachedAccessToken;
 };
 
+USTRUCT(BlueprintType, Category = "mod.io API|Requests", meta = (DisplayName = "Retry Policy"))
+struct FModioAPI_RetryPolicy
+{
+    GENERATED_BODY()
+
+    // Retries after a failed Attempt, '429 Too Many Requests' is limited by the Rate Limit Retries instead
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io API|Requests")
+    int32 MaxRetries = 3;
+
+    // No Retry is scheduled past this many Seconds after the first Attempt
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io API|Requests")
+    float MaxTotalRetrySeconds = 30.0f;
+
+    // Timeout of a single Attempt, 0 keeps the HTTP Module Default
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io API|Requests")
+    float TimeoutSeconds = 30.0f;
+
+    // Retry if the Connection failed or timed out
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io API|Requests")
+    bool RetryConnectionFailures = true;
+
+    // Retry on '5xx' and '408 Request Timeout'
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io API|Requests")
+    bool RetryServerErrors = true;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Rate Limit", meta = (DisplayName = "Rate Limit Status"))
+struct FModioAPI_RateLimitStatus
+{
+    GENERATED_BODY()
+
+    // Requests that can currently be sent without being queued
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Rate Limit")
+    float RemainingBudget = 0.0f;
+
+    // Maximum amount of Requests per Minute
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Rate Limit")
+    int32 Limit = 0;
+
+    // Requests waiting for Budget or for a Retry
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Rate Limit")
+    int32 QueuedRequests = 0;
+
+    // Seconds until mod.io accepts Requests again after answering '429 Too Many Requests'
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Rate Limit")
+    float SecondsUntilRetry = 0.0f;
+
+    // Amount of '429 Too Many Requests' Responses received
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Rate Limit")
+    int32 RateLimitedResponses = 0;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Metrics", meta = (DisplayName = "Latency Histogram"))
+struct FModioAPI_LatencyHistogram
+{
+    GENERATED_BODY()
+
+    // Upper Bound of each Bucket in Milliseconds, the last Bucket collects everything above
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    TArray<float> BucketUpperBoundsMs;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    TArray<int32> BucketCounts;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int32 Samples = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    float TotalMs = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    float MaxMs = 0.0f;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Metrics", meta = (DisplayName = "Endpoint Metrics"))
+struct FModioAPI_EndpointMetrics
+{
+    GENERATED_BODY()
+
+    // Requests sent, Retries not included
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int32 Requests = 0;
+
+    // Callers attached to an identical Request already in flight
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int32 CoalescedRequests = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int32 Retries = 0;
+
+    // Connection Failures and Responses with Error Codes
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int32 Failures = 0;
+
+    // Responses served from the Response Cache
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int32 NotModifiedResponses = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int64 BytesSent = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int64 BytesReceived = 0;
+
+    // Waiting for Rate Limit Budget
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    FModioAPI_LatencyHistogram QueueWait;
+
+    // DNS, Connect, TLS and Server Time until the first Header arrived
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    FModioAPI_LatencyHistogram TimeToFirstByte;
+
+    // Receiving the Response after the first Header
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    FModioAPI_LatencyHistogram Transfer;
+
+    // Deserializing the JSON Response
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    FModioAPI_LatencyHistogram Parse;
+
+    // Converting to Structs, merging into the Cache and broadcasting
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    FModioAPI_LatencyHistogram Process;
+
+    // First Attempt until the Response was broadcast, Retries included
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    FModioAPI_LatencyHistogram Total;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Metrics", meta = (DisplayName = "Request Metrics"))
+struct FModioAPI_RequestMetrics
+{
+    GENERATED_BODY()
+
+    // Key = Verb and Path with IDs replaced (e.g. 'GET /games/{id}/mods') | Value = Metrics
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    TMap<FString, FModioAPI_EndpointMetrics> Endpoints;
+
+    // Requests sent or queued that didn't broadcast their Response yet
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int32 ActiveRequests = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int32 QueuedRequests = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int32 Retries = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int64 BytesSent = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Metrics")
+    int64 BytesReceived = 0;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Connections", meta = (DisplayName = "Connection Policy"))
+struct FModioAPI_ConnectionPolicy
+{
+    GENERATED_BODY()
+
+    // Ask mod.io to keep Connections open between Requests. Sends 'Connection: close' if disabled, HTTP/2 Connections are kept open by the HTTP Backend either way
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io API|Connections")
+    bool KeepAlive = true;
+
+    // Requests to the mod.io API sent at the same Time, further Requests wait in the Request Queue. 0 leaves it to the Rate Limit Budget and the HTTP Module
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io API|Connections")
+    int32 MaxConnections = 0;
+
+    // Connections opened on Initialization, so the first Requests skip the TLS Handshake. Opt-in, none are opened by Default
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io API|Connections")
+    int32 WarmUpConnections = 0;
+
+    // Seconds an idle Connection is expected to be kept open by mod.io
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io API|Connections")
+    float KeepAliveSeconds = 60.0f;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Connections", meta = (DisplayName = "Estimated Connection Stats"))
+struct FModioAPI_ConnectionStats
+{
+    GENERATED_BODY()
+
+    // A Request is currently sent over the Slot
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    bool Busy = false;
+
+    // The last Response arrived within the Keep-Alive Seconds, so the Connection is probably still open
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    bool EstimatedOpen = false;
+
+    // Requests sent over the Slot, Warm-Ups included
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    int32 Requests = 0;
+
+    // Requests sent while the Connection was probably still open
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    int32 EstimatedReuses = 0;
+
+    // Requests sent while the Connection was probably closed
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    int32 EstimatedOpened = 0;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Connections", meta = (DisplayName = "Connection Pool Stats"))
+struct FModioAPI_ConnectionPoolStats
+{
+    GENERATED_BODY()
+
+    // The HTTP Module doesn't expose its own Connections, so Reuse is estimated from the Timing of the Requests and the Keep-Alive of the Policy
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    TArray<FModioAPI_ConnectionStats> EstimatedConnections;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    int32 Requests = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    int32 EstimatedReuses = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    int32 EstimatedNewConnections = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    int32 WarmUps = 0;
+
+    // Connections closed by mod.io before their Keep-Alive ran out, either failed or answered with 'Connection: close'
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    int32 ClosedConnections = 0;
+
+    // Times a Request had to wait in the Queue because the Connection Cap was reached
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    int32 PoolExhausted = 0;
+
+    // Share of Requests sent while a Connection was probably still open
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    float EstimatedReuseRatio = 0.0f;
+
+    // Time to first Byte of Requests estimated to open a Connection. A much higher Time than the reused ones means DNS, Connect and TLS Handshake were paid
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    FModioAPI_LatencyHistogram TimeToFirstByteEstimatedNew;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Connections")
+    FModioAPI_LatencyHistogram TimeToFirstByteEstimatedReused;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Prefetching", meta = (DisplayName = "Prefetch Stats"))
+struct FModioAPI_PrefetchStats
+{
+    GENERATED_BODY()
+
+    // Requests queued for Prefetching, Requests already in flight or prefetched not included
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Prefetching")
+    int32 Issued = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Prefetching")
+    int32 Sent = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Prefetching")
+    int32 Completed = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Prefetching")
+    int32 Failed = 0;
+
+    // Requests answered with a prefetched Response without going to mod.io
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Prefetching")
+    int32 Hits = 0;
+
+    // Requests attached to a Prefetch that was still in flight
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Prefetching")
+    int32 LateHits = 0;
+
+    // Prefetches dropped because they lost Relevance, or sent by the Caller itself before they were
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Prefetching")
+    int32 Cancelled = 0;
+
+    // Prefetched Responses nobody asked for within their Lifetime
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Prefetching")
+    int32 Expired = 0;
+
+    // Share of sent Prefetches that answered a Request
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Prefetching")
+    float HitRate = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Prefetching")
+    int32 LogosPrefetched = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Prefetching")
+    int32 LogosCancelled = 0;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Response Cache", meta = (DisplayName = "Response Cache Entry"))
+struct FModioAPI_ResponseCacheEntry
+{
+    GENERATED_BODY()
+
+    // Entity Tag the Response was served with, sent back as 'If-None-Match'
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Response Cache")
+    FString ETag;
+
+    // Last Modification Date the Response was served with, sent back as 'If-Modified-Since'
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Response Cache")
+    FString LastModified;
+
+    // Path of the Struct the Response was decoded to
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Response Cache")
+    FString StructPath;
+
+    // The decoded Response, exported to JSON for storing it on Disk
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Response Cache")
+    FString DecodedResponse;
+
+    // Entries used the longest Time ago are evicted first once the Cache is full
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Response Cache")
+    FDateTime LastUsed;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Response Cache", meta = (DisplayName = "Response Cache"))
+struct FModioAPI_ResponseCache
+{
+    GENERATED_BODY()
+
+    // Key = Request URL | Value = Cache Entry
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Response Cache")
+    TMap<FString, FModioAPI_ResponseCacheEntry> Entries;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Content Store", meta = (DisplayName = "Modfile Manifest Entry"))
+struct FModioAPI_ModfileManifestEntry
+{
+    GENERATED_BODY()
+
+    // Path of the File relative to the Directory the Modfile was installed to
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Content Store")
+    FString Path;
+
+    // SHA-1 of the File Content, which is also its Name in the Content Store
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Content Store")
+    FString Hash;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Content Store")
+    int64 Size = 0;
+
+    // CRC-32 listed in the Zip-Archive, recognizes unchanged Files of later Modfiles before they are extracted
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Content Store")
+    int64 Crc32 = 0;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Content Store", meta = (DisplayName = "Modfile Manifest"))
+struct FModioAPI_ModfileManifest
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Content Store")
+    int32 Mod_ID = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Content Store")
+    int32 Modfile_ID = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Content Store")
+    TArray<FModioAPI_ModfileManifestEntry> Files;
+
+    // Bytes of unchanged Files that were taken from the Content Store instead of being extracted
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Content Store")
+    int64 SkippedBytes = 0;
+
+    // Bytes of extracted Files that were already in the Content Store and are kept on Disk only once
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Content Store")
+    int64 DeduplicatedBytes = 0;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|File Storage|Quota", meta = (DisplayName = "Cache Usage"))
+struct FModioAPI_CacheUsage
+{
+    GENERATED_BODY()
+
+    // Key = Mod ID | Value = When the cached Files of the Mod were used the last Time
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|File Storage|Quota")
+    TMap<int32, FDateTime> ModsLastUsed;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|File Storage|Quota", meta = (DisplayName = "Cache Space Info"))
+struct FModioAPI_CacheSpaceInfo
+{
+    GENERATED_BODY()
+
+    // Bytes of all cached Mods
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|File Storage|Quota")
+    int64 CacheSize = 0;
+
+    // 0 if the Cache is only limited by the free Disk Space
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|File Storage|Quota")
+    int64 CacheQuota = 0;
+
+    // Bytes reserved for running Downloads
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|File Storage|Quota")
+    int64 ReservedBytes = 0;
+
+    // -1 if the free Disk Space couldn't be determined
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|File Storage|Quota")
+    int64 FreeDiskSpace = -1;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|File Storage|Quota")
+    int64 MinFreeDiskSpace = 0;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Subscription Sync Queue Entry"))
+struct FModioAPI_SyncQueueEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    int32 Mod_ID = 0;
+
+    // Modfile that gets installed for the Mod
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    FModioAPI_Modfile Modfile;
+
+    // Mods that need to be installed before this one
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    TArray<int32> DependsOn;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    TEnumAsByte<EModioAPI_SyncEntryState> State = EModioAPI_SyncEntryState::SyncEntryState_Queued;
+
+    // Failed Installations so far
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    int32 Attempts = 0;
+
+    // Whether 'Get Mod Dependencies' was answered for the Mod
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    bool bDependenciesResolved = false;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Subscription Sync Dependencies"))
+struct FModioAPI_SyncDependencies
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    TArray<int32> Mod_IDs;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Subscription Sync State"))
+struct FModioAPI_SyncState
+{
+    GENERATED_BODY()
+
+    // Mods that still need to be installed, kept across Restarts
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    TArray<FModioAPI_SyncQueueEntry> Queue;
+
+    // Key = Mod ID | Value = ID of the installed Modfile
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    TMap<int32, int32> InstalledModfiles;
+
+    // Key = Mod ID | Value = Mods it was installed with as Dependencies, they stay required as long as the Mod does
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    TMap<int32, FModioAPI_SyncDependencies> InstalledDependencies;
+};
+
+USTRUCT(BlueprintType, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Subscription Sync Progress"))
+struct FModioAPI_SyncProgress
+{
+    GENERATED_BODY()
+
+    // Mods that are part of the current Sync
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    int32 NumOfMods = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    int32 NumOfInstalled = 0;
+
+    // Mods that failed after all Retries, or whose Dependencies failed
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    int32 NumOfFailed = 0;
+
+    // Bytes downloaded by all running and finished Installations
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    int64 BytesReceived = 0;
+
+    // Size of all Modfiles that are part of the current Sync
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    int64 BytesTotal = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "mod.io API|Subscription Sync")
+    float Progress = 0.0f;
+};
+
 USTRUCT(BlueprintType, Category = "mod.io API|Guides|Add Guide", meta = (DisplayName = "mod.io Add Guide"))
 struct FModioAPI_AddGuide
 {
@@ -1861,6 +2352,43 @@ struct FModioAPI_DownloadModfileMessage
     TEnumAsByte<EModioAPI_DownloadResult> Result;
 };
 
+USTRUCT(BlueprintType, Category = "mod.io API|Async Actions", meta = (DisplayName = "Modfile Update Download"))
+struct FModioAPI_DownloadModfileUpdateMessage
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly)
+    FString ErrorMessage;
+
+    UPROPERTY(BlueprintReadOnly)
+    FModioAPI_Modfile Modfile;
+
+    UPROPERTY(BlueprintReadOnly)
+    FModioAPI_DownloadFileProgress ProgressInfo;
+
+    UPROPERTY(BlueprintReadOnly)
+    TEnumAsByte<EModioAPI_DownloadResult> Result;
+
+    // Whether the Zip-Archive had to be downloaded in full, e.g. because the previous one wasn't in the Cache or the rebuilt one didn't match
+    UPROPERTY(BlueprintReadOnly)
+    bool bFullDownload = false;
+
+    // Entries of the Zip-Archive copied from the previous Zip-Archive
+    UPROPERTY(BlueprintReadOnly)
+    int32 BlocksReused = 0;
+
+    // Entries of the Zip-Archive downloaded from mod.io
+    UPROPERTY(BlueprintReadOnly)
+    int32 BlocksFetched = 0;
+
+    UPROPERTY(BlueprintReadOnly)
+    int64 BytesReused = 0;
+
+    // Bytes actually downloaded, including the Central Directory and a Full Download if one was necessary
+    UPROPERTY(BlueprintReadOnly)
+    int64 BytesTransferred = 0;
+};
+
 USTRUCT(BlueprintType, Category = "mod.io API|Async Actions", meta = (DisplayName = "Icon Download"))
 struct FModioAPI_DownloadIconMessage
 {
@@ -0,0 +1,99 @@
+/*
+Copyright © 2023 Arvur GmbH / Robin Hasenbach.
+Released under GNU AGPLv3 License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "ModioAPIStructs.h"
+#include "FileToStorageDownloader.h"
+#include "ModioAPIPrefetchObject.generated.h"
+
+class UModioAPIObject;
+
+/**
+ * Warms the Caches for what the User is likely to open next while browsing Mods.
+ * The Page following the visible one in Scroll Direction and the Details, Modfiles, Dependencies, Stats and Logo of hovered Mods are requested at low Priority.
+ * Their Responses are kept until the same Requests are dispatched, which are then answered without going to mod.io. Prefetches that lose Relevance are cancelled.
+ */
+UCLASS(BlueprintType, Category = "mod.io API|Prefetching", meta = (DisplayName = "mod.io Prefetcher"))
+class MODIOAPI_API UModioAPIPrefetchObject : public UObject
+{
+	GENERATED_BODY()
+
+	public:
+		UPROPERTY()
+		UModioAPIObject* ModioConnection;
+
+		/*
+		Prefetches the Page of Mods the User scrolls towards. The Prefetch for the previously visible Page is cancelled
+		@param Filters Filters the visible Page was requested with
+		@param Sorting Sorting the visible Page was requested with
+		@param VisiblePage The visible Page as received
+		@param ScrollingForward Prefetches the next Page if true, the previous one otherwise
+		*/
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Prefetching", meta = (DisplayName = "Prefetch adjacent Page of Mods"))
+		bool PrefetchAdjacentPage(FModioAPI_RequestFilters Filters, FModioAPI_RequestSorting Sorting, FModioAPI_GetMods VisiblePage, bool ScrollingForward, FString& Message);
+
+		/*
+		Prefetches what is shown when the Mod gets opened: its Details, Modfiles, Dependencies, Stats and Logo
+		Only the most recently hovered Mods stay relevant, Prefetches of older ones are cancelled
+		*/
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Prefetching", meta = (DisplayName = "Prefetch hovered Mod"))
+		bool PrefetchHoveredMod(FModioAPI_Mod Mod, FString& Message);
+
+		// Cancels the Prefetches of a Mod that left the Screen
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Prefetching", meta = (DisplayName = "Cancel Prefetches for Mod"))
+		void CancelModPrefetches(int32 ModID);
+
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Prefetching", meta = (DisplayName = "Cancel all Prefetches"))
+		void CancelAllPrefetches();
+
+		// Hovered Mods whose Prefetches are kept
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Prefetching", meta = (DisplayName = "Set max hovered Mods"))
+		void SetMaxHoveredMods(int32 MaxMods);
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Prefetching", meta = (DisplayName = "Get Prefetch Stats"))
+		FModioAPI_PrefetchStats GetPrefetchStats();
+
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Prefetching", meta = (DisplayName = "Reset Prefetch Stats"))
+		void ResetPrefetchStats();
+
+		// Starts the queued Logo Downloads the Connection has Prefetch Slots for. Called by the Connection once its Prefetch Queue has drained
+		void ProcessLogoQueue();
+
+		bool HasQueuedLogos();
+
+	protected:
+		FString GetModTag(int32 ModID);
+
+		void PrefetchLogo(const FModioAPI_Mod& Mod);
+
+		void StartLogoDownload(int32 ModID, const FModioAPI_Logo_Object& Logo);
+
+		// Releases the Prefetch Slot and Cache Space of the Download, which is the last Thing that happens for it, cancelled or not
+		void LogoDownloadCompleted(EDownloadToStorageResult Result, int32 ModID);
+
+		// Tag of the Page prefetched last
+		FString PageTag;
+
+		// Most recently hovered Mod last
+		TArray<int32> HoveredModIDs;
+
+		int32 MaxHoveredMods = 3;
+
+		// Key = Mod ID | Value = Logo being downloaded
+		UPROPERTY()
+		TMap<int32, UFileToStorageDownloader*> LogoDownloads;
+
+		// Logos waiting for a Prefetch Slot, oldest first
+		TArray<TPair<int32, FModioAPI_Logo_Object>> QueuedLogos;
+
+		// Cache Space reserved for a Logo being downloaded, as its Size isn't known in Advance
+		int64 LogoCacheReservationBytes = 2 * 1024 * 1024;
+
+		int32 LogosPrefetched = 0;
+		int32 LogosCancelled = 0;
+};
@@ -0,0 +1,171 @@
+/*
+Copyright © 2023 Arvur GmbH / Robin Hasenbach.
+Released under GNU AGPLv3 License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "ModioAPIStructs.h"
+#include "ModioAPISubscriptionSyncObject.generated.h"
+
+class UModioAPIObject;
+class UAsyncAction_InstallModfile;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FModioAPI_OnSyncProgress, FModioAPI_SyncProgress, Progress);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FModioAPI_OnSyncModInstalled, FModioAPI_DownloadModfileMessage, Message);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FModioAPI_OnSyncCompleted, FModioAPI_SyncProgress, Progress, bool, bSuccess);
+
+/**
+ * Installs and updates all Mods the User is subscribed to.
+ * Subscriptions are compared against the installed Modfiles, Dependencies are installed before the Mods depending on them,
+ * and several Modfiles are downloaded and extracted at the same time. The Queue is kept on Disk, so a Sync interrupted by a Restart continues where it stopped.
+ */
+UCLASS(BlueprintType, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "mod.io Subscription Sync"))
+class MODIOAPI_API UModioAPISubscriptionSyncObject : public UObject
+{
+	GENERATED_BODY()
+
+	public:
+		UPROPERTY()
+		UModioAPIObject* ModioConnection;
+
+		/*
+		Requests the Subscriptions of the User and installs every Mod whose live Modfile isn't installed yet, including its Dependencies
+		Without Connection to mod.io, the Queue left over from the last Sync is installed
+		@param AccessToken The Access Token used as override. Only necessary if you disabled Automated Caching of Access Token when creating the mod.io API Connection!
+		@param Platform Platform whose live Modfiles are installed
+		*/
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Start Subscription Sync", AdvancedDisplay = "AccessToken"))
+		bool StartSync(FString AccessToken, TEnumAsByte<EModioAPI_Platforms> Platform, FString& Message);
+
+		// Cancels all running Installations, the Queue is kept for the next Sync
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Cancel Subscription Sync"))
+		void CancelSync();
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Is Subscription Sync running"))
+		bool IsSyncing();
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Get Subscription Sync Progress"))
+		FModioAPI_SyncProgress GetSyncProgress();
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Get Subscription Sync State"))
+		FModioAPI_SyncState GetSyncState();
+
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Is Modfile installed"))
+		bool IsModfileInstalled(int32 ModID, int32 ModfileID);
+
+		// Whether the Mod is installed or queued by the Sync, e.g. as a Dependency of a subscribed Mod. Such Mods are kept in the Cache
+		UFUNCTION(BlueprintPure, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Is Mod required"))
+		bool IsModRequired(int32 ModID);
+
+		// Modfiles downloaded and extracted at the same Time. The Bandwidth shared by all of them is limited by the global Download Rate Limit
+		UFUNCTION(BlueprintCallable, Category = "mod.io API|Subscription Sync", meta = (DisplayName = "Set max concurrent Installations"))
+		void SetMaxConcurrentInstalls(int32 MaxInstalls);
+
+		UPROPERTY(BlueprintAssignable, Category = "mod.io API|Subscription Sync")
+		FModioAPI_OnSyncProgress OnSyncProgress;
+
+		UPROPERTY(BlueprintAssignable, Category = "mod.io API|Subscription Sync")
+		FModioAPI_OnSyncModInstalled OnModInstalled;
+
+		// Broadcast once a Mod failed all its Attempts, or one of its Dependencies did
+		UPROPERTY(BlueprintAssignable, Category = "mod.io API|Subscription Sync")
+		FModioAPI_OnSyncModInstalled OnModFailed;
+
+		UPROPERTY(BlueprintAssignable, Category = "mod.io API|Subscription Sync")
+		FModioAPI_OnSyncCompleted OnSyncCompleted;
+
+	protected:
+		UFUNCTION()
+		void SubscriptionsReceived(FModioAPI_GetMods SubscribedMods, FModioAPI_Error_Object ErrorResponse);
+
+		UFUNCTION()
+		void DependenciesReceived(FModioAPI_GetModDependencies ModDependencies, FModioAPI_Error_Object ErrorResponse);
+
+		UFUNCTION()
+		void DependencyModReceived(FModioAPI_Mod Mod, FModioAPI_Error_Object ErrorResponse);
+
+		UFUNCTION()
+		void InstallProgress(FModioAPI_DownloadModfileMessage Message);
+
+		UFUNCTION()
+		void InstallFinished(FModioAPI_DownloadModfileMessage Message);
+
+		// Adds the Modfile to the Queue, unless it is already installed
+		bool EnqueueModfile(int32 ModID, const FModioAPI_Modfile& Modfile, bool bHasDependencies);
+
+		// Live Modfile of the Mod for the Platform of the Sync, or its primary one if that isn't cached
+		FModioAPI_Modfile GetLiveModfile(const FModioAPI_Mod& Mod);
+
+		FModioAPI_SyncQueueEntry* FindQueueEntry(int32 ModID);
+
+		// Dependencies that are still queued or being installed
+		int32 GetNumOfUnmetDependencies(const FModioAPI_SyncQueueEntry& Entry);
+
+		void RequestDependencies();
+
+		// Drops queued and installed Mods that are neither subscribed nor a Dependency of a subscribed Mod
+		void RemoveUnsubscribedMods();
+
+		// Fails every queued Mod with a failed Dependency
+		void FailDependents();
+
+		// Starts the Installations whose Dependencies are installed, until the Limit of concurrent Installations is reached
+		void ScheduleInstalls();
+
+		void StartInstall(int32 ModID);
+
+		void StopListening();
+
+		void FinishSync();
+
+		void UpdateProgress();
+
+		FString GetSyncStateFilePath();
+
+		bool SaveSyncStateToFile(FString& Message);
+
+		bool LoadSyncStateFromFile(FString& Message);
+
+		UPROPERTY()
+		FModioAPI_SyncState SyncState;
+
+		UPROPERTY()
+		FModioAPI_SyncProgress SyncProgress;
+
+		UPROPERTY()
+		TArray<UAsyncAction_InstallModfile*> RunningInstalls;
+
+		FString SyncAccessToken;
+		TEnumAsByte<EModioAPI_Platforms> SyncPlatform;
+
+		int32 MaxConcurrentInstalls = 2;
+		int32 MaxInstallAttempts = 3;
+
+		bool bSyncing = false;
+		bool bAwaitingSubscriptions = false;
+		bool bScheduling = false;
+		bool bSyncStateLoaded = false;
+
+		// Subscriptions received so far, the Queue is only reconciled once every Page arrived
+		TSet<int32> SubscribedModIDs;
+		int32 NextSubscriptionsOffset = 0;
+
+		// Key = Mod ID whose Dependencies were requested but not answered yet | Value = Offset of the requested Page
+		TMap<int32, int32> PendingDependencyRequests;
+
+		// Key = Mod ID of a Dependency whose Mod was requested | Value = its primary Modfile, queued if the Request fails
+		TMap<int32, FModioAPI_Modfile> PendingDependencyMods;
+
+		// Mods whose Dependencies couldn't be requested, they are installed without waiting for them
+		TSet<int32> UnresolvableDependencies;
+
+		// Key = Mod ID | Value = Bytes downloaded by its running Installation
+		TMap<int32, int64> BytesReceivedPerMod;
+
+		// Installed during the current Sync
+		int32 NumOfInstalled = 0;
+		int64 InstalledBytes = 0;
+};
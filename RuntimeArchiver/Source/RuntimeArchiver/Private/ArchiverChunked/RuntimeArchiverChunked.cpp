@@ -0,0 +1,866 @@
+﻿// Georgy Treshchev 2023.
+
+#include "ArchiverChunked/RuntimeArchiverChunked.h"
+#include "RuntimeArchiverDefines.h"
+#include "RuntimeArchiverUtilities.h"
+#include "ArchiverRaw/RuntimeArchiverRaw.h"
+#include "Streams/RuntimeArchiverFileStream.h"
+#include "Streams/RuntimeArchiverMappedFileStream.h"
+#include "Streams/RuntimeArchiverMemoryStream.h"
+#include "Async/ParallelFor.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/ByteSwap.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include <atomic>
+
+namespace
+{
+	/** Magic identifying the chunked archive, both at the beginning and at the end */
+	constexpr uint8 ChunkedMagic[4] = {'R', 'A', 'C', 'H'};
+
+	/** Version of the chunked archive layout */
+	constexpr uint32 ChunkedVersion = 1;
+
+	/** Chunked archive header. All values are little-endian */
+	struct FChunkedHeader
+	{
+		uint8 Magic[4];
+		uint32 Version;
+		uint32 RawFormat;
+		uint32 BlockSize;
+	};
+
+	/** Chunked archive footer, pointing to the block index and the entry table. All values are little-endian */
+	struct FChunkedFooter
+	{
+		uint64 TableOffset;
+		uint64 TableSize;
+		uint32 Version;
+		uint8 Magic[4];
+	};
+
+	static_assert(sizeof(FChunkedHeader) == 16, "Chunked header must be packed");
+	static_assert(sizeof(FChunkedFooter) == 24, "Chunked footer must be packed");
+
+	/** Minimum and maximum uncompressed block sizes */
+	constexpr int32 MinBlockSize = 4 * 1024;
+	constexpr int32 MaxBlockSize = 64 * 1024 * 1024;
+
+	/** Bytes a block takes in the table: offset, compressed and uncompressed size */
+	constexpr int64 SerializedBlockSize = sizeof(int64) + sizeof(uint32) + sizeof(uint32);
+
+	/** Bytes an entry takes in the table at least: name length, offset, size, creation ticks and the directory flag */
+	constexpr int64 MinSerializedEntrySize = sizeof(int32) + sizeof(int64) + sizeof(int64) + sizeof(int64) + sizeof(uint32);
+}
+
+URuntimeArchiverChunked::URuntimeArchiverChunked()
+	: RawFormat{ERuntimeArchiverRawFormat::LZ4}
+  , BlockSize{DefaultBlockSize}
+  , CompressionLevel{ERuntimeArchiverCompressionLevel::Compression6}
+  , TotalUncompressedSize{0}
+  , bIsFinalized{false}
+{
+}
+
+bool URuntimeArchiverChunked::CreateArchiveInStorage(FString ArchivePath)
+{
+	if (!Super::CreateArchiveInStorage(ArchivePath))
+	{
+		return false;
+	}
+
+	FPaths::NormalizeFilename(ArchivePath);
+
+	Stream.Reset(new FRuntimeArchiverFileStream(ArchivePath, true));
+
+	const FChunkedHeader Header{{ChunkedMagic[0], ChunkedMagic[1], ChunkedMagic[2], ChunkedMagic[3]}, INTEL_ORDER32(ChunkedVersion), INTEL_ORDER32(static_cast<uint32>(RawFormat)), INTEL_ORDER32(static_cast<uint32>(BlockSize))};
+
+	if (!Stream->IsValid() || !Stream->Write(&Header, sizeof(Header)))
+	{
+		ReportError(ERuntimeArchiverErrorCode::NotInitialized, FString::Printf(TEXT("Unable to open chunked archive '%s' for writing"), *ArchivePath));
+		Reset();
+		return false;
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully created chunked archive '%s' in '%s'"), *GetName(), *ArchivePath);
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::CreateArchiveInMemory(int32 InitialAllocationSize)
+{
+	if (!Super::CreateArchiveInMemory(InitialAllocationSize))
+	{
+		return false;
+	}
+
+	// The stream is not preallocated, since its size is used as the archive size
+	Stream.Reset(new FRuntimeArchiverMemoryStream(0));
+
+	const FChunkedHeader Header{{ChunkedMagic[0], ChunkedMagic[1], ChunkedMagic[2], ChunkedMagic[3]}, INTEL_ORDER32(ChunkedVersion), INTEL_ORDER32(static_cast<uint32>(RawFormat)), INTEL_ORDER32(static_cast<uint32>(BlockSize))};
+
+	if (!Stream->IsValid() || !Stream->Write(&Header, sizeof(Header)))
+	{
+		ReportError(ERuntimeArchiverErrorCode::NotInitialized, TEXT("Unable to initialize chunked archive in memory"));
+		Reset();
+		return false;
+	}
+
+	PendingData.Reserve(FMath::Min<int64>(InitialAllocationSize, BlockSize));
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully created chunked archive '%s' in memory"), *GetName());
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::OpenArchiveFromStorage(FString ArchivePath)
+{
+	if (!Super::OpenArchiveFromStorage(ArchivePath))
+	{
+		return false;
+	}
+
+	FPaths::NormalizeFilename(ArchivePath);
+
+	// Reading straight from the mapped file lets blocks be uncompressed in parallel without copying the compressed data
+	Stream.Reset(new FRuntimeArchiverMappedFileStream(ArchivePath));
+
+	if (!Stream->IsValid())
+	{
+		Stream.Reset(new FRuntimeArchiverFileStream(ArchivePath, false));
+	}
+
+	if (!Stream->IsValid() || !ReadTable())
+	{
+		ReportError(ERuntimeArchiverErrorCode::NotInitialized, FString::Printf(TEXT("Unable to open chunked archive '%s' to read"), *ArchivePath));
+		Reset();
+		return false;
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully opened chunked archive '%s' in '%s' to read. %d entries in %d blocks"), *GetName(), *ArchivePath, Entries.Num(), Blocks.Num());
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::OpenArchiveFromMemoryView(TArrayView64<const uint8> ArchiveData)
+{
+	if (!Super::OpenArchiveFromMemoryView(ArchiveData))
+	{
+		return false;
+	}
+
+	Stream.Reset(new FRuntimeArchiverMemoryStream(ArchiveData));
+
+	if (!Stream->IsValid() || !ReadTable())
+	{
+		ReportError(ERuntimeArchiverErrorCode::NotInitialized, TEXT("Unable to open in-memory chunked archive to read"));
+		Reset();
+		return false;
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully opened in-memory chunked archive '%s' to read. %d entries in %d blocks"), *GetName(), Entries.Num(), Blocks.Num());
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::CloseArchive()
+{
+	if (!Super::CloseArchive())
+	{
+		return false;
+	}
+
+	if (Mode == ERuntimeArchiverMode::Write && !Finalize())
+	{
+		ReportError(ERuntimeArchiverErrorCode::CloseError, TEXT("Unable to finalize chunked archive"));
+		Reset();
+		return false;
+	}
+
+	Reset();
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully closed chunked archive '%s'"), *GetName());
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::GetArchiveData(TArray64<uint8>& ArchiveData)
+{
+	if (!Super::GetArchiveData(ArchiveData))
+	{
+		return false;
+	}
+
+	if (Mode == ERuntimeArchiverMode::Write)
+	{
+		if (Location != ERuntimeArchiverLocation::Memory)
+		{
+			ReportError(ERuntimeArchiverErrorCode::UnsupportedLocation, TEXT("Unable to get chunked archive data because the archive is written directly to storage"));
+			return false;
+		}
+
+		if (!Finalize())
+		{
+			ReportError(ERuntimeArchiverErrorCode::GetError, TEXT("Unable to get chunked archive data because finalization failed"));
+			return false;
+		}
+	}
+
+	const int64 PreviousPosition{Stream->Tell()};
+
+	ArchiveData.SetNumUninitialized(Stream->Size());
+
+	if (!Stream->Seek(0) || !Stream->Read(ArchiveData.GetData(), ArchiveData.Num()) || !Stream->Seek(PreviousPosition))
+	{
+		ReportError(ERuntimeArchiverErrorCode::GetError, FString::Printf(TEXT("Unable to read chunked archive data with size '%lld'"), ArchiveData.Num()));
+		ArchiveData.Empty();
+		return false;
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully retrieved chunked archive data with size '%lld'"), ArchiveData.Num());
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::GetArchiveEntries(int32& NumOfArchiveEntries)
+{
+	if (!Super::GetArchiveEntries(NumOfArchiveEntries))
+	{
+		return false;
+	}
+
+	NumOfArchiveEntries = Entries.Num();
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully retrieved %d chunked entries"), NumOfArchiveEntries);
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::GetArchiveEntryInfoByName(FString EntryName, FRuntimeArchiveEntry& EntryInfo)
+{
+	if (!Super::GetArchiveEntryInfoByName(EntryName, EntryInfo))
+	{
+		return false;
+	}
+
+	FPaths::NormalizeFilename(EntryName);
+
+	const int32* EntryIndex{EntryIndicesByName.Find(EntryName)};
+	if (!EntryIndex)
+	{
+		ReportError(ERuntimeArchiverErrorCode::GetError, FString::Printf(TEXT("Unable to find the entry index under the entry name '%s'"), *EntryName));
+		return false;
+	}
+
+	ToEntry(*EntryIndex, EntryInfo);
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully retrieved chunked entry '%s' by name"), *EntryInfo.Name);
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::GetArchiveEntryInfoByIndex(int32 EntryIndex, FRuntimeArchiveEntry& EntryInfo)
+{
+	if (!Super::GetArchiveEntryInfoByIndex(EntryIndex, EntryInfo))
+	{
+		return false;
+	}
+
+	if (!Entries.IsValidIndex(EntryIndex))
+	{
+		ReportError(ERuntimeArchiverErrorCode::GetError, FString::Printf(TEXT("Chunked entry index %d is invalid. Min index: 0, Max index: %d"), EntryIndex, Entries.Num() - 1));
+		return false;
+	}
+
+	ToEntry(EntryIndex, EntryInfo);
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully retrieved chunked entry '%s' by index"), *EntryInfo.Name);
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::AddEntryFromMemory(FString EntryName, const TArray64<uint8>& DataToBeArchived, ERuntimeArchiverCompressionLevel InCompressionLevel)
+{
+	if (!Super::AddEntryFromMemory(EntryName, DataToBeArchived, InCompressionLevel))
+	{
+		return false;
+	}
+
+	if (bIsFinalized)
+	{
+		ReportError(ERuntimeArchiverErrorCode::AddError, FString::Printf(TEXT("Unable to add entry '%s' because the chunked archive has already been finalized"), *EntryName));
+		return false;
+	}
+
+	FPaths::NormalizeFilename(EntryName);
+
+	const FDateTime CreationTime{FDateTime::Now()};
+
+	// Adding parent directory entries, so that the directory structure can be restored without parsing entry names
+	for (FString& Directory : URuntimeArchiverUtilities::ParseDirectories(EntryName))
+	{
+		if (!EntryIndicesByName.Contains(Directory))
+		{
+			EntryIndicesByName.Add(Directory, Entries.Num());
+			Entries.Add(FRuntimeArchiverChunkedEntry{MoveTemp(Directory), TotalUncompressedSize, 0, CreationTime, true});
+		}
+	}
+
+	// Blocks filled from now on are compressed with the level of this entry
+	CompressionLevel = InCompressionLevel;
+
+	const int64 EntryOffset{TotalUncompressedSize};
+
+	if (!AppendData(DataToBeArchived.GetData(), DataToBeArchived.Num()))
+	{
+		ReportError(ERuntimeArchiverErrorCode::AddError, FString::Printf(TEXT("Unable to write data for entry '%s' from memory"), *EntryName));
+		return false;
+	}
+
+	if (!EntryIndicesByName.Contains(EntryName))
+	{
+		EntryIndicesByName.Add(EntryName, Entries.Num());
+	}
+
+	Entries.Add(FRuntimeArchiverChunkedEntry{EntryName, EntryOffset, DataToBeArchived.Num(), CreationTime, false});
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully added chunked entry '%s' with size %lld bytes from memory"), *EntryName, DataToBeArchived.Num());
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::ExtractEntryToMemory(const FRuntimeArchiveEntry& EntryInfo, TArray64<uint8>& UnarchivedData)
+{
+	if (!Super::ExtractEntryToMemory(EntryInfo, UnarchivedData))
+	{
+		return false;
+	}
+
+	if (!Entries.IsValidIndex(EntryInfo.Index))
+	{
+		ReportError(ERuntimeArchiverErrorCode::InvalidArgument, FString::Printf(TEXT("Chunked entry index %d is invalid. Min index: 0, Max index: %d"), EntryInfo.Index, Entries.Num() - 1));
+		return false;
+	}
+
+	const FRuntimeArchiverChunkedEntry& Entry{Entries[EntryInfo.Index]};
+
+	UnarchivedData.SetNumUninitialized(Entry.Size);
+	int64 UnarchivedSize{0};
+
+	const bool bSuccess{ReadEntryData(Entry, [&UnarchivedData, &UnarchivedSize](const uint8* Data, int64 Size)
+	{
+		FMemory::Memcpy(UnarchivedData.GetData() + UnarchivedSize, Data, Size);
+		UnarchivedSize += Size;
+		return true;
+	})};
+
+	if (!bSuccess)
+	{
+		ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to read data from chunked entry '%s' to write into memory"), *Entry.Name));
+		UnarchivedData.Empty();
+		return false;
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully extracted chunked entry '%s' into memory"), *Entry.Name);
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::ExtractEntryToFileHandle(const FRuntimeArchiveEntry& EntryInfo, IFileHandle& FileHandle)
+{
+	if (!IsInitialized() || Mode != ERuntimeArchiverMode::Read || EntryInfo.bIsDirectory || !Entries.IsValidIndex(EntryInfo.Index))
+	{
+		return Super::ExtractEntryToFileHandle(EntryInfo, FileHandle);
+	}
+
+	const FRuntimeArchiverChunkedEntry& Entry{Entries[EntryInfo.Index]};
+
+	// Writing batches of uncompressed blocks as they are ready, so the entry is never held in memory as a whole
+	const bool bSuccess{ReadEntryData(Entry, [&FileHandle](const uint8* Data, int64 Size)
+	{
+		return FileHandle.Write(Data, Size);
+	})};
+
+	if (!bSuccess)
+	{
+		ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to write the chunked entry '%s' to file"), *Entry.Name));
+		return false;
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully extracted chunked entry '%s' into file"), *Entry.Name);
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::Initialize()
+{
+	if (!Super::Initialize())
+	{
+		return false;
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully initialized chunked archiver '%s'"), *GetName());
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::IsInitialized() const
+{
+	return Super::IsInitialized() && Stream.IsValid() && Stream->IsValid();
+}
+
+void URuntimeArchiverChunked::Reset()
+{
+	// Making sure the archive being written is complete, the same way the tar archiver does
+	if (Stream.IsValid() && Stream->IsWrite() && Stream->IsValid())
+	{
+		Finalize();
+	}
+
+	Stream.Reset();
+	Blocks.Empty();
+	Entries.Empty();
+	EntryIndicesByName.Empty();
+	PendingData.Empty();
+	TotalUncompressedSize = 0;
+	bIsFinalized = false;
+
+	// Settings taken from an archive opened to read must not carry over to the next archive
+	RawFormat = ERuntimeArchiverRawFormat::LZ4;
+	BlockSize = DefaultBlockSize;
+
+	Super::Reset();
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully uninitialized chunked archiver '%s'"), *GetName());
+}
+
+void URuntimeArchiverChunked::ReportError(ERuntimeArchiverErrorCode ErrorCode, const FString& ErrorString) const
+{
+	Super::ReportError(ErrorCode, ErrorString);
+}
+
+void URuntimeArchiverChunked::SetRawFormat(ERuntimeArchiverRawFormat NewRawFormat)
+{
+	// The header of an archive being written already contains the format, and an archive being read depends on the format it was created with
+	if (IsInitialized())
+	{
+		ReportError(ERuntimeArchiverErrorCode::UnsupportedMode, TEXT("Unable to set the raw format while a chunked archive is open"));
+		return;
+	}
+
+	RawFormat = NewRawFormat;
+}
+
+void URuntimeArchiverChunked::SetBlockSize(int32 NewBlockSize)
+{
+	if (IsInitialized())
+	{
+		ReportError(ERuntimeArchiverErrorCode::UnsupportedMode, TEXT("Unable to set the block size while a chunked archive is open"));
+		return;
+	}
+
+	BlockSize = FMath::Clamp(NewBlockSize, MinBlockSize, MaxBlockSize);
+}
+
+bool URuntimeArchiverChunked::AppendData(const uint8* Data, int64 Size)
+{
+	const int64 BatchSize{static_cast<int64>(BlockSize) * GetNumOfWorkers(TNumericLimits<int32>::Max())};
+
+	while (Size > 0)
+	{
+		// Collecting enough full blocks to keep all workers busy
+		const int64 SizeToAppend{FMath::Min<int64>(Size, FMath::Max<int64>(BatchSize - PendingData.Num(), 1))};
+		PendingData.Append(Data, SizeToAppend);
+
+		Data += SizeToAppend;
+		Size -= SizeToAppend;
+		TotalUncompressedSize += SizeToAppend;
+
+		if (PendingData.Num() >= BatchSize && !WritePendingBlocks(false))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::WritePendingBlocks(bool bIncludePartialBlock)
+{
+	const int32 NumOfBlocks{static_cast<int32>(bIncludePartialBlock ? FMath::DivideAndRoundUp<int64>(PendingData.Num(), BlockSize) : PendingData.Num() / BlockSize)};
+	if (NumOfBlocks <= 0)
+	{
+		return true;
+	}
+
+	TArray<TArray64<uint8>> CompressedBlocks;
+	CompressedBlocks.SetNum(NumOfBlocks);
+
+	const int32 NumOfWorkers{GetNumOfWorkers(NumOfBlocks)};
+
+	// Blocks are independent, so they are compressed concurrently
+	if (CompressionLevel != ERuntimeArchiverCompressionLevel::Compression0)
+	{
+		ParallelFor(NumOfBlocks, [&](int32 BlockIndex)
+		{
+			const int64 BlockOffset{static_cast<int64>(BlockIndex) * BlockSize};
+			const int64 UncompressedBlockSize{FMath::Min<int64>(BlockSize, PendingData.Num() - BlockOffset)};
+
+			if (!URuntimeArchiverRaw::CompressRawBlock(RawFormat, CompressionLevel, PendingData.GetData() + BlockOffset, UncompressedBlockSize, CompressedBlocks[BlockIndex]) || CompressedBlocks[BlockIndex].Num() >= UncompressedBlockSize)
+			{
+				// Storing the block as is if compression failed or did not reduce the size
+				CompressedBlocks[BlockIndex].Empty();
+			}
+		}, NumOfWorkers <= 1);
+	}
+
+	// Writing in order, since the block index refers to the positions of the blocks
+	for (int32 BlockIndex = 0; BlockIndex < NumOfBlocks; ++BlockIndex)
+	{
+		const int64 BlockOffset{static_cast<int64>(BlockIndex) * BlockSize};
+		const int64 UncompressedBlockSize{FMath::Min<int64>(BlockSize, PendingData.Num() - BlockOffset)};
+
+		const bool bStored{CompressedBlocks[BlockIndex].Num() == 0};
+		const uint8* BlockData{bStored ? PendingData.GetData() + BlockOffset : CompressedBlocks[BlockIndex].GetData()};
+		const int64 CompressedBlockSize{bStored ? UncompressedBlockSize : CompressedBlocks[BlockIndex].Num()};
+
+		const int64 StreamOffset{Stream->Tell()};
+		if (!Stream->Write(BlockData, CompressedBlockSize))
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to write chunked block with size %lld"), CompressedBlockSize);
+			return false;
+		}
+
+		Blocks.Add(FRuntimeArchiverChunkedBlock{StreamOffset, static_cast<uint32>(CompressedBlockSize), static_cast<uint32>(UncompressedBlockSize)});
+	}
+
+	PendingData.RemoveAt(0, FMath::Min<int64>(static_cast<int64>(NumOfBlocks) * BlockSize, PendingData.Num()), false);
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::Finalize()
+{
+	if (bIsFinalized)
+	{
+		return true;
+	}
+
+	bIsFinalized = true;
+
+	if (!WritePendingBlocks(true))
+	{
+		return false;
+	}
+
+	TArray<uint8> TableData;
+	{
+		FMemoryWriter TableWriter(TableData);
+
+		int32 NumOfBlocks{Blocks.Num()};
+		TableWriter << NumOfBlocks;
+
+		for (FRuntimeArchiverChunkedBlock& Block : Blocks)
+		{
+			TableWriter << Block.Offset;
+			TableWriter << Block.CompressedSize;
+			TableWriter << Block.UncompressedSize;
+		}
+
+		int32 NumOfEntries{Entries.Num()};
+		TableWriter << NumOfEntries;
+
+		for (FRuntimeArchiverChunkedEntry& Entry : Entries)
+		{
+			int64 CreationTicks{Entry.CreationTime.GetTicks()};
+
+			TableWriter << Entry.Name;
+			TableWriter << Entry.Offset;
+			TableWriter << Entry.Size;
+			TableWriter << CreationTicks;
+			TableWriter << Entry.bIsDirectory;
+		}
+	}
+
+	const uint64 TableOffset{static_cast<uint64>(Stream->Tell())};
+
+	const FChunkedFooter Footer{INTEL_ORDER64(TableOffset), INTEL_ORDER64(static_cast<uint64>(TableData.Num())), INTEL_ORDER32(ChunkedVersion), {ChunkedMagic[0], ChunkedMagic[1], ChunkedMagic[2], ChunkedMagic[3]}};
+
+	if (!Stream->Write(TableData.GetData(), TableData.Num()) || !Stream->Write(&Footer, sizeof(Footer)) || !Stream->Finish())
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to write chunked archive table"));
+		return false;
+	}
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::ReadTable()
+{
+	const int64 ArchiveSize{Stream->Size()};
+	if (ArchiveSize < static_cast<int64>(sizeof(FChunkedHeader) + sizeof(FChunkedFooter)))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked archive because it is too small (%lld bytes)"), ArchiveSize);
+		return false;
+	}
+
+	FChunkedHeader Header;
+	FChunkedFooter Footer;
+
+	if (!Stream->Seek(0) || !Stream->Read(&Header, sizeof(Header)) || !Stream->Seek(ArchiveSize - sizeof(Footer)) || !Stream->Read(&Footer, sizeof(Footer)))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked archive header and footer"));
+		return false;
+	}
+
+	if (FMemory::Memcmp(Header.Magic, ChunkedMagic, sizeof(ChunkedMagic)) != 0 || FMemory::Memcmp(Footer.Magic, ChunkedMagic, sizeof(ChunkedMagic)) != 0)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked archive because the data is not in chunked format"));
+		return false;
+	}
+
+	if (INTEL_ORDER32(Header.Version) != ChunkedVersion || INTEL_ORDER32(Footer.Version) != ChunkedVersion)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked archive because its version %u is not supported"), INTEL_ORDER32(Header.Version));
+		return false;
+	}
+
+	const uint32 RawFormatValue{INTEL_ORDER32(Header.RawFormat)};
+	if (RawFormatValue > static_cast<uint32>(ERuntimeArchiverRawFormat::LZ4))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked archive because its raw format %u is unknown"), RawFormatValue);
+		return false;
+	}
+
+	RawFormat = static_cast<ERuntimeArchiverRawFormat>(RawFormatValue);
+	BlockSize = static_cast<int32>(INTEL_ORDER32(Header.BlockSize));
+
+	const int64 TableOffset{static_cast<int64>(INTEL_ORDER64(Footer.TableOffset))};
+	const int64 TableSize{static_cast<int64>(INTEL_ORDER64(Footer.TableSize))};
+
+	if (BlockSize < MinBlockSize || BlockSize > MaxBlockSize || TableOffset < static_cast<int64>(sizeof(FChunkedHeader)) || TableSize < 0 || TableSize > TNumericLimits<int32>::Max() || TableOffset + TableSize != ArchiveSize - static_cast<int64>(sizeof(FChunkedFooter)))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked archive because its table is corrupted"));
+		return false;
+	}
+
+	TArray<uint8> TableData;
+	TableData.SetNumUninitialized(static_cast<int32>(TableSize));
+
+	if (!Stream->Seek(TableOffset) || !Stream->Read(TableData.GetData(), TableData.Num()))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked archive table"));
+		return false;
+	}
+
+	FMemoryReader TableReader(TableData);
+
+	int32 NumOfBlocks{0};
+	TableReader << NumOfBlocks;
+
+	// The count is checked against the table size before allocating, so a corrupted count can't request huge allocations
+	if (NumOfBlocks < 0 || TableReader.IsError() || NumOfBlocks > (TableReader.TotalSize() - TableReader.Tell()) / SerializedBlockSize)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked archive because its number of blocks %d is corrupted"), NumOfBlocks);
+		return false;
+	}
+
+	Blocks.SetNum(NumOfBlocks);
+	int64 NumOfUncompressedBytes{0};
+
+	// Blocks are written back to back right after the header, which reading batches of blocks relies on
+	int64 ExpectedBlockOffset{static_cast<int64>(sizeof(FChunkedHeader))};
+
+	for (int32 BlockIndex = 0; BlockIndex < NumOfBlocks; ++BlockIndex)
+	{
+		FRuntimeArchiverChunkedBlock& Block{Blocks[BlockIndex]};
+
+		TableReader << Block.Offset;
+		TableReader << Block.CompressedSize;
+		TableReader << Block.UncompressedSize;
+
+		// All blocks except the last one must be full, so that a position can be mapped to a block directly
+		const bool bValidSize{Block.UncompressedSize > 0 && (Block.UncompressedSize == static_cast<uint32>(BlockSize) || (BlockIndex == NumOfBlocks - 1 && Block.UncompressedSize < static_cast<uint32>(BlockSize)))};
+
+		if (TableReader.IsError() || !bValidSize || Block.CompressedSize == 0 || Block.CompressedSize > Block.UncompressedSize || Block.Offset != ExpectedBlockOffset || Block.Offset + Block.CompressedSize > TableOffset)
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked archive because block %d is corrupted"), BlockIndex);
+			return false;
+		}
+
+		ExpectedBlockOffset = Block.Offset + Block.CompressedSize;
+		NumOfUncompressedBytes += Block.UncompressedSize;
+	}
+
+	// The table follows the last block directly
+	if (ExpectedBlockOffset != TableOffset)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked archive because its blocks do not end where the table starts"));
+		return false;
+	}
+
+	int32 NumOfEntries{0};
+	TableReader << NumOfEntries;
+
+	if (NumOfEntries < 0 || TableReader.IsError() || NumOfEntries > (TableReader.TotalSize() - TableReader.Tell()) / MinSerializedEntrySize)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked archive because its number of entries %d is corrupted"), NumOfEntries);
+		return false;
+	}
+
+	Entries.SetNum(NumOfEntries);
+	EntryIndicesByName.Reserve(NumOfEntries);
+
+	for (int32 EntryIndex = 0; EntryIndex < NumOfEntries; ++EntryIndex)
+	{
+		FRuntimeArchiverChunkedEntry& Entry{Entries[EntryIndex]};
+		int64 CreationTicks{0};
+
+		TableReader << Entry.Name;
+		TableReader << Entry.Offset;
+		TableReader << Entry.Size;
+		TableReader << CreationTicks;
+		TableReader << Entry.bIsDirectory;
+
+		if (TableReader.IsError() || Entry.Offset < 0 || Entry.Size < 0 || Entry.Offset + Entry.Size > NumOfUncompressedBytes)
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked archive because entry %d is corrupted"), EntryIndex);
+			return false;
+		}
+
+		Entry.CreationTime = FDateTime(CreationTicks);
+
+		if (!EntryIndicesByName.Contains(Entry.Name))
+		{
+			EntryIndicesByName.Add(Entry.Name, EntryIndex);
+		}
+	}
+
+	TotalUncompressedSize = NumOfUncompressedBytes;
+
+	return true;
+}
+
+bool URuntimeArchiverChunked::ReadEntryData(const FRuntimeArchiverChunkedEntry& Entry, TFunctionRef<bool(const uint8*, int64)> Consumer)
+{
+	if (Entry.Size == 0)
+	{
+		return true;
+	}
+
+	const int32 FirstBlockIndex{static_cast<int32>(Entry.Offset / BlockSize)};
+	const int32 LastBlockIndex{static_cast<int32>((Entry.Offset + Entry.Size - 1) / BlockSize)};
+
+	if (!Blocks.IsValidIndex(FirstBlockIndex) || !Blocks.IsValidIndex(LastBlockIndex))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Chunked entry '%s' refers to blocks outside of the archive"), *Entry.Name);
+		return false;
+	}
+
+	const int32 NumOfWorkers{GetNumOfWorkers(LastBlockIndex - FirstBlockIndex + 1)};
+
+	// Streams backed by memory (including mapped files) are read without copying
+	const uint8* StreamData{Stream->GetData()};
+
+	TArray64<uint8> CompressedData;
+	TArray<TArray64<uint8>> UncompressedBlocks;
+
+	for (int32 BatchFirstIndex = FirstBlockIndex; BatchFirstIndex <= LastBlockIndex; BatchFirstIndex += NumOfWorkers)
+	{
+		const int32 BatchLastIndex{FMath::Min(BatchFirstIndex + NumOfWorkers - 1, LastBlockIndex)};
+		const int32 NumOfBatchBlocks{BatchLastIndex - BatchFirstIndex + 1};
+
+		// Blocks are stored back to back, so the compressed data of a batch is contiguous
+		const int64 CompressedOffset{Blocks[BatchFirstIndex].Offset};
+		const uint8* BatchCompressedData{StreamData ? StreamData + CompressedOffset : nullptr};
+
+		if (!BatchCompressedData)
+		{
+			CompressedData.SetNumUninitialized(Blocks[BatchLastIndex].Offset + Blocks[BatchLastIndex].CompressedSize - CompressedOffset, false);
+
+			if (!Stream->Seek(CompressedOffset) || !Stream->Read(CompressedData.GetData(), CompressedData.Num()))
+			{
+				UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read chunked blocks at offset %lld"), CompressedOffset);
+				return false;
+			}
+
+			BatchCompressedData = CompressedData.GetData();
+		}
+
+		UncompressedBlocks.SetNum(NumOfBatchBlocks);
+		std::atomic<bool> bFailed{false};
+
+		ParallelFor(NumOfBatchBlocks, [&](int32 BatchIndex)
+		{
+			const FRuntimeArchiverChunkedBlock& Block{Blocks[BatchFirstIndex + BatchIndex]};
+			const uint8* BlockCompressedData{BatchCompressedData + (Block.Offset - CompressedOffset)};
+
+			TArray64<uint8>& UncompressedBlock{UncompressedBlocks[BatchIndex]};
+			UncompressedBlock.SetNumUninitialized(Block.UncompressedSize, false);
+
+			// Blocks that did not benefit from compression are stored as is
+			if (Block.CompressedSize == Block.UncompressedSize)
+			{
+				FMemory::Memcpy(UncompressedBlock.GetData(), BlockCompressedData, Block.UncompressedSize);
+			}
+			else if (!URuntimeArchiverRaw::UncompressRawBlock(RawFormat, BlockCompressedData, Block.CompressedSize, UncompressedBlock.GetData(), Block.UncompressedSize))
+			{
+				bFailed = true;
+			}
+		}, NumOfWorkers <= 1);
+
+		if (bFailed)
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to uncompress chunked blocks %d-%d"), BatchFirstIndex, BatchLastIndex);
+			return false;
+		}
+
+		// Passing only the part of each block that belongs to the entry
+		for (int32 BatchIndex = 0; BatchIndex < NumOfBatchBlocks; ++BatchIndex)
+		{
+			const int64 BlockStart{static_cast<int64>(BatchFirstIndex + BatchIndex) * BlockSize};
+			const int64 DataStart{FMath::Max(Entry.Offset, BlockStart) - BlockStart};
+			const int64 DataEnd{FMath::Min(Entry.Offset + Entry.Size, BlockStart + UncompressedBlocks[BatchIndex].Num()) - BlockStart};
+
+			if (!Consumer(UncompressedBlocks[BatchIndex].GetData() + DataStart, DataEnd - DataStart))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void URuntimeArchiverChunked::ToEntry(int32 EntryIndex, FRuntimeArchiveEntry& EntryInfo) const
+{
+	const FRuntimeArchiverChunkedEntry& Entry{Entries[EntryIndex]};
+
+	EntryInfo = FRuntimeArchiveEntry(EntryIndex);
+	EntryInfo.Name = Entry.Name;
+	EntryInfo.bIsDirectory = Entry.bIsDirectory;
+	EntryInfo.UncompressedSize = Entry.Size;
+	EntryInfo.CreationTime = Entry.CreationTime;
+
+	// Entries share blocks, so the compressed size is estimated from the portion of each block covered by the entry
+	if (Entry.Size > 0 && BlockSize > 0)
+	{
+		double CompressedSize{0};
+
+		const int32 FirstBlockIndex{static_cast<int32>(Entry.Offset / BlockSize)};
+		const int32 LastBlockIndex{static_cast<int32>((Entry.Offset + Entry.Size - 1) / BlockSize)};
+
+		for (int32 BlockIndex = FirstBlockIndex; BlockIndex <= LastBlockIndex && Blocks.IsValidIndex(BlockIndex); ++BlockIndex)
+		{
+			const FRuntimeArchiverChunkedBlock& Block{Blocks[BlockIndex]};
+			const int64 BlockStart{static_cast<int64>(BlockIndex) * BlockSize};
+			const int64 CoveredSize{FMath::Min(Entry.Offset + Entry.Size, BlockStart + Block.UncompressedSize) - FMath::Max(Entry.Offset, BlockStart)};
+
+			CompressedSize += static_cast<double>(Block.CompressedSize) * CoveredSize / Block.UncompressedSize;
+		}
+
+		EntryInfo.CompressedSize = static_cast<int64>(CompressedSize);
+	}
+}
@@ -3,13 +3,14 @@
 #include "ArchiverGZip/RuntimeArchiverGZip.h"
 #include "RuntimeArchiverDefines.h"
 #include "RuntimeArchiverUtilities.h"
-#include "ArchiverRaw/RuntimeArchiverRaw.h"
 #include "ArchiverTar/RuntimeArchiverTar.h"
 #include "Streams/RuntimeArchiverFileStream.h"
 #include "Streams/RuntimeArchiverMemoryStream.h"
+#include "Streams/RuntimeArchiverGZipStream.h"
 
 URuntimeArchiverGZip::URuntimeArchiverGZip()
-	: LastCompressionLevel{ERuntimeArchiverCompressionLevel::Compression6}
+	: GZipStream{nullptr}
+  , LastCompressionLevel{ERuntimeArchiverCompressionLevel::Compression6}
 {
 }
 
@@ -28,7 +29,8 @@ bool URuntimeArchiverGZip::CreateArchiveInStorage(FString ArchivePath)
 		return false;
 	}
 
-	if (!TarArchiver->CreateArchiveInMemory(0))
+	// Compressing the tar data while it is being written, so that the archive is never held in memory
+	if (!OpenTarArchiveFromCompressedStream())
 	{
 		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to create gzip archive in storage '%s' due to tar archiver error"), *ArchivePath);
 		Reset();
@@ -78,38 +80,21 @@ bool URuntimeArchiverGZip::OpenArchiveFromStorage(FString ArchivePath)
 		return false;
 	}
 
-	TArray64<uint8> CompressedArchiveData;
-	CompressedArchiveData.SetNumUninitialized(CompressedStream->Size());
-
-	if (!CompressedStream->Read(CompressedArchiveData.GetData(), CompressedArchiveData.Num()))
-	{
-		ReportError(ERuntimeArchiverErrorCode::GetError, TEXT("Unable to read gzip compressed stream to get archive data"));
-		Reset();
-		return false;
-	}
-
-	TArray64<uint8> TarArchiveData;
-	if (!URuntimeArchiverRaw::UncompressRawData(ERuntimeArchiverRawFormat::GZip, MoveTemp(CompressedArchiveData), TarArchiveData))
-	{
-		ReportError(ERuntimeArchiverErrorCode::GetError, FString::Printf(TEXT("Unable to uncompress gzip to tar data to open archive from storage '%s'"), *ArchivePath));
-		Reset();
-		return false;
-	}
-
-	if (!TarArchiver->OpenArchiveFromMemory(TarArchiveData))
+	// The data is inflated only when the tar archiver reads it, so the archive is never held in memory
+	if (!OpenTarArchiveFromCompressedStream())
 	{
 		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open gzip archive from storage due to tar archiver error"));
 		Reset();
 		return false;
 	}
 
-	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully opened gzip archive '%s' in '%s' to read"), *GetName(), *ArchivePath);
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully opened gzip archive '%s' in '%s' to read. Compressed size %lld"), *GetName(), *ArchivePath, CompressedStream->Size());
 	return true;
 }
 
-bool URuntimeArchiverGZip::OpenArchiveFromMemory(const TArray64<uint8>& ArchiveData)
+bool URuntimeArchiverGZip::OpenArchiveFromMemoryView(TArrayView64<const uint8> ArchiveData)
 {
-	if (!Super::OpenArchiveFromMemory(ArchiveData))
+	if (!Super::OpenArchiveFromMemoryView(ArchiveData))
 	{
 		return false;
 	}
@@ -122,15 +107,7 @@ bool URuntimeArchiverGZip::OpenArchiveFromMemory(const TArray64<uint8>& ArchiveD
 		return false;
 	}
 
-	TArray64<uint8> TarArchiveData;
-	if (!URuntimeArchiverRaw::UncompressRawData(ERuntimeArchiverRawFormat::GZip, ArchiveData, TarArchiveData))
-	{
-		ReportError(ERuntimeArchiverErrorCode::GetError, TEXT("Unable to uncompress gzip to tar data to open archive from memory"));
-		Reset();
-		return false;
-	}
-
-	if (!TarArchiver->OpenArchiveFromMemory(TarArchiveData))
+	if (!OpenTarArchiveFromCompressedStream())
 	{
 		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open gzip archive from memory due to tar archiver error"));
 		Reset();
@@ -148,28 +125,7 @@ bool URuntimeArchiverGZip::CloseArchive()
 		return false;
 	}
 
-	if (Mode == ERuntimeArchiverMode::Write && Location == ERuntimeArchiverLocation::Storage)
-	{
-		TArray64<uint8> ArchiveData;
-		if (!GetArchiveData(ArchiveData))
-		{
-			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to get archive data to close archive"));
-			return false;
-		}
-
-		if (!CompressedStream->Seek(0))
-		{
-			ReportError(ERuntimeArchiverErrorCode::CloseError, TEXT("Unable to seek first position in gzip archive to close archive"));
-			return false;
-		}
-
-		if (!CompressedStream->Write(ArchiveData.GetData(), ArchiveData.Num()))
-		{
-			ReportError(ERuntimeArchiverErrorCode::CloseError, TEXT("Unable to write archive data to gzip compressed stream to close archive"));
-			return false;
-		}
-	}
-
+	// Closing the tar archiver also finishes the gzip stream, writing the remaining compressed data and the trailer
 	if (!TarArchiver->CloseArchive())
 	{
 		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to close gzip archive due to tar archiver error"));
@@ -192,7 +148,7 @@ bool URuntimeArchiverGZip::GetArchiveData(TArray64<uint8>& ArchiveData)
 	{
 		ArchiveData.SetNumUninitialized(CompressedStream->Size());
 
-		if (!CompressedStream->Read(ArchiveData.GetData(), ArchiveData.Num()))
+		if (!CompressedStream->Seek(0) || !CompressedStream->Read(ArchiveData.GetData(), ArchiveData.Num()))
 		{
 			ReportError(ERuntimeArchiverErrorCode::GetError, TEXT("Unable to read gzip compressed stream to get archive data"));
 			return false;
@@ -200,6 +156,12 @@ bool URuntimeArchiverGZip::GetArchiveData(TArray64<uint8>& ArchiveData)
 	}
 	else if (Mode == ERuntimeArchiverMode::Write)
 	{
+		if (Location != ERuntimeArchiverLocation::Memory)
+		{
+			ReportError(ERuntimeArchiverErrorCode::UnsupportedLocation, TEXT("Unable to get gzip archive data because the archive is written directly to storage"));
+			return false;
+		}
+
 		TArray64<uint8> TarArchiveData;
 		if (!TarArchiver->GetArchiveData(TarArchiveData))
 		{
@@ -207,11 +169,17 @@ bool URuntimeArchiverGZip::GetArchiveData(TArray64<uint8>& ArchiveData)
 			return false;
 		}
 
-		if (!URuntimeArchiverRaw::CompressRawData(ERuntimeArchiverRawFormat::GZip, LastCompressionLevel, TarArchiveData, ArchiveData))
+		FRuntimeArchiverMemoryStream ArchiveStream(0);
 		{
-			ReportError(ERuntimeArchiverErrorCode::GetError, TEXT("Unable to compress tar to gzip data to get archive data"));
-			return false;
+			FRuntimeArchiverGZipStream ArchiveGZipStream(ArchiveStream, LastCompressionLevel);
+			if (!ArchiveGZipStream.Write(TarArchiveData.GetData(), TarArchiveData.Num()) || !ArchiveGZipStream.Finish())
+			{
+				ReportError(ERuntimeArchiverErrorCode::GetError, TEXT("Unable to compress tar to gzip data to get archive data"));
+				return false;
+			}
 		}
+
+		ArchiveData = TArray64<uint8>(ArchiveStream.GetData(), ArchiveStream.Size());
 	}
 
 	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully retrieved gzip archive data from memory with size '%lld'"), ArchiveData.Num());
@@ -276,6 +244,12 @@ bool URuntimeArchiverGZip::AddEntryFromMemory(FString EntryName, const TArray64<
 		return false;
 	}
 
+	// The compression level can only be applied before the first entry is deflated
+	if (GZipStream)
+	{
+		GZipStream->SetCompressionLevel(CompressionLevel);
+	}
+
 	if (!TarArchiver->AddEntryFromMemory(EntryName, DataToBeArchived, CompressionLevel))
 	{
 		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to add gzip entry due to tar archiver error"));
@@ -283,7 +257,6 @@ bool URuntimeArchiverGZip::AddEntryFromMemory(FString EntryName, const TArray64<
 	}
 
 	LastCompressionLevel = CompressionLevel;
-
 	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully added gzip entry '%s' with size %lld bytes from memory"), *EntryName, DataToBeArchived.Num());
 	return true;
 }
@@ -335,6 +308,8 @@ void URuntimeArchiverGZip::Reset()
 		TarArchiver.Reset();
 	}
 
+	// The gzip stream is owned by the tar archiver and refers to the compressed stream, so it is destroyed first
+	GZipStream = nullptr;
 	CompressedStream.Reset();
 	Super::Reset();
 	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully uninitialized gzip archiver '%s'"), *GetName());
@@ -344,3 +319,15 @@ void URuntimeArchiverGZip::ReportError(ERuntimeArchiverErrorCode ErrorCode, cons
 {
 	Super::ReportError(ErrorCode, ErrorString);
 }
+
+bool URuntimeArchiverGZip::OpenTarArchiveFromCompressedStream()
+{
+	GZipStream = new FRuntimeArchiverGZipStream(*CompressedStream, LastCompressionLevel);
+	if (!TarArchiver->OpenArchiveFromStream(TUniquePtr<FRuntimeArchiverBaseStream>(GZipStream), Location))
+	{
+		GZipStream = nullptr;
+		return false;
+	}
+
+	return true;
+}
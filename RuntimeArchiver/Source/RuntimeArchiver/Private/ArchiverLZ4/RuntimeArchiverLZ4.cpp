@@ -7,9 +7,11 @@
 #include "ArchiverTar/RuntimeArchiverTar.h"
 #include "Streams/RuntimeArchiverFileStream.h"
 #include "Streams/RuntimeArchiverMemoryStream.h"
+#include "Streams/RuntimeArchiverRawBlockStream.h"
 
 URuntimeArchiverLZ4::URuntimeArchiverLZ4()
-	: LastCompressionLevel{ERuntimeArchiverCompressionLevel::Compression6}
+	: BlockStream{nullptr}
+  , LastCompressionLevel{ERuntimeArchiverCompressionLevel::Compression6}
 {
 }
 
@@ -28,7 +30,8 @@ bool URuntimeArchiverLZ4::CreateArchiveInStorage(FString ArchivePath)
 		return false;
 	}
 
-	if (!TarArchiver->CreateArchiveInMemory(0))
+	// Compressing the tar data while it is being written, so that the archive is never held in memory
+	if (!OpenTarArchiveFromCompressedStream())
 	{
 		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to create lz4 archive in storage '%s' due to tar archiver error"), *ArchivePath);
 		Reset();
@@ -78,6 +81,21 @@ bool URuntimeArchiverLZ4::OpenArchiveFromStorage(FString ArchivePath)
 		return false;
 	}
 
+	// Blocks are uncompressed only when the tar archiver reads them, so the archive is never held in memory
+	if (FRuntimeArchiverRawBlockStream::IsBlockStream(*CompressedStream))
+	{
+		if (!OpenTarArchiveFromCompressedStream())
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open lz4 archive from storage due to tar archiver error"));
+			Reset();
+			return false;
+		}
+
+		UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully opened lz4 archive '%s' in '%s' to read. Compressed size %lld"), *GetName(), *ArchivePath, CompressedStream->Size());
+		return true;
+	}
+
+	// Archives written before the block format was introduced are compressed as a single block
 	TArray64<uint8> CompressedArchiveData;
 	CompressedArchiveData.SetNumUninitialized(CompressedStream->Size());
 
@@ -96,20 +114,21 @@ bool URuntimeArchiverLZ4::OpenArchiveFromStorage(FString ArchivePath)
 		return false;
 	}
 
-	if (!TarArchiver->OpenArchiveFromMemory(TarArchiveData))
+	const int64 TarArchiveSize{TarArchiveData.Num()};
+	if (!TarArchiver->OpenArchiveFromMemory(MoveTemp(TarArchiveData)))
 	{
 		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open lz4 archive from storage due to tar archiver error"));
 		Reset();
 		return false;
 	}
 
-	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully opened lz4 archive '%s' in '%s' to read. Compressed size %lld, uncompressed %lld"), *GetName(), *ArchivePath, TarArchiveData.Num(), CompressedStream->Size());
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully opened lz4 archive '%s' in '%s' to read. Compressed size %lld, uncompressed %lld"), *GetName(), *ArchivePath, CompressedStream->Size(), TarArchiveSize);
 	return true;
 }
 
-bool URuntimeArchiverLZ4::OpenArchiveFromMemory(const TArray64<uint8>& ArchiveData)
+bool URuntimeArchiverLZ4::OpenArchiveFromMemoryView(TArrayView64<const uint8> ArchiveData)
 {
-	if (!Super::OpenArchiveFromMemory(ArchiveData))
+	if (!Super::OpenArchiveFromMemoryView(ArchiveData))
 	{
 		return false;
 	}
@@ -122,15 +141,28 @@ bool URuntimeArchiverLZ4::OpenArchiveFromMemory(const TArray64<uint8>& ArchiveDa
 		return false;
 	}
 
+	if (FRuntimeArchiverRawBlockStream::IsBlockStream(*CompressedStream))
+	{
+		if (!OpenTarArchiveFromCompressedStream())
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open lz4 archive from memory due to tar archiver error"));
+			Reset();
+			return false;
+		}
+
+		UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully opened in-memory lz4 archive '%s' to read"), *GetName());
+		return true;
+	}
+
 	TArray64<uint8> TarArchiveData;
-	if (!URuntimeArchiverRaw::UncompressRawData(ERuntimeArchiverRawFormat::LZ4, ArchiveData, TarArchiveData))
+	if (!URuntimeArchiverRaw::UncompressRawData(ERuntimeArchiverRawFormat::LZ4, TArray64<uint8>(ArchiveData), TarArchiveData))
 	{
 		ReportError(ERuntimeArchiverErrorCode::GetError, TEXT("Unable to uncompress lz4 to tar data to open archive from memory"));
 		Reset();
 		return false;
 	}
 
-	if (!TarArchiver->OpenArchiveFromMemory(TarArchiveData))
+	if (!TarArchiver->OpenArchiveFromMemory(MoveTemp(TarArchiveData)))
 	{
 		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open lz4 archive from memory due to tar archiver error"));
 		Reset();
@@ -148,28 +180,7 @@ bool URuntimeArchiverLZ4::CloseArchive()
 		return false;
 	}
 
-	if (Mode == ERuntimeArchiverMode::Write && Location == ERuntimeArchiverLocation::Storage)
-	{
-		TArray64<uint8> ArchiveData;
-		if (!GetArchiveData(ArchiveData))
-		{
-			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to get archive data to close archive"));
-			return false;
-		}
-
-		if (!CompressedStream->Seek(0))
-		{
-			ReportError(ERuntimeArchiverErrorCode::CloseError, TEXT("Unable to seek first position in lz4 archive to close archive"));
-			return false;
-		}
-
-		if (!CompressedStream->Write(ArchiveData.GetData(), ArchiveData.Num()))
-		{
-			ReportError(ERuntimeArchiverErrorCode::CloseError, TEXT("Unable to write archive data to lz4 compressed stream to close archive"));
-			return false;
-		}
-	}
-
+	// Closing the tar archiver also finishes the block stream, writing the remaining compressed data
 	if (!TarArchiver->CloseArchive())
 	{
 		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to close lz4 archive due to tar archiver error"));
@@ -192,7 +203,7 @@ bool URuntimeArchiverLZ4::GetArchiveData(TArray64<uint8>& ArchiveData)
 	{
 		ArchiveData.SetNumUninitialized(CompressedStream->Size());
 
-		if (!CompressedStream->Read(ArchiveData.GetData(), ArchiveData.Num()))
+		if (!CompressedStream->Seek(0) || !CompressedStream->Read(ArchiveData.GetData(), ArchiveData.Num()))
 		{
 			ReportError(ERuntimeArchiverErrorCode::GetError, TEXT("Unable to read lz4 compressed stream to get archive data"));
 			return false;
@@ -200,6 +211,12 @@ bool URuntimeArchiverLZ4::GetArchiveData(TArray64<uint8>& ArchiveData)
 	}
 	else if (Mode == ERuntimeArchiverMode::Write)
 	{
+		if (Location != ERuntimeArchiverLocation::Memory)
+		{
+			ReportError(ERuntimeArchiverErrorCode::UnsupportedLocation, TEXT("Unable to get lz4 archive data because the archive is written directly to storage"));
+			return false;
+		}
+
 		TArray64<uint8> TarArchiveData;
 		if (!TarArchiver->GetArchiveData(TarArchiveData))
 		{
@@ -207,11 +224,17 @@ bool URuntimeArchiverLZ4::GetArchiveData(TArray64<uint8>& ArchiveData)
 			return false;
 		}
 
-		if (!URuntimeArchiverRaw::CompressRawData(ERuntimeArchiverRawFormat::LZ4, LastCompressionLevel, TarArchiveData, ArchiveData))
+		FRuntimeArchiverMemoryStream ArchiveStream(0);
 		{
-			ReportError(ERuntimeArchiverErrorCode::GetError, TEXT("Unable to compress tar to lz4 data to get archive data"));
-			return false;
+			FRuntimeArchiverRawBlockStream ArchiveBlockStream(ArchiveStream, ERuntimeArchiverRawFormat::LZ4, LastCompressionLevel);
+			if (!ArchiveBlockStream.Write(TarArchiveData.GetData(), TarArchiveData.Num()) || !ArchiveBlockStream.Finish())
+			{
+				ReportError(ERuntimeArchiverErrorCode::GetError, TEXT("Unable to compress tar to lz4 data to get archive data"));
+				return false;
+			}
 		}
+
+		ArchiveData = TArray64<uint8>(ArchiveStream.GetData(), ArchiveStream.Size());
 	}
 
 	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully retrieved lz4 archive data from memory with size '%lld'"), ArchiveData.Num());
@@ -276,6 +299,12 @@ bool URuntimeArchiverLZ4::AddEntryFromMemory(FString EntryName, const TArray64<u
 		return false;
 	}
 
+	// Blocks written from now on are compressed with the level of this entry
+	if (BlockStream)
+	{
+		BlockStream->SetCompressionLevel(CompressionLevel);
+	}
+
 	if (!TarArchiver->AddEntryFromMemory(EntryName, DataToBeArchived, CompressionLevel))
 	{
 		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to add lz4 entry due to tar archiver error"));
@@ -334,6 +363,8 @@ void URuntimeArchiverLZ4::Reset()
 		TarArchiver.Reset();
 	}
 
+	// The block stream is owned by the tar archiver and refers to the compressed stream, so it is destroyed first
+	BlockStream = nullptr;
 	CompressedStream.Reset();
 	Super::Reset();
 	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully uninitialized lz4 archiver '%s'"), *GetName());
@@ -343,3 +374,15 @@ void URuntimeArchiverLZ4::ReportError(ERuntimeArchiverErrorCode ErrorCode, const
 {
 	Super::ReportError(ErrorCode, ErrorString);
 }
+
+bool URuntimeArchiverLZ4::OpenTarArchiveFromCompressedStream()
+{
+	BlockStream = new FRuntimeArchiverRawBlockStream(*CompressedStream, ERuntimeArchiverRawFormat::LZ4, LastCompressionLevel);
+	if (!TarArchiver->OpenArchiveFromStream(TUniquePtr<FRuntimeArchiverBaseStream>(BlockStream), Location))
+	{
+		BlockStream = nullptr;
+		return false;
+	}
+
+	return true;
+}
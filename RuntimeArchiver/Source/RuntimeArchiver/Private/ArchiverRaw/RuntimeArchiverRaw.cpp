@@ -3,7 +3,10 @@
 #include "ArchiverRaw/RuntimeArchiverRaw.h"
 #include "RuntimeArchiverDefines.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ByteSwap.h"
 #include "Misc/EngineVersionComparison.h"
+#include <atomic>
 #if UE_VERSION_NEWER_THAN(5, 0, 0)
 #include "Compression/OodleDataCompressionUtil.h"
 #endif
@@ -57,6 +60,28 @@ namespace
 
 		return true;
 	}
+
+	/** Magic identifying raw data compressed in parallel blocks */
+	constexpr uint8 ParallelRawMagic[4] = {'R', 'A', 'P', 'B'};
+
+	/** Version of the parallel blocks layout */
+	constexpr uint32 ParallelRawVersion = 1;
+
+	/**
+	 * Header of raw data compressed in parallel blocks. All values are little-endian
+	 * It is followed by the compressed size of each block (uint32) and then by the blocks themselves
+	 * A block whose compressed size equals its uncompressed size is stored uncompressed
+	 */
+	struct FParallelRawHeader
+	{
+		uint8 Magic[4];
+		uint32 Version;
+		uint32 RawFormat;
+		uint32 BlockSize;
+		uint64 UncompressedSize;
+	};
+
+	static_assert(sizeof(FParallelRawHeader) == 24, "Parallel raw header must be packed");
 }
 
 #if UE_VERSION_NEWER_THAN(5, 0, 0)
@@ -201,6 +226,238 @@ bool URuntimeArchiverRaw::CompressRawData(ERuntimeArchiverRawFormat RawFormat, E
 	return true;
 }
 
+void URuntimeArchiverRaw::CompressRawDataParallelAsync(ERuntimeArchiverRawFormat RawFormat, ERuntimeArchiverCompressionLevel CompressionLevel, TArray<uint8> UncompressedData, const FRuntimeArchiverRawMemoryResult& OnResult)
+{
+	CompressRawDataParallelAsync(RawFormat, CompressionLevel, TArray64<uint8>(MoveTemp(UncompressedData)),
+	                             FRuntimeArchiverRawMemoryResultNative::CreateLambda([OnResult](TArray64<uint8> CompressedData64)
+	                             {
+		                             if (CompressedData64.Num() > TNumericLimits<TArray<uint8>::SizeType>::Max())
+		                             {
+			                             UE_LOG(LogRuntimeArchiver, Error, TEXT("Array with int32 size (max length: %d) cannot fit int64 size data (retrieved length: %lld)\nA standard byte array can hold a maximum of 2 GB of data"), TNumericLimits<TArray<uint8>::SizeType>::Max(), CompressedData64.Num());
+			                             OnResult.ExecuteIfBound(TArray<uint8>());
+			                             return;
+		                             }
+		                             OnResult.ExecuteIfBound(TArray<uint8>(MoveTemp(CompressedData64)));
+	                             }));
+}
+
+void URuntimeArchiverRaw::CompressRawDataParallelAsync(ERuntimeArchiverRawFormat RawFormat, ERuntimeArchiverCompressionLevel CompressionLevel, TArray64<uint8> UncompressedData, const FRuntimeArchiverRawMemoryResultNative& OnResult, int32 BlockSize)
+{
+	AsyncTask(ENamedThreads::AnyBackgroundHiPriTask, [RawFormat, CompressionLevel, UncompressedData = MoveTemp(UncompressedData), OnResult, BlockSize]() mutable
+	{
+		TArray64<uint8> CompressedData;
+		CompressRawDataParallel(RawFormat, CompressionLevel, UncompressedData, CompressedData, BlockSize);
+
+		AsyncTask(ENamedThreads::GameThread, [OnResult, CompressedData = MoveTemp(CompressedData)]() mutable
+		{
+			OnResult.ExecuteIfBound(MoveTemp(CompressedData));
+		});
+	});
+}
+
+bool URuntimeArchiverRaw::CompressRawDataParallel(ERuntimeArchiverRawFormat RawFormat, ERuntimeArchiverCompressionLevel CompressionLevel, const TArray64<uint8>& UncompressedData, TArray64<uint8>& CompressedData, int32 BlockSize)
+{
+	if (BlockSize <= 0)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to compress data in parallel because the block size %d is not valid"), BlockSize);
+		return false;
+	}
+
+	const int64 NumOfBlocks64{(UncompressedData.Num() + BlockSize - 1) / BlockSize};
+	if (NumOfBlocks64 > TNumericLimits<int32>::Max())
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to compress data in parallel because the number of blocks %lld is too large. Consider increasing the block size"), NumOfBlocks64);
+		return false;
+	}
+
+	const int32 NumOfBlocks{static_cast<int32>(NumOfBlocks64)};
+	TArray<TArray64<uint8>> CompressedBlocks;
+	CompressedBlocks.SetNum(NumOfBlocks);
+	std::atomic<bool> bFailed{false};
+
+	// Blocks are independent, so they are compressed concurrently
+	ParallelFor(NumOfBlocks, [&](int32 BlockIndex)
+	{
+		if (bFailed)
+		{
+			return;
+		}
+
+		const int64 BlockOffset{static_cast<int64>(BlockIndex) * BlockSize};
+		const int64 UncompressedBlockSize{FMath::Min<int64>(BlockSize, UncompressedData.Num() - BlockOffset)};
+		const uint8* UncompressedBlockData{UncompressedData.GetData() + BlockOffset};
+		TArray64<uint8>& CompressedBlock{CompressedBlocks[BlockIndex]};
+
+		if (!CompressRawBlock(RawFormat, CompressionLevel, UncompressedBlockData, UncompressedBlockSize, CompressedBlock))
+		{
+			bFailed = true;
+			return;
+		}
+
+		// Incompressible blocks are stored as is, which also keeps the compressed size within the uncompressed one
+		if (CompressedBlock.Num() >= UncompressedBlockSize)
+		{
+			CompressedBlock.Reset();
+			CompressedBlock.Append(UncompressedBlockData, UncompressedBlockSize);
+		}
+	}, NumOfBlocks <= 1);
+
+	if (bFailed)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to compress data in parallel for '%s' format"), *UEnum::GetValueAsString(RawFormat));
+		return false;
+	}
+
+	const int64 TableSize{static_cast<int64>(NumOfBlocks) * sizeof(uint32)};
+	TArray<int64> BlockOffsets;
+	BlockOffsets.SetNumUninitialized(NumOfBlocks);
+
+	int64 TotalSize{static_cast<int64>(sizeof(FParallelRawHeader)) + TableSize};
+	for (int32 BlockIndex = 0; BlockIndex < NumOfBlocks; ++BlockIndex)
+	{
+		BlockOffsets[BlockIndex] = TotalSize;
+		TotalSize += CompressedBlocks[BlockIndex].Num();
+	}
+
+	TArray64<uint8> TempCompressedData;
+	TempCompressedData.SetNumUninitialized(TotalSize);
+
+	FParallelRawHeader Header;
+	FMemory::Memcpy(Header.Magic, ParallelRawMagic, sizeof(ParallelRawMagic));
+	Header.Version = INTEL_ORDER32(ParallelRawVersion);
+	Header.RawFormat = INTEL_ORDER32(static_cast<uint32>(RawFormat));
+	Header.BlockSize = INTEL_ORDER32(static_cast<uint32>(BlockSize));
+	Header.UncompressedSize = INTEL_ORDER64(static_cast<uint64>(UncompressedData.Num()));
+	FMemory::Memcpy(TempCompressedData.GetData(), &Header, sizeof(Header));
+
+	uint8* TableData{TempCompressedData.GetData() + sizeof(FParallelRawHeader)};
+	for (int32 BlockIndex = 0; BlockIndex < NumOfBlocks; ++BlockIndex)
+	{
+		const uint32 CompressedBlockSize{INTEL_ORDER32(static_cast<uint32>(CompressedBlocks[BlockIndex].Num()))};
+		FMemory::Memcpy(TableData + static_cast<int64>(BlockIndex) * sizeof(uint32), &CompressedBlockSize, sizeof(uint32));
+	}
+
+	ParallelFor(NumOfBlocks, [&](int32 BlockIndex)
+	{
+		FMemory::Memcpy(TempCompressedData.GetData() + BlockOffsets[BlockIndex], CompressedBlocks[BlockIndex].GetData(), CompressedBlocks[BlockIndex].Num());
+	}, NumOfBlocks <= 1);
+
+	CompressedData = MoveTemp(TempCompressedData);
+	return true;
+}
+
+bool URuntimeArchiverRaw::UncompressRawDataParallel(ERuntimeArchiverRawFormat RawFormat, const TArray64<uint8>& CompressedData, TArray64<uint8>& UncompressedData)
+{
+	if (!IsParallelRawData(CompressedData))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to uncompress data in parallel because it was not compressed in parallel blocks"));
+		return false;
+	}
+
+	FParallelRawHeader Header;
+	FMemory::Memcpy(&Header, CompressedData.GetData(), sizeof(Header));
+
+	const ERuntimeArchiverRawFormat StoredRawFormat{static_cast<ERuntimeArchiverRawFormat>(INTEL_ORDER32(Header.RawFormat))};
+	if (StoredRawFormat != RawFormat)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to uncompress data in parallel because it was compressed with '%s' format, not '%s'"), *UEnum::GetValueAsString(StoredRawFormat), *UEnum::GetValueAsString(RawFormat));
+		return false;
+	}
+
+	const int64 BlockSize{static_cast<int64>(INTEL_ORDER32(Header.BlockSize))};
+	const int64 UncompressedSize{static_cast<int64>(INTEL_ORDER64(Header.UncompressedSize))};
+	const int64 NumOfBlocks64{BlockSize > 0 ? (UncompressedSize + BlockSize - 1) / BlockSize : -1};
+	const int64 TableSize{NumOfBlocks64 * static_cast<int64>(sizeof(uint32))};
+
+	if (UncompressedSize < 0 || NumOfBlocks64 < 0 || NumOfBlocks64 > TNumericLimits<int32>::Max() || static_cast<int64>(sizeof(FParallelRawHeader)) + TableSize > CompressedData.Num())
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to uncompress data in parallel because the header is corrupted"));
+		return false;
+	}
+
+	const int32 NumOfBlocks{static_cast<int32>(NumOfBlocks64)};
+	const uint8* TableData{CompressedData.GetData() + sizeof(FParallelRawHeader)};
+
+	TArray<int64> BlockOffsets;
+	TArray<int64> CompressedBlockSizes;
+	BlockOffsets.SetNumUninitialized(NumOfBlocks);
+	CompressedBlockSizes.SetNumUninitialized(NumOfBlocks);
+
+	int64 CurrentOffset{static_cast<int64>(sizeof(FParallelRawHeader)) + TableSize};
+	for (int32 BlockIndex = 0; BlockIndex < NumOfBlocks; ++BlockIndex)
+	{
+		uint32 CompressedBlockSize;
+		FMemory::Memcpy(&CompressedBlockSize, TableData + static_cast<int64>(BlockIndex) * sizeof(uint32), sizeof(uint32));
+
+		BlockOffsets[BlockIndex] = CurrentOffset;
+		CompressedBlockSizes[BlockIndex] = INTEL_ORDER32(CompressedBlockSize);
+		CurrentOffset += CompressedBlockSizes[BlockIndex];
+
+		const int64 UncompressedBlockSize{FMath::Min<int64>(BlockSize, UncompressedSize - static_cast<int64>(BlockIndex) * BlockSize)};
+		if (CompressedBlockSizes[BlockIndex] == 0 || CompressedBlockSizes[BlockIndex] > UncompressedBlockSize)
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to uncompress data in parallel because the size of block %d is corrupted"), BlockIndex);
+			return false;
+		}
+	}
+
+	if (CurrentOffset != CompressedData.Num())
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to uncompress data in parallel because the size %lld does not match the expected size %lld"), CompressedData.Num(), CurrentOffset);
+		return false;
+	}
+
+	TArray64<uint8> TempUncompressedData;
+	TempUncompressedData.SetNumUninitialized(UncompressedSize);
+	std::atomic<bool> bFailed{false};
+
+	ParallelFor(NumOfBlocks, [&](int32 BlockIndex)
+	{
+		if (bFailed)
+		{
+			return;
+		}
+
+		const int64 UncompressedBlockOffset{static_cast<int64>(BlockIndex) * BlockSize};
+		const int64 UncompressedBlockSize{FMath::Min<int64>(BlockSize, UncompressedSize - UncompressedBlockOffset)};
+		const uint8* CompressedBlockData{CompressedData.GetData() + BlockOffsets[BlockIndex]};
+		uint8* UncompressedBlockData{TempUncompressedData.GetData() + UncompressedBlockOffset};
+
+		if (CompressedBlockSizes[BlockIndex] == UncompressedBlockSize)
+		{
+			FMemory::Memcpy(UncompressedBlockData, CompressedBlockData, UncompressedBlockSize);
+			return;
+		}
+
+		if (!UncompressRawBlock(RawFormat, CompressedBlockData, CompressedBlockSizes[BlockIndex], UncompressedBlockData, UncompressedBlockSize))
+		{
+			bFailed = true;
+		}
+	}, NumOfBlocks <= 1);
+
+	if (bFailed)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to uncompress data in parallel for '%s' format"), *UEnum::GetValueAsString(RawFormat));
+		return false;
+	}
+
+	UncompressedData = MoveTemp(TempUncompressedData);
+	return true;
+}
+
+bool URuntimeArchiverRaw::IsParallelRawData(const TArray64<uint8>& CompressedData)
+{
+	if (CompressedData.Num() < static_cast<int64>(sizeof(FParallelRawHeader)))
+	{
+		return false;
+	}
+
+	FParallelRawHeader Header;
+	FMemory::Memcpy(&Header, CompressedData.GetData(), sizeof(Header));
+
+	return FMemory::Memcmp(Header.Magic, ParallelRawMagic, sizeof(ParallelRawMagic)) == 0 && INTEL_ORDER32(Header.Version) == ParallelRawVersion;
+}
+
 void URuntimeArchiverRaw::UncompressRawDataAsync(ERuntimeArchiverRawFormat RawFormat, TArray<uint8> CompressedData, const FRuntimeArchiverRawMemoryResult& OnResult)
 {
 	UncompressRawDataAsync(RawFormat, TArray64<uint8>(MoveTemp(CompressedData)),
@@ -232,6 +489,11 @@ void URuntimeArchiverRaw::UncompressRawDataAsync(ERuntimeArchiverRawFormat RawFo
 
 bool URuntimeArchiverRaw::UncompressRawData(ERuntimeArchiverRawFormat RawFormat, TArray64<uint8> CompressedData, TArray64<uint8>& UncompressedData)
 {
+	if (IsParallelRawData(CompressedData))
+	{
+		return UncompressRawDataParallel(RawFormat, CompressedData, UncompressedData);
+	}
+
 	const FName FormatName{ToName(RawFormat)};
 
 	if (!IsFormatValid(FormatName))
@@ -294,6 +556,13 @@ int64 URuntimeArchiverRaw::GuessUncompressedSize(ERuntimeArchiverRawFormat RawFo
 		return 0;
 	}
 
+	if (IsParallelRawData(CompressedData))
+	{
+		FParallelRawHeader Header;
+		FMemory::Memcpy(&Header, CompressedData.GetData(), sizeof(Header));
+		return static_cast<int64>(INTEL_ORDER64(Header.UncompressedSize));
+	}
+
 	switch (RawFormat)
 	{
 	case ERuntimeArchiverRawFormat::GZip:
@@ -317,3 +586,90 @@ int64 URuntimeArchiverRaw::GuessUncompressedSize(ERuntimeArchiverRawFormat RawFo
 
 	return 0;
 }
+
+bool URuntimeArchiverRaw::CompressRawBlock(ERuntimeArchiverRawFormat RawFormat, ERuntimeArchiverCompressionLevel CompressionLevel, const uint8* UncompressedData, int64 UncompressedSize, TArray64<uint8>& CompressedData)
+{
+	const FName FormatName{ToName(RawFormat)};
+	if (!IsFormatValid(FormatName))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("The specified format '%s' is not valid"), *FormatName.ToString());
+		return false;
+	}
+
+#if UE_VERSION_NEWER_THAN(5, 0, 0)
+	if (FormatName.IsEqual(NAME_Oodle))
+	{
+		CompressedData.SetNumUninitialized(FOodleDataCompression::CompressedBufferSizeNeeded(UncompressedSize));
+
+		const int64 CompressedSize{FOodleDataCompression::Compress(CompressedData.GetData(), CompressedData.Num(), UncompressedData, UncompressedSize, OodleConversation::GetCompressor(CompressionLevel), OodleConversation::GetCompressionLevel(CompressionLevel))};
+		if (CompressedSize <= 0)
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to compress block for '%s' format"), *FormatName.ToString());
+			return false;
+		}
+
+		CompressedData.SetNum(CompressedSize, false);
+		return true;
+	}
+#endif
+
+	if (UncompressedSize > TNumericLimits<int32>::Max())
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Block size %lld exceeds the maximum size supported by '%s' format"), UncompressedSize, *FormatName.ToString());
+		return false;
+	}
+
+#if UE_VERSION_NEWER_THAN(5, 0, 0)
+	int32 CompressedSize{static_cast<int32>(FCompression::GetMaximumCompressedSize(FormatName, static_cast<int32>(UncompressedSize)))};
+#else
+	int32 CompressedSize{FCompression::CompressMemoryBound(FormatName, static_cast<int32>(UncompressedSize))};
+#endif
+
+	CompressedData.SetNumUninitialized(CompressedSize);
+
+	if (!FCompression::CompressMemory(FormatName, CompressedData.GetData(), CompressedSize, UncompressedData, static_cast<int32>(UncompressedSize)))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to compress block for '%s' format"), *FormatName.ToString());
+		return false;
+	}
+
+	CompressedData.SetNum(CompressedSize, false);
+	return true;
+}
+
+bool URuntimeArchiverRaw::UncompressRawBlock(ERuntimeArchiverRawFormat RawFormat, const uint8* CompressedData, int64 CompressedSize, uint8* UncompressedData, int64 UncompressedSize)
+{
+	const FName FormatName{ToName(RawFormat)};
+	if (!IsFormatValid(FormatName))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("The specified format '%s' is not valid"), *FormatName.ToString());
+		return false;
+	}
+
+#if UE_VERSION_NEWER_THAN(5, 0, 0)
+	if (FormatName.IsEqual(NAME_Oodle))
+	{
+		if (!FOodleDataCompression::Decompress(UncompressedData, UncompressedSize, CompressedData, CompressedSize))
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to uncompress block for '%s' format"), *FormatName.ToString());
+			return false;
+		}
+
+		return true;
+	}
+#endif
+
+	if (UncompressedSize > TNumericLimits<int32>::Max() || CompressedSize > TNumericLimits<int32>::Max())
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Block size %lld exceeds the maximum size supported by '%s' format"), UncompressedSize, *FormatName.ToString());
+		return false;
+	}
+
+	if (!FCompression::UncompressMemory(FormatName, UncompressedData, static_cast<int32>(UncompressedSize), CompressedData, static_cast<int32>(CompressedSize)))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to uncompress block for '%s' format"), *FormatName.ToString());
+		return false;
+	}
+
+	return true;
+}
@@ -6,8 +6,10 @@
 #include "RuntimeArchiverUtilities.h"
 #include "ArchiverTar/RuntimeArchiverTarHeader.h"
 #include "Streams/RuntimeArchiverFileStream.h"
+#include "Streams/RuntimeArchiverMappedFileStream.h"
 #include "Streams/RuntimeArchiverMemoryStream.h"
 #include "Misc/Paths.h"
+#include "GenericPlatform/GenericPlatformFile.h"
 
 bool URuntimeArchiverTar::CreateArchiveInStorage(FString ArchivePath)
 {
@@ -37,7 +39,7 @@ bool URuntimeArchiverTar::CreateArchiveInMemory(int32 InitialAllocationSize)
 		return false;
 	}
 
-	if (!TarEncapsulator->OpenMemory(TArray64<uint8>(), InitialAllocationSize, true))
+	if (!TarEncapsulator->OpenMemory(TArrayView64<const uint8>(), InitialAllocationSize, true))
 	{
 		ReportError(ERuntimeArchiverErrorCode::NotInitialized, TEXT("Unable to initialize tar archive in memory"));
 		Reset();
@@ -70,9 +72,9 @@ bool URuntimeArchiverTar::OpenArchiveFromStorage(FString ArchivePath)
 	return true;
 }
 
-bool URuntimeArchiverTar::OpenArchiveFromMemory(const TArray64<uint8>& ArchiveData)
+bool URuntimeArchiverTar::OpenArchiveFromMemoryView(TArrayView64<const uint8> ArchiveData)
 {
-	if (!Super::OpenArchiveFromMemory(ArchiveData))
+	if (!Super::OpenArchiveFromMemoryView(ArchiveData))
 	{
 		return false;
 	}
@@ -96,6 +98,14 @@ bool URuntimeArchiverTar::CloseArchive()
 		return false;
 	}
 
+	// Finalizing explicitly rather than on destruction, so that failures (e.g. when flushing compression streams) can be reported
+	if (Mode == ERuntimeArchiverMode::Write && !TarEncapsulator->Finalize())
+	{
+		ReportError(ERuntimeArchiverErrorCode::CloseError, TEXT("Unable to finalize tar archive"));
+		Reset();
+		return false;
+	}
+
 	Reset();
 
 	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully closed tar archive '%s'"), *GetName());
@@ -151,10 +161,7 @@ bool URuntimeArchiverTar::GetArchiveEntryInfoByName(FString EntryName, FRuntimeA
 	int32 EntryIndex;
 
 	// Searching for a header by the entry name
-	const bool bFound = TarEncapsulator->FindIf([&EntryName](const FTarHeader& PossibleHeader, int32 PossibleIndex)
-	{
-		return EntryName.Equals(StringCast<TCHAR>(PossibleHeader.GetName()).Get());
-	}, Header, EntryIndex, true);
+	const bool bFound = TarEncapsulator->FindByName(EntryName, Header, EntryIndex, true);
 
 	if (!bFound)
 	{
@@ -183,10 +190,7 @@ bool URuntimeArchiverTar::GetArchiveEntryInfoByIndex(int32 EntryIndex, FRuntimeA
 	FTarHeader Header;
 
 	// Searching for a header by the entry index
-	const bool bFound = TarEncapsulator->FindIf([EntryIndex](const FTarHeader& PossibleHeader, int32 PossibleIndex)
-	{
-		return EntryIndex == PossibleIndex;
-	}, Header, EntryIndex, true);
+	const bool bFound = TarEncapsulator->FindByIndex(EntryIndex, Header, true);
 
 	if (!bFound)
 	{
@@ -219,17 +223,11 @@ bool URuntimeArchiverTar::AddEntryFromMemory(FString EntryName, const TArray64<u
 
 		for (const FString& Directory : Directories)
 		{
-			FTarHeader Header;
-			int32 Index;
-
 			// Skip if the archive already contains this directory entry
-			const bool bFound = TarEncapsulator->FindIf([&Directory](const FTarHeader& PotentialHeader, int32 Index)
+			if (!TarEncapsulator->ContainsEntry(Directory))
 			{
-				return Directory.Equals(StringCast<TCHAR>(PotentialHeader.GetName()).Get());
-			}, Header, Index, true);
+				FTarHeader Header;
 
-			if (!bFound)
-			{
 				if (!FTarHeader::GenerateHeader(Directory, 0, FDateTime::Now(), true, Header))
 				{
 					ReportError(ERuntimeArchiverErrorCode::AddError, FString::Printf(TEXT("Unable to generate directory header for for entry '%s' to write from memory"), *Directory));
@@ -291,10 +289,7 @@ bool URuntimeArchiverTar::ExtractEntryToMemory(const FRuntimeArchiveEntry& Entry
 	int32 Index;
 
 	// Make sure we have such entry
-	const bool bFound = TarEncapsulator->FindIf([&EntryInfo](const FTarHeader& PotentialHeader, int32 Index)
-	{
-		return EntryInfo.Name.Equals(StringCast<TCHAR>(PotentialHeader.GetName()).Get());
-	}, Header, Index, false);
+	const bool bFound = TarEncapsulator->FindByName(EntryInfo.Name, Header, Index, false);
 
 	if (!bFound)
 	{
@@ -316,6 +311,37 @@ bool URuntimeArchiverTar::ExtractEntryToMemory(const FRuntimeArchiveEntry& Entry
 	return true;
 }
 
+bool URuntimeArchiverTar::ExtractEntryToFileHandle(const FRuntimeArchiveEntry& EntryInfo, IFileHandle& FileHandle)
+{
+	if (!IsInitialized() || Mode != ERuntimeArchiverMode::Read || EntryInfo.bIsDirectory)
+	{
+		return Super::ExtractEntryToFileHandle(EntryInfo, FileHandle);
+	}
+
+	FTarHeader Header;
+	int32 Index;
+
+	const bool bFound = TarEncapsulator->FindByName(EntryInfo.Name, Header, Index, false);
+
+	TArrayView64<const uint8> EntryData;
+
+	// Writing straight from the mapped or in-memory archive, falling back to reading the entry into memory first
+	if (!bFound || !TarEncapsulator->ReadDataView(EntryData))
+	{
+		return Super::ExtractEntryToFileHandle(EntryInfo, FileHandle);
+	}
+
+	if (!FileHandle.Write(EntryData.GetData(), EntryData.Num()))
+	{
+		ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to write tar entry '%s' into file"), *EntryInfo.Name));
+		return false;
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully extracted tar entry '%s' into file"), *EntryInfo.Name);
+
+	return true;
+}
+
 bool URuntimeArchiverTar::Initialize()
 {
 	if (!Super::Initialize())
@@ -355,10 +381,41 @@ void URuntimeArchiverTar::ReportError(ERuntimeArchiverErrorCode ErrorCode, const
 	Super::ReportError(ErrorCode, ErrorString);
 }
 
+bool URuntimeArchiverTar::OpenArchiveFromStream(TUniquePtr<FRuntimeArchiverBaseStream> Stream, ERuntimeArchiverLocation StreamLocation)
+{
+	if (!Stream.IsValid() || !Stream->IsValid())
+	{
+		ReportError(ERuntimeArchiverErrorCode::InvalidArgument, TEXT("Unable to open tar archive because the stream is not valid"));
+		return false;
+	}
+
+	if (!Initialize())
+	{
+		ReportError(ERuntimeArchiverErrorCode::NotInitialized, TEXT("Unable to initialize archiver for stream"));
+		Reset();
+		return false;
+	}
+
+	Mode = Stream->IsWrite() ? ERuntimeArchiverMode::Write : ERuntimeArchiverMode::Read;
+	Location = StreamLocation;
+
+	if (!TarEncapsulator->OpenStream(MoveTemp(Stream)))
+	{
+		ReportError(ERuntimeArchiverErrorCode::NotInitialized, FString::Printf(TEXT("Unable to open tar archive from stream for %s"), Mode == ERuntimeArchiverMode::Write ? TEXT("writing") : TEXT("reading")));
+		Reset();
+		return false;
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully opened tar archive '%s' from stream"), *GetName());
+
+	return true;
+}
+
 FRuntimeArchiverTarEncapsulator::FRuntimeArchiverTarEncapsulator()
 	: RemainingDataSize{0}
   , LastHeaderPosition{0}
-  , CachedNumOfHeaders{0}
+  , NextIndexedHeaderPosition{0}
+  , bIndexComplete{false}
   , bIsFinalized{false}
 {
 }
@@ -383,6 +440,13 @@ bool FRuntimeArchiverTarEncapsulator::IsValid()
 
 bool FRuntimeArchiverTarEncapsulator::TestArchive()
 {
+	HeaderPositions.Reset();
+	EntryIndicesByName.Reset();
+	NextIndexedHeaderPosition = 0;
+
+	// The index is kept up to date while writing
+	bIndexComplete = Stream->IsWrite();
+
 	if (Stream->IsWrite())
 	{
 		return true;
@@ -395,9 +459,52 @@ bool FRuntimeArchiverTarEncapsulator::TestArchive()
 		return false;
 	}
 
+	// The index is built lazily, so that opening a compressed archive does not inflate it completely just to start reading again from the beginning
 	return ReadHeader(Header);
 }
 
+bool FRuntimeArchiverTarEncapsulator::IndexNextEntry()
+{
+	if (bIndexComplete)
+	{
+		return false;
+	}
+
+	const int64 PrevRemainingDataSize{RemainingDataSize};
+	const int64 PrevLastHeaderPosition{LastHeaderPosition};
+	const int64 PrevStreamPosition{Stream->Tell()};
+
+	FTarHeader Header;
+	const bool bIndexed{Stream->Seek(NextIndexedHeaderPosition) && ReadHeader(Header)};
+
+	if (bIndexed)
+	{
+		AddToIndex(Header, LastHeaderPosition);
+		NextIndexedHeaderPosition = LastHeaderPosition + sizeof(FTarHeader) + RuntimeArchiverTarOperations::RoundUp<int64>(Header.GetSize(), 512);
+	}
+	else
+	{
+		bIndexComplete = true;
+	}
+
+	RemainingDataSize = PrevRemainingDataSize;
+	LastHeaderPosition = PrevLastHeaderPosition;
+	Stream->Seek(PrevStreamPosition);
+
+	return bIndexed;
+}
+
+void FRuntimeArchiverTarEncapsulator::AddToIndex(const FTarHeader& Header, int64 HeaderPosition)
+{
+	const int32 Index{HeaderPositions.Add(HeaderPosition)};
+
+	FString EntryName{StringCast<TCHAR>(Header.GetName()).Get()};
+	if (!EntryIndicesByName.Contains(EntryName))
+	{
+		EntryIndicesByName.Add(MoveTemp(EntryName), Index);
+	}
+}
+
 bool FRuntimeArchiverTarEncapsulator::OpenFile(const FString& ArchivePath, bool bWrite)
 {
 	if (Stream.IsValid())
@@ -406,7 +513,16 @@ bool FRuntimeArchiverTarEncapsulator::OpenFile(const FString& ArchivePath, bool
 		return false;
 	}
 
-	Stream.Reset(new FRuntimeArchiverFileStream(ArchivePath, bWrite));
+	// Reading straight from the mapped file lets the OS page cache do the buffering
+	if (!bWrite)
+	{
+		Stream.Reset(new FRuntimeArchiverMappedFileStream(ArchivePath));
+	}
+
+	if (!Stream.IsValid() || !Stream->IsValid())
+	{
+		Stream.Reset(new FRuntimeArchiverFileStream(ArchivePath, bWrite));
+	}
 
 	if (!Stream->IsValid())
 	{
@@ -417,7 +533,7 @@ bool FRuntimeArchiverTarEncapsulator::OpenFile(const FString& ArchivePath, bool
 	return TestArchive();
 }
 
-bool FRuntimeArchiverTarEncapsulator::OpenMemory(const TArray64<uint8>& ArchiveData, int32 InitialAllocationSize, bool bWrite)
+bool FRuntimeArchiverTarEncapsulator::OpenMemory(TArrayView64<const uint8> ArchiveData, int32 InitialAllocationSize, bool bWrite)
 {
 	if (Stream.IsValid())
 	{
@@ -436,6 +552,25 @@ bool FRuntimeArchiverTarEncapsulator::OpenMemory(const TArray64<uint8>& ArchiveD
 	return TestArchive();
 }
 
+bool FRuntimeArchiverTarEncapsulator::OpenStream(TUniquePtr<FRuntimeArchiverBaseStream> NewStream)
+{
+	if (Stream.IsValid())
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open tar stream because it has already been opened"));
+		return false;
+	}
+
+	Stream = MoveTemp(NewStream);
+
+	if (!IsValid())
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open tar stream because it is not valid"));
+		return false;
+	}
+
+	return TestArchive();
+}
+
 bool FRuntimeArchiverTarEncapsulator::FindIf(TFunctionRef<bool(const FTarHeader&, int32)> ComparePredicate, FTarHeader& Header, int32& Index, bool bRemainPosition)
 {
 	if (!IsValid())
@@ -486,55 +621,82 @@ bool FRuntimeArchiverTarEncapsulator::FindIf(TFunctionRef<bool(const FTarHeader&
 	return bFound;
 }
 
-bool FRuntimeArchiverTarEncapsulator::GetArchiveEntries(int32& NumOfArchiveEntries)
+bool FRuntimeArchiverTarEncapsulator::FindByName(const FString& EntryName, FTarHeader& Header, int32& Index, bool bRemainPosition)
+{
+	while (!EntryIndicesByName.Contains(EntryName) && IndexNextEntry())
+	{
+	}
+
+	const int32* FoundIndex{EntryIndicesByName.Find(EntryName)};
+
+	if (!FoundIndex || !FindByIndex(*FoundIndex, Header, bRemainPosition))
+	{
+		return false;
+	}
+
+	Index = *FoundIndex;
+	return true;
+}
+
+bool FRuntimeArchiverTarEncapsulator::FindByIndex(int32 Index, FTarHeader& Header, bool bRemainPosition)
 {
 	if (!IsValid())
 	{
-		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to get tar archive entries because stream is invalid"));
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to find tar entry because stream is invalid"));
 		return false;
 	}
 
-	// TODO: verify the validity of the last entry
+	while (Index >= HeaderPositions.Num() && IndexNextEntry())
+	{
+	}
 
-	// Read-only mode is supposed to have a fixed (immutable) number of entries, so if possible, return the cached number of entries in this mode to improve performance
-	if (!Stream->IsWrite() && CachedNumOfHeaders > 0)
+	if (!HeaderPositions.IsValidIndex(Index))
 	{
-		NumOfArchiveEntries = CachedNumOfHeaders;
-		return true;
+		return false;
 	}
 
 	const int64 PreviousPosition{Stream->Tell()};
 
-	// Making sure looking from the start
-	if (!Rewind())
+	// Seeking directly to the header instead of iterating the previous ones
+	RemainingDataSize = 0;
+
+	if (!Stream->Seek(HeaderPositions[Index]) || !ReadHeader(Header))
 	{
-		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to rewind read/write position of tar archive to get the number of archive entries"));
+		Stream->Seek(PreviousPosition);
 		return false;
 	}
 
-	FTarHeader TempHeader;
-	int32 NumOfHeaders{0};
-
-	// Iterate all files
-	while (ReadHeader(TempHeader))
+	if (bRemainPosition)
 	{
-		NumOfHeaders++;
+		Stream->Seek(PreviousPosition);
+	}
 
-		if (!Next())
-		{
-			break;
-		}
+	return true;
+}
+
+bool FRuntimeArchiverTarEncapsulator::ContainsEntry(const FString& EntryName)
+{
+	while (!EntryIndicesByName.Contains(EntryName) && IndexNextEntry())
+	{
 	}
 
-	Stream->Seek(PreviousPosition);
+	return EntryIndicesByName.Contains(EntryName);
+}
+
+bool FRuntimeArchiverTarEncapsulator::GetArchiveEntries(int32& NumOfArchiveEntries)
+{
+	if (!IsValid())
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to get tar archive entries because stream is invalid"));
+		return false;
+	}
 
-	// Cache number of entries in read-only mode to improve performance
-	if (!Stream->IsWrite())
+	// The entry index is completed on demand and kept up to date while writing
+	while (IndexNextEntry())
 	{
-		CachedNumOfHeaders = NumOfHeaders;
 	}
 
-	NumOfArchiveEntries = NumOfHeaders;
+	NumOfArchiveEntries = HeaderPositions.Num();
 	return true;
 }
 
@@ -678,10 +840,49 @@ bool FRuntimeArchiverTarEncapsulator::ReadData(TArray64<uint8>& Data)
 	return true;
 }
 
+bool FRuntimeArchiverTarEncapsulator::ReadDataView(TArrayView64<const uint8>& DataView)
+{
+	const uint8* StreamData{Stream->GetData()};
+
+	if (!StreamData)
+	{
+		return false;
+	}
+
+	FTarHeader Header;
+	if (!ReadHeader(Header))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read header for getting tar entry data view"));
+		return false;
+	}
+
+	const int64 DataPosition{LastHeaderPosition + static_cast<int64>(sizeof(FTarHeader))};
+	const int64 DataSize{static_cast<int64>(Header.GetSize())};
+
+	if (DataPosition + DataSize > Stream->Size())
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Tar entry data exceeds the archive size"));
+		return false;
+	}
+
+	DataView = TArrayView64<const uint8>(StreamData + DataPosition, DataSize);
+
+	return true;
+}
+
 bool FRuntimeArchiverTarEncapsulator::WriteHeader(const FTarHeader& Header)
 {
 	RemainingDataSize = Header.GetSize();
-	return Stream->Write(&Header, sizeof(Header));
+
+	const int64 HeaderPosition{Stream->Tell()};
+
+	if (!Stream->Write(&Header, sizeof(Header)))
+	{
+		return false;
+	}
+
+	AddToIndex(Header, HeaderPosition);
+	return true;
 }
 
 bool FRuntimeArchiverTarEncapsulator::WriteData(const TArray64<uint8>& DataToBeArchived)
@@ -706,15 +907,20 @@ bool FRuntimeArchiverTarEncapsulator::WriteData(const TArray64<uint8>& DataToBeA
 
 bool FRuntimeArchiverTarEncapsulator::WriteNullBytes(int64 NumOfBytes) const
 {
-	constexpr ANSICHAR NullCharacter = '\0';
+	// Padding never exceeds a record and the end-of-archive marker is two records, so they are written in one call
+	static constexpr uint8 NullBlock[sizeof(FTarHeader) * 2]{};
 
-	for (int64 Index = 0; Index < NumOfBytes; ++Index)
+	while (NumOfBytes > 0)
 	{
-		if (!Stream->Write(&NullCharacter, 1))
+		const int64 NumOfBytesToWrite{FMath::Min<int64>(NumOfBytes, sizeof(NullBlock))};
+
+		if (!Stream->Write(NullBlock, NumOfBytesToWrite))
 		{
 			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to write null bytes to tar archive"));
 			return false;
 		}
+
+		NumOfBytes -= NumOfBytesToWrite;
 	}
 
 	return true;
@@ -729,5 +935,5 @@ bool FRuntimeArchiverTarEncapsulator::Finalize()
 
 	bIsFinalized = true;
 
-	return WriteNullBytes(sizeof(FTarHeader) * 2);
+	return WriteNullBytes(sizeof(FTarHeader) * 2) && Stream->Finish();
 }
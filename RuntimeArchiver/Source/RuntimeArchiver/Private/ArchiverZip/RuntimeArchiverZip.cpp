@@ -6,11 +6,102 @@
 #include "RuntimeArchiverDefines.h"
 #include "RuntimeArchiverZipIncludes.h"
 #include "Misc/Paths.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "Misc/FileHelper.h"
+#include <atomic>
+
+namespace
+{
+	/**
+	 * Receives decompressed zip entry data from miniz and writes it to the file handle in fixed-size blocks
+	 */
+	class FZipEntryFileWriter
+	{
+	public:
+		/** Size of the block written to the file handle at once */
+		static constexpr int64 BufferSize{1024 * 1024};
+
+		explicit FZipEntryFileWriter(IFileHandle& FileHandle)
+			: FileHandle(FileHandle)
+		{
+			Buffer.Reserve(BufferSize);
+		}
+
+		/**
+		 * Miniz write callback. Returning a size different from the provided one aborts the extraction
+		 */
+		static size_t Write(void* Opaque, mz_uint64 FileOffset, const void* Data, size_t Size)
+		{
+			FZipEntryFileWriter& Writer{*static_cast<FZipEntryFileWriter*>(Opaque)};
+
+			// Large blocks (such as stored entries read from memory) are written without copying
+			if (Writer.Buffer.Num() == 0 && static_cast<int64>(Size) >= BufferSize)
+			{
+				return Writer.FileHandle.Write(static_cast<const uint8*>(Data), static_cast<int64>(Size)) ? Size : 0;
+			}
+
+			const uint8* DataPtr{static_cast<const uint8*>(Data)};
+			int64 RemainingSize{static_cast<int64>(Size)};
+
+			while (RemainingSize > 0)
+			{
+				const int64 SizeToCopy{FMath::Min(RemainingSize, BufferSize - Writer.Buffer.Num())};
+				Writer.Buffer.Append(DataPtr, SizeToCopy);
+
+				DataPtr += SizeToCopy;
+				RemainingSize -= SizeToCopy;
+
+				if (Writer.Buffer.Num() >= BufferSize && !Writer.Flush())
+				{
+					return 0;
+				}
+			}
+
+			return Size;
+		}
+
+		/**
+		 * Write the remaining buffered data to the file handle
+		 */
+		bool Flush()
+		{
+			if (Buffer.Num() > 0)
+			{
+				if (!FileHandle.Write(Buffer.GetData(), Buffer.Num()))
+				{
+					return false;
+				}
+
+				Buffer.Reset();
+			}
+
+			return true;
+		}
+
+	private:
+		IFileHandle& FileHandle;
+		TArray64<uint8> Buffer;
+	};
+
+	/**
+	 * Extract the zip entry into the file handle through the fixed-size buffer
+	 */
+	bool ExtractZipEntryToFileHandle(mz_zip_archive* MinizArchiver, int32 EntryIndex, IFileHandle& FileHandle)
+	{
+		FZipEntryFileWriter EntryFileWriter(FileHandle);
+		return mz_zip_reader_extract_to_callback(MinizArchiver, static_cast<mz_uint>(EntryIndex), &FZipEntryFileWriter::Write, &EntryFileWriter, 0) && EntryFileWriter.Flush();
+	}
+}
 
 URuntimeArchiverZip::URuntimeArchiverZip()
 	: Super::URuntimeArchiverBase()
   , bAppendMode(false)
   , MinizArchiver(nullptr)
+  , MappedFileHandle(nullptr)
+  , MappedFileRegion(nullptr)
 {
 }
 
@@ -65,22 +156,36 @@ bool URuntimeArchiverZip::OpenArchiveFromStorage(FString ArchivePath)
 
 	FPaths::NormalizeFilename(ArchivePath);
 
-	// Reading the archive from the file path
-	if (!mz_zip_reader_init_file(static_cast<mz_zip_archive*>(MinizArchiver), TCHAR_TO_UTF8(*ArchivePath), 0))
+	// Mapping the archive, so that entries are read straight from the mapped region and the OS page cache does the buffering
+	MappedFileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*ArchivePath);
+
+	if (MappedFileHandle && MappedFileHandle->GetFileSize() > 0)
+	{
+		MappedFileRegion = MappedFileHandle->MapRegion(0, MappedFileHandle->GetFileSize());
+	}
+
+	// Reading the archive from the mapped region, or from the file path if mapping is not supported
+	const bool bOpened{MappedFileRegion
+		                   ? static_cast<bool>(mz_zip_reader_init_mem(static_cast<mz_zip_archive*>(MinizArchiver), MappedFileRegion->GetMappedPtr(), static_cast<size_t>(MappedFileRegion->GetMappedSize()), 0))
+		                   : static_cast<bool>(mz_zip_reader_init_file(static_cast<mz_zip_archive*>(MinizArchiver), TCHAR_TO_UTF8(*ArchivePath), 0))};
+
+	if (!bOpened)
 	{
 		ReportError(ERuntimeArchiverErrorCode::NotInitialized, FString::Printf(TEXT("An error occurred while opening zip archive '%s' to read"), *ArchivePath));
 		Reset();
 		return false;
 	}
 
+	OpenedArchivePath = ArchivePath;
+
 	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully opened zip archive '%s' in '%s' to read"), *GetName(), *ArchivePath);
 
 	return true;
 }
 
-bool URuntimeArchiverZip::OpenArchiveFromMemory(const TArray64<uint8>& ArchiveData)
+bool URuntimeArchiverZip::OpenArchiveFromMemoryView(TArrayView64<const uint8> ArchiveData)
 {
-	if (!Super::OpenArchiveFromMemory(ArchiveData))
+	if (!Super::OpenArchiveFromMemoryView(ArchiveData))
 	{
 		return false;
 	}
@@ -311,6 +416,325 @@ bool URuntimeArchiverZip::ExtractEntryToMemory(const FRuntimeArchiveEntry& Entry
 	return true;
 }
 
+bool URuntimeArchiverZip::ExtractEntryToFileHandle(const FRuntimeArchiveEntry& EntryInfo, IFileHandle& FileHandle)
+{
+	if (!IsInitialized())
+	{
+		ReportError(ERuntimeArchiverErrorCode::NotInitialized, TEXT("Archiver is not initialized"));
+		return false;
+	}
+
+	if (Mode != ERuntimeArchiverMode::Read)
+	{
+		ReportError(ERuntimeArchiverErrorCode::UnsupportedMode, FString::Printf(TEXT("Only '%s' mode is supported for extracting zip entries (using mode: '%s')"), *UEnum::GetValueAsName(ERuntimeArchiverMode::Read).ToString(), *UEnum::GetValueAsName(Mode).ToString()));
+		return false;
+	}
+
+	if (EntryInfo.bIsDirectory)
+	{
+		ReportError(ERuntimeArchiverErrorCode::UnsupportedLocation, TEXT("It is impossible to extract directory entry into file"));
+		return false;
+	}
+
+	int32 NumOfArchiveEntries;
+	if (!GetArchiveEntries(NumOfArchiveEntries) || EntryInfo.Index < 0 || EntryInfo.Index > (NumOfArchiveEntries - 1))
+	{
+		ReportError(ERuntimeArchiverErrorCode::InvalidArgument, FString::Printf(TEXT("Zip entry index %d is invalid. Min index: 0, Max index: %d"), EntryInfo.Index, (NumOfArchiveEntries - 1)));
+		return false;
+	}
+
+	// Extracting through the callback, so the memory usage does not depend on the entry size
+	if (!ExtractZipEntryToFileHandle(static_cast<mz_zip_archive*>(MinizArchiver), EntryInfo.Index, FileHandle))
+	{
+		ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to extract zip entry '%s' into file"), *EntryInfo.Name));
+		return false;
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully extracted zip entry '%s' into file"), *EntryInfo.Name);
+
+	return true;
+}
+
+bool URuntimeArchiverZip::AddEntriesFromStorage_Internal(const TArray<TPair<FString, FString>>& Entries, ERuntimeArchiverCompressionLevel CompressionLevel, const TFunction<void(int32)>& OnProgress)
+{
+	const int32 NumOfWorkers{GetNumOfWorkers(Entries.Num())};
+
+	if (!IsInitialized() || Mode != ERuntimeArchiverMode::Write || CompressionLevel == ERuntimeArchiverCompressionLevel::Compression0 || NumOfWorkers <= 1)
+	{
+		return Super::AddEntriesFromStorage_Internal(Entries, CompressionLevel, OnProgress);
+	}
+
+	/** Entry deflated by a worker, waiting to be appended to the archive */
+	struct FDeflatedEntry
+	{
+		FString EntryName;
+
+		/** Raw entry data. Only kept if the entry is to be stored without compression */
+		TArray64<uint8> UncompressedData;
+
+		void* CompressedData{nullptr};
+		size_t CompressedSize{0};
+		uint64 UncompressedSize{0};
+		mz_uint32 UncompressedCrc32{0};
+		bool bLoaded{false};
+	};
+
+	// Limits the amount of data held in memory at once while entries are being deflated
+	constexpr int64 MaxBatchSize{256 * 1024 * 1024};
+
+	IPlatformFile& PlatformFile{FPlatformFileManager::Get().GetPlatformFile()};
+	mz_zip_archive* MinizArchiverReal{static_cast<mz_zip_archive*>(MinizArchiver)};
+
+	const mz_uint CompressionFlags{tdefl_create_comp_flags_from_zip_params(static_cast<int>(CompressionLevel), -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY)};
+
+	int32 BatchStartIndex{0};
+
+	while (BatchStartIndex < Entries.Num())
+	{
+		// Collecting the batch of entries so that all workers are busy, but memory usage stays bounded
+		int32 BatchEndIndex{BatchStartIndex};
+		int64 BatchSize{0};
+
+		while (BatchEndIndex < Entries.Num() && (BatchEndIndex == BatchStartIndex || (BatchEndIndex - BatchStartIndex < NumOfWorkers * 4 && BatchSize < MaxBatchSize)))
+		{
+			BatchSize += FMath::Max<int64>(PlatformFile.FileSize(*Entries[BatchEndIndex].Value), 0);
+			++BatchEndIndex;
+		}
+
+		TArray<FDeflatedEntry> DeflatedEntries;
+		DeflatedEntries.SetNum(BatchEndIndex - BatchStartIndex);
+
+		// Deflating entries concurrently
+		ParallelFor(DeflatedEntries.Num(), [&](int32 BatchIndex)
+		{
+			FDeflatedEntry& DeflatedEntry = DeflatedEntries[BatchIndex];
+
+			DeflatedEntry.EntryName = Entries[BatchStartIndex + BatchIndex].Key;
+			FPaths::NormalizeFilename(DeflatedEntry.EntryName);
+
+			FString FilePath{Entries[BatchStartIndex + BatchIndex].Value};
+			FPaths::NormalizeFilename(FilePath);
+
+			if (!FFileHelper::LoadFileToArray(DeflatedEntry.UncompressedData, *FilePath))
+			{
+				return;
+			}
+
+			DeflatedEntry.bLoaded = true;
+			DeflatedEntry.UncompressedSize = static_cast<uint64>(DeflatedEntry.UncompressedData.Num());
+			DeflatedEntry.UncompressedCrc32 = static_cast<mz_uint32>(mz_crc32(MZ_CRC32_INIT, DeflatedEntry.UncompressedData.GetData(), static_cast<size_t>(DeflatedEntry.UncompressedData.Num())));
+
+			// Tiny entries are stored by miniz anyway
+			if (DeflatedEntry.UncompressedSize <= 3)
+			{
+				return;
+			}
+
+			DeflatedEntry.CompressedData = tdefl_compress_mem_to_heap(DeflatedEntry.UncompressedData.GetData(), static_cast<size_t>(DeflatedEntry.UncompressedData.Num()), &DeflatedEntry.CompressedSize, static_cast<int>(CompressionFlags));
+
+			if (DeflatedEntry.CompressedData)
+			{
+				DeflatedEntry.UncompressedData.Empty();
+			}
+		});
+
+		// Appending the local headers and data in the original order. The central directory is written when the archive is finalized
+		bool bResult{true};
+
+		for (int32 BatchIndex = 0; BatchIndex < DeflatedEntries.Num(); ++BatchIndex)
+		{
+			FDeflatedEntry& DeflatedEntry = DeflatedEntries[BatchIndex];
+
+			if (bResult)
+			{
+				if (!DeflatedEntry.bLoaded)
+				{
+					ReportError(ERuntimeArchiverErrorCode::AddError, FString::Printf(TEXT("Unable to load file '%s' for entry '%s'"), *Entries[BatchStartIndex + BatchIndex].Value, *DeflatedEntry.EntryName));
+					bResult = false;
+				}
+				else if (DeflatedEntry.CompressedData)
+				{
+					bResult = static_cast<bool>(mz_zip_writer_add_mem_ex(MinizArchiverReal, TCHAR_TO_UTF8(*DeflatedEntry.EntryName),
+					                                                     DeflatedEntry.CompressedData, DeflatedEntry.CompressedSize,
+					                                                     nullptr, 0,
+					                                                     static_cast<mz_uint>(CompressionLevel) | MZ_ZIP_FLAG_COMPRESSED_DATA, DeflatedEntry.UncompressedSize, DeflatedEntry.UncompressedCrc32));
+				}
+				else
+				{
+					bResult = AddEntryFromMemory(DeflatedEntry.EntryName, DeflatedEntry.UncompressedData, CompressionLevel);
+				}
+
+				if (!bResult)
+				{
+					ReportError(ERuntimeArchiverErrorCode::AddError, FString::Printf(TEXT("Unable to add zip entry '%s' from file '%s'"), *DeflatedEntry.EntryName, *Entries[BatchStartIndex + BatchIndex].Value));
+				}
+			}
+
+			if (DeflatedEntry.CompressedData)
+			{
+				mz_free(DeflatedEntry.CompressedData);
+				DeflatedEntry.CompressedData = nullptr;
+			}
+		}
+
+		if (!bResult)
+		{
+			return false;
+		}
+
+		BatchStartIndex = BatchEndIndex;
+
+		OnProgress(static_cast<float>(BatchStartIndex) / Entries.Num() * 100);
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully added %d zip entries using %d workers"), Entries.Num(), NumOfWorkers);
+
+	return true;
+}
+
+bool URuntimeArchiverZip::ExtractEntriesToStorage_Internal(const TArray<TPair<FRuntimeArchiveEntry, FString>>& Entries, bool bForceOverwrite, const TFunction<void(int32)>& OnProgress)
+{
+	if (!IsInitialized() || Mode != ERuntimeArchiverMode::Read)
+	{
+		return Super::ExtractEntriesToStorage_Internal(Entries, bForceOverwrite, OnProgress);
+	}
+
+	TArray<int32> FileEntryIndices;
+	int64 TotalUncompressedSize{0};
+
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		if (!Entries[EntryIndex].Key.bIsDirectory)
+		{
+			FileEntryIndices.Add(EntryIndex);
+			TotalUncompressedSize += Entries[EntryIndex].Key.UncompressedSize;
+		}
+	}
+
+	const int32 NumOfWorkers{GetNumOfWorkers(FileEntryIndices.Num())};
+
+	if (NumOfWorkers <= 1)
+	{
+		return Super::ExtractEntriesToStorage_Internal(Entries, bForceOverwrite, OnProgress);
+	}
+
+	// Directories are created up front, so the workers only have to deal with files
+	for (const TPair<FRuntimeArchiveEntry, FString>& Entry : Entries)
+	{
+		if (Entry.Key.bIsDirectory && !ExtractEntryToStorage(Entry.Key, Entry.Value, bForceOverwrite))
+		{
+			return false;
+		}
+	}
+
+	// Taking the largest entries first, so that a big entry does not end up being the only work left at the end
+	FileEntryIndices.Sort([&Entries](int32 A, int32 B)
+	{
+		return Entries[A].Key.CompressedSize > Entries[B].Key.CompressedSize;
+	});
+
+	mz_zip_archive* MinizArchiverReal{static_cast<mz_zip_archive*>(MinizArchiver)};
+
+	std::atomic<int32> NextFileEntryIndex{0};
+	std::atomic<int64> ExtractedUncompressedSize{0};
+	std::atomic<int32> LastReportedPercentage{0};
+	std::atomic<bool> bFailed{false};
+
+	ParallelFor(NumOfWorkers, [&](int32 WorkerIndex)
+	{
+		// Each worker needs its own reader since miniz readers are not thread-safe
+		mz_zip_archive WorkerArchiver;
+		mz_zip_zero_struct(&WorkerArchiver);
+
+		const bool bReaderInitialized{MinizArchiverReal->m_zip_type == MZ_ZIP_TYPE_MEMORY
+			                              ? static_cast<bool>(mz_zip_reader_init_mem(&WorkerArchiver, MinizArchiverReal->m_pState->m_pMem, static_cast<size_t>(MinizArchiverReal->m_archive_size), 0))
+			                              : static_cast<bool>(mz_zip_reader_init_file(&WorkerArchiver, TCHAR_TO_UTF8(*OpenedArchivePath), 0))};
+
+		if (!bReaderInitialized)
+		{
+			URuntimeArchiverBase::ReportError(ERuntimeArchiverErrorCode::NotInitialized, FString::Printf(TEXT("Unable to open zip reader for worker %d"), WorkerIndex));
+			bFailed = true;
+			return;
+		}
+
+		IPlatformFile& PlatformFile{FPlatformFileManager::Get().GetPlatformFile()};
+
+		while (!bFailed)
+		{
+			const int32 QueueIndex{NextFileEntryIndex++};
+
+			if (QueueIndex >= FileEntryIndices.Num())
+			{
+				break;
+			}
+
+			const FRuntimeArchiveEntry& Entry = Entries[FileEntryIndices[QueueIndex]].Key;
+
+			FString FilePath{Entries[FileEntryIndices[QueueIndex]].Value};
+			FPaths::NormalizeFilename(FilePath);
+
+			if (!bForceOverwrite && PlatformFile.FileExists(*FilePath))
+			{
+				URuntimeArchiverBase::ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("File '%s' already exists"), *FilePath));
+				bFailed = true;
+				break;
+			}
+
+			const FString DirectoryPath{FPaths::GetPath(FilePath)};
+			if (!DirectoryPath.IsEmpty() && !PlatformFile.CreateDirectoryTree(*DirectoryPath))
+			{
+				URuntimeArchiverBase::ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to create subdirectory '%s' to extract entry '%s'"), *DirectoryPath, *Entry.Name));
+				bFailed = true;
+				break;
+			}
+
+			bool bExtracted{false};
+			{
+				TUniquePtr<IFileHandle> FileHandle{PlatformFile.OpenWrite(*FilePath)};
+				bExtracted = FileHandle.IsValid() && ExtractZipEntryToFileHandle(&WorkerArchiver, Entry.Index, *FileHandle);
+			}
+
+			if (!bExtracted)
+			{
+				PlatformFile.DeleteFile(*FilePath);
+				URuntimeArchiverBase::ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to extract zip entry '%s' to file '%s'"), *Entry.Name, *FilePath));
+				bFailed = true;
+				break;
+			}
+
+			// Aggregating the progress of all workers and only reporting when the percentage grows
+			const int64 NewExtractedUncompressedSize{ExtractedUncompressedSize += Entry.UncompressedSize};
+			const int32 Percentage{TotalUncompressedSize > 0 ? static_cast<int32>(NewExtractedUncompressedSize * 100 / TotalUncompressedSize) : 100};
+
+			int32 PreviousPercentage{LastReportedPercentage};
+			while (Percentage > PreviousPercentage && !LastReportedPercentage.compare_exchange_weak(PreviousPercentage, Percentage))
+			{
+			}
+
+			if (Percentage > PreviousPercentage)
+			{
+				OnProgress(Percentage);
+			}
+		}
+
+		mz_zip_reader_end(&WorkerArchiver);
+	});
+
+	if (bFailed)
+	{
+		return false;
+	}
+
+	if (LastReportedPercentage < 100)
+	{
+		OnProgress(100);
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully extracted %d zip entries using %d workers"), FileEntryIndices.Num(), NumOfWorkers);
+
+	return true;
+}
+
 bool URuntimeArchiverZip::Initialize()
 {
 	if (!Super::Initialize())
@@ -345,6 +769,15 @@ void URuntimeArchiverZip::Reset()
 		MinizArchiver = nullptr;
 	}
 
+	OpenedArchivePath.Empty();
+
+	// The region has to be unmapped before the file handle is closed
+	delete MappedFileRegion;
+	MappedFileRegion = nullptr;
+
+	delete MappedFileHandle;
+	MappedFileHandle = nullptr;
+
 	Super::Reset();
 
 	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully uninitialized zip archiver '%s'"), *GetName());
@@ -0,0 +1,289 @@
+﻿// Georgy Treshchev 2023.
+
+#include "ArchiverZip/RuntimeArchiverZipCentralDirectory.h"
+
+#include "RuntimeArchiverDefines.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/ByteSwap.h"
+
+namespace
+{
+	/** Zip record signatures */
+	constexpr uint32 CentralHeaderSignature = 0x02014b50;
+	constexpr uint32 Zip64EndOfCentralDirectorySignature = 0x06064b50;
+	constexpr uint32 Zip64EndOfCentralDirectoryLocatorSignature = 0x07064b50;
+	constexpr uint32 EndOfCentralDirectorySignature = 0x06054b50;
+
+	/** Sizes of the fixed parts of the zip records */
+	constexpr int64 CentralHeaderSize = 46;
+	constexpr int64 Zip64EndOfCentralDirectorySize = 56;
+	constexpr int64 Zip64EndOfCentralDirectoryLocatorSize = 20;
+	constexpr int64 EndOfCentralDirectorySize = 22;
+
+	/** The archive comment following the end of central directory record is at most this long */
+	constexpr int64 MaxCommentSize = MAX_uint16;
+
+	/** Identifier of the extra field containing 64-bit sizes and offsets */
+	constexpr uint16 Zip64ExtraFieldId = 0x0001;
+
+	uint16 ReadUInt16(const uint8* Data)
+	{
+		uint16 Value;
+		FMemory::Memcpy(&Value, Data, sizeof(Value));
+		return INTEL_ORDER16(Value);
+	}
+
+	uint32 ReadUInt32(const uint8* Data)
+	{
+		uint32 Value;
+		FMemory::Memcpy(&Value, Data, sizeof(Value));
+		return INTEL_ORDER32(Value);
+	}
+
+	uint64 ReadUInt64(const uint8* Data)
+	{
+		uint64 Value;
+		FMemory::Memcpy(&Value, Data, sizeof(Value));
+		return INTEL_ORDER64(Value);
+	}
+
+	FString ReadEntryName(const uint8* Data, int32 Size)
+	{
+		const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data), Size);
+		return FString(Converter.Length(), Converter.Get());
+	}
+
+	/**
+	 * Read 64-bit values from the zip64 extra field for the sizes and the offset that do not fit into 32 bits
+	 */
+	void ReadZip64Fields(const uint8* ExtraData, int32 ExtraSize, FRuntimeArchiverZipCentralDirectory::FEntry& Entry)
+	{
+		int32 Offset{0};
+		while (Offset + 4 <= ExtraSize)
+		{
+			const uint16 FieldId{ReadUInt16(ExtraData + Offset)};
+			const uint16 FieldSize{ReadUInt16(ExtraData + Offset + 2)};
+			Offset += 4;
+
+			if (FieldId == Zip64ExtraFieldId)
+			{
+				// The values are present in this order, but only those that do not fit into 32 bits
+				int32 FieldOffset{0};
+				for (int64* Value : {&Entry.UncompressedSize, &Entry.CompressedSize, &Entry.LocalHeaderOffset})
+				{
+					if (*Value == MAX_uint32 && FieldOffset + 8 <= FieldSize && Offset + FieldOffset + 8 <= ExtraSize)
+					{
+						*Value = static_cast<int64>(ReadUInt64(ExtraData + Offset + FieldOffset));
+						FieldOffset += 8;
+					}
+				}
+
+				return;
+			}
+
+			Offset += FieldSize;
+		}
+	}
+}
+
+FRuntimeArchiverZipCentralDirectory::FRuntimeArchiverZipCentralDirectory()
+	: CentralDirectoryOffset(0)
+{
+}
+
+bool FRuntimeArchiverZipCentralDirectory::Read(const uint8* TailData, int64 TailSize, int64 ArchiveSize, int64& RequiredTailSize)
+{
+	Entries.Reset();
+	CentralDirectoryOffset = 0;
+	ErrorMessage.Reset();
+	RequiredTailSize = TailSize;
+
+	if (TailSize < 0 || TailSize > ArchiveSize)
+	{
+		return Fail(FString::Printf(TEXT("Unable to read zip central directory because the tail size %lld does not match the archive size %lld"), TailSize, ArchiveSize));
+	}
+
+	const int64 TailOffset{ArchiveSize - TailSize};
+
+	// The end of central directory record is only followed by the archive comment, so it is searched for backwards
+	int64 EndRecordPosition{INDEX_NONE};
+	for (int64 Position = TailSize - EndOfCentralDirectorySize; Position >= 0 && TailSize - Position <= EndOfCentralDirectorySize + MaxCommentSize; --Position)
+	{
+		if (ReadUInt32(TailData + Position) == EndOfCentralDirectorySignature && Position + EndOfCentralDirectorySize + ReadUInt16(TailData + Position + 20) <= TailSize)
+		{
+			EndRecordPosition = Position;
+			break;
+		}
+	}
+
+	if (EndRecordPosition == INDEX_NONE)
+	{
+		const int64 MaxTailSize{FMath::Min(ArchiveSize, EndOfCentralDirectorySize + MaxCommentSize)};
+		if (TailSize < MaxTailSize)
+		{
+			RequiredTailSize = MaxTailSize;
+			return false;
+		}
+
+		return Fail(TEXT("Unable to read zip central directory because the end of central directory record was not found"));
+	}
+
+	const uint8* EndRecord{TailData + EndRecordPosition};
+	int64 NumOfEntries{ReadUInt16(EndRecord + 10)};
+	int64 CentralDirectorySize{ReadUInt32(EndRecord + 12)};
+	CentralDirectoryOffset = ReadUInt32(EndRecord + 16);
+
+	// The zip64 locator directly precedes the end of central directory record if the archive is too large for 32-bit values
+	const int64 LocatorPosition{EndRecordPosition - Zip64EndOfCentralDirectoryLocatorSize};
+	if (LocatorPosition < 0 && TailOffset > 0)
+	{
+		RequiredTailSize = FMath::Min(ArchiveSize, TailSize + Zip64EndOfCentralDirectoryLocatorSize);
+		return false;
+	}
+
+	if (LocatorPosition >= 0 && ReadUInt32(TailData + LocatorPosition) == Zip64EndOfCentralDirectoryLocatorSignature)
+	{
+		const int64 Zip64RecordOffset{static_cast<int64>(ReadUInt64(TailData + LocatorPosition + 8))};
+		if (Zip64RecordOffset < 0 || Zip64RecordOffset + Zip64EndOfCentralDirectorySize > TailOffset + LocatorPosition)
+		{
+			return Fail(TEXT("Unable to read zip central directory because the zip64 end of central directory record is out of range"));
+		}
+
+		if (Zip64RecordOffset < TailOffset)
+		{
+			RequiredTailSize = ArchiveSize - Zip64RecordOffset;
+			return false;
+		}
+
+		const uint8* Zip64Record{TailData + (Zip64RecordOffset - TailOffset)};
+		if (ReadUInt32(Zip64Record) != Zip64EndOfCentralDirectorySignature)
+		{
+			return Fail(TEXT("Unable to read zip central directory because the zip64 end of central directory record is invalid"));
+		}
+
+		NumOfEntries = static_cast<int64>(ReadUInt64(Zip64Record + 32));
+		CentralDirectorySize = static_cast<int64>(ReadUInt64(Zip64Record + 40));
+		CentralDirectoryOffset = static_cast<int64>(ReadUInt64(Zip64Record + 48));
+	}
+
+	const int64 CentralDirectoryEnd{CentralDirectoryOffset + CentralDirectorySize};
+	if (CentralDirectoryOffset < 0 || CentralDirectorySize < 0 || NumOfEntries < 0 || CentralDirectoryEnd > TailOffset + EndRecordPosition)
+	{
+		return Fail(TEXT("Unable to read zip central directory because it is out of range"));
+	}
+
+	if (CentralDirectoryOffset < TailOffset)
+	{
+		RequiredTailSize = ArchiveSize - CentralDirectoryOffset;
+		return false;
+	}
+
+	const uint8* Header{TailData + (CentralDirectoryOffset - TailOffset)};
+	const uint8* HeadersEnd{TailData + (CentralDirectoryEnd - TailOffset)};
+
+	Entries.Reserve(FMath::Min(NumOfEntries, CentralDirectorySize / CentralHeaderSize));
+
+	for (int64 EntryIndex = 0; EntryIndex < NumOfEntries; ++EntryIndex)
+	{
+		if (HeadersEnd - Header < CentralHeaderSize || ReadUInt32(Header) != CentralHeaderSignature)
+		{
+			return Fail(TEXT("Unable to read zip central directory because it is truncated"));
+		}
+
+		const uint16 NameSize{ReadUInt16(Header + 28)};
+		const uint16 ExtraSize{ReadUInt16(Header + 30)};
+		const uint16 CommentSize{ReadUInt16(Header + 32)};
+
+		if (HeadersEnd - Header < CentralHeaderSize + NameSize + ExtraSize + CommentSize)
+		{
+			return Fail(TEXT("Unable to read zip central directory because it is truncated"));
+		}
+
+		FEntry Entry;
+		Entry.Flags = ReadUInt16(Header + 8);
+		Entry.Method = ReadUInt16(Header + 10);
+		Entry.DosTime = ReadUInt32(Header + 12);
+		Entry.Crc32 = ReadUInt32(Header + 16);
+		Entry.CompressedSize = ReadUInt32(Header + 20);
+		Entry.UncompressedSize = ReadUInt32(Header + 24);
+		Entry.LocalHeaderOffset = ReadUInt32(Header + 42);
+		Entry.EndOffset = 0;
+		Entry.Name = ReadEntryName(Header + CentralHeaderSize, NameSize);
+
+		ReadZip64Fields(Header + CentralHeaderSize + NameSize, ExtraSize, Entry);
+
+		if (Entry.LocalHeaderOffset < 0 || Entry.LocalHeaderOffset >= CentralDirectoryOffset)
+		{
+			return Fail(FString::Printf(TEXT("Unable to read zip central directory because the local header of entry '%s' is out of range"), *Entry.Name));
+		}
+
+		Entries.Add(MoveTemp(Entry));
+		Header += CentralHeaderSize + NameSize + ExtraSize + CommentSize;
+	}
+
+	// Each entry occupies the archive up to the next entry, or up to the central directory for the last one
+	Entries.Sort([](const FEntry& A, const FEntry& B)
+	{
+		return A.LocalHeaderOffset < B.LocalHeaderOffset;
+	});
+
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		FEntry& Entry{Entries[EntryIndex]};
+		Entry.EndOffset = Entries.IsValidIndex(EntryIndex + 1) ? Entries[EntryIndex + 1].LocalHeaderOffset : CentralDirectoryOffset;
+
+		if (Entry.EndOffset <= Entry.LocalHeaderOffset)
+		{
+			return Fail(FString::Printf(TEXT("Unable to read zip central directory because entry '%s' overlaps another entry"), *Entry.Name));
+		}
+	}
+
+	return true;
+}
+
+bool FRuntimeArchiverZipCentralDirectory::ReadFromFile(const FString& ArchivePath)
+{
+	TUniquePtr<IFileHandle> FileHandle{FPlatformFileManager::Get().GetPlatformFile().OpenRead(*ArchivePath)};
+	if (!FileHandle.IsValid())
+	{
+		return Fail(FString::Printf(TEXT("Unable to read zip central directory because the archive '%s' cannot be opened"), *ArchivePath));
+	}
+
+	const int64 ArchiveSize{FileHandle->Size()};
+	int64 TailSize{FMath::Min(ArchiveSize, DefaultTailSize)};
+	TArray64<uint8> TailData;
+
+	// More of the tail is only read if the archive comment, the zip64 records or the central directory do not fit into the default tail size
+	for (int32 Attempt = 0; Attempt < 4; ++Attempt)
+	{
+		TailData.SetNumUninitialized(TailSize);
+		if (!FileHandle->Seek(ArchiveSize - TailSize) || !FileHandle->Read(TailData.GetData(), TailSize))
+		{
+			return Fail(FString::Printf(TEXT("Unable to read zip central directory because the archive '%s' cannot be read"), *ArchivePath));
+		}
+
+		int64 RequiredTailSize;
+		if (Read(TailData.GetData(), TailSize, ArchiveSize, RequiredTailSize))
+		{
+			return true;
+		}
+
+		if (RequiredTailSize <= TailSize)
+		{
+			return false;
+		}
+
+		TailSize = FMath::Min(RequiredTailSize, ArchiveSize);
+	}
+
+	return Fail(FString::Printf(TEXT("Unable to read zip central directory of the archive '%s'"), *ArchivePath));
+}
+
+bool FRuntimeArchiverZipCentralDirectory::Fail(const FString& Message)
+{
+	UE_LOG(LogRuntimeArchiver, Error, TEXT("%s"), *Message);
+
+	ErrorMessage = Message;
+	return false;
+}
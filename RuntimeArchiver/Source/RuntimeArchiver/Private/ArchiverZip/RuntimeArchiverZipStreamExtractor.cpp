@@ -0,0 +1,661 @@
+﻿// Georgy Treshchev 2023.
+
+#include "ArchiverZip/RuntimeArchiverZipStreamExtractor.h"
+
+#include "RuntimeArchiverDefines.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/ByteSwap.h"
+#include "Misc/Paths.h"
+
+#if !defined(__ORDER_LITTLE_ENDIAN__)
+#define __ORDER_LITTLE_ENDIAN__ PLATFORM_LITTLE_ENDIAN
+#endif
+
+THIRD_PARTY_INCLUDES_START
+#include "miniz.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace
+{
+	/** Zip record signatures */
+	constexpr uint32 LocalHeaderSignature = 0x04034b50;
+	constexpr uint32 DataDescriptorSignature = 0x08074b50;
+	constexpr uint32 CentralHeaderSignature = 0x02014b50;
+	constexpr uint32 Zip64EndOfCentralDirectorySignature = 0x06064b50;
+	constexpr uint32 EndOfCentralDirectorySignature = 0x06054b50;
+
+	/** Sizes of the fixed parts of the zip records */
+	constexpr int64 LocalHeaderSize = 30;
+	constexpr int64 CentralHeaderSize = 46;
+
+	/** General purpose flags */
+	constexpr uint16 FlagEncrypted = 0x0001;
+	constexpr uint16 FlagDataDescriptor = 0x0008;
+
+	/** Supported compression methods */
+	constexpr uint16 MethodStored = 0;
+	constexpr uint16 MethodDeflated = 8;
+
+	/** Identifier of the extra field containing 64-bit sizes */
+	constexpr uint16 Zip64ExtraFieldId = 0x0001;
+
+	uint16 ReadUInt16(const uint8* Data)
+	{
+		uint16 Value;
+		FMemory::Memcpy(&Value, Data, sizeof(Value));
+		return INTEL_ORDER16(Value);
+	}
+
+	uint32 ReadUInt32(const uint8* Data)
+	{
+		uint32 Value;
+		FMemory::Memcpy(&Value, Data, sizeof(Value));
+		return INTEL_ORDER32(Value);
+	}
+
+	uint64 ReadUInt64(const uint8* Data)
+	{
+		uint64 Value;
+		FMemory::Memcpy(&Value, Data, sizeof(Value));
+		return INTEL_ORDER64(Value);
+	}
+
+	FString ReadEntryName(const uint8* Data, int32 Size)
+	{
+		const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data), Size);
+		return FString(Converter.Length(), Converter.Get());
+	}
+
+	/**
+	 * Read 64-bit sizes from the zip64 extra field for the sizes that do not fit into 32 bits
+	 */
+	void ReadZip64Sizes(const uint8* ExtraData, int32 ExtraSize, int64& UncompressedSize, int64& CompressedSize, bool& bZip64)
+	{
+		int32 Offset{0};
+		while (Offset + 4 <= ExtraSize)
+		{
+			const uint16 FieldId{ReadUInt16(ExtraData + Offset)};
+			const uint16 FieldSize{ReadUInt16(ExtraData + Offset + 2)};
+			Offset += 4;
+
+			if (FieldId == Zip64ExtraFieldId)
+			{
+				int32 FieldOffset{0};
+				bZip64 = true;
+
+				if (UncompressedSize == MAX_uint32 && FieldOffset + 8 <= FieldSize && Offset + FieldOffset + 8 <= ExtraSize)
+				{
+					UncompressedSize = static_cast<int64>(ReadUInt64(ExtraData + Offset + FieldOffset));
+					FieldOffset += 8;
+				}
+
+				if (CompressedSize == MAX_uint32 && FieldOffset + 8 <= FieldSize && Offset + FieldOffset + 8 <= ExtraSize)
+				{
+					CompressedSize = static_cast<int64>(ReadUInt64(ExtraData + Offset + FieldOffset));
+				}
+
+				return;
+			}
+
+			Offset += FieldSize;
+		}
+	}
+}
+
+FRuntimeArchiverZipStreamExtractor::FRuntimeArchiverZipStreamExtractor(const FString& DirectoryPath, bool bForceOverwrite)
+	: DirectoryPath(FPaths::ConvertRelativePathToFull(DirectoryPath))
+  , bForceOverwrite(bForceOverwrite)
+  , PendingOffset(0)
+  , State(EState::Signature)
+  , EntryFlags(0)
+  , EntryMethod(0)
+  , EntryHeaderCrc32(0)
+  , EntryHeaderCompressedSize(0)
+  , EntryHeaderUncompressedSize(0)
+  , bEntryZip64(false)
+  , bEntrySkipped(false)
+  , EntryConsumedSize(0)
+  , EntryWrittenSize(0)
+  , EntryCrc32(MZ_CRC32_INIT)
+  , Inflator(nullptr)
+  , DictionaryOffset(0)
+  , NumOfAppendedBytes(0)
+  , NumOfExtractedBytes(0)
+  , NumOfSkippedBytes(0)
+  , bFailed(false)
+  , bFinished(false)
+{
+	FPaths::NormalizeDirectoryName(this->DirectoryPath);
+
+	IPlatformFile& PlatformFile{FPlatformFileManager::Get().GetPlatformFile()};
+	if (!PlatformFile.DirectoryExists(*this->DirectoryPath) && !PlatformFile.CreateDirectoryTree(*this->DirectoryPath))
+	{
+		Fail(FString::Printf(TEXT("Unable to create directory '%s' to extract zip archive to"), *this->DirectoryPath));
+	}
+}
+
+FRuntimeArchiverZipStreamExtractor::~FRuntimeArchiverZipStreamExtractor()
+{
+	// An entry that is still being written is incomplete
+	CloseEntryFile(true);
+
+	if (Inflator)
+	{
+		tinfl_decompressor_free(static_cast<tinfl_decompressor*>(Inflator));
+		Inflator = nullptr;
+	}
+}
+
+bool FRuntimeArchiverZipStreamExtractor::Append(const uint8* Data, int64 Size)
+{
+	if (bFailed)
+	{
+		return false;
+	}
+
+	if (bFinished)
+	{
+		return Fail(TEXT("Unable to append data to zip stream extractor because it has already been finished"));
+	}
+
+	if (Size <= 0)
+	{
+		return true;
+	}
+
+	PendingData.Append(Data, Size);
+	NumOfAppendedBytes += Size;
+
+	if (!ProcessPendingData())
+	{
+		return false;
+	}
+
+	// The central directory is kept until the end, everything else that has been processed is dropped
+	if (State != EState::CentralDirectory && PendingOffset > 0)
+	{
+		PendingData.RemoveAt(0, PendingOffset, false);
+		PendingOffset = 0;
+	}
+
+	return true;
+}
+
+bool FRuntimeArchiverZipStreamExtractor::Finish()
+{
+	if (bFailed)
+	{
+		return false;
+	}
+
+	bFinished = true;
+
+	if (State != EState::CentralDirectory)
+	{
+		return Fail(FString::Printf(TEXT("Unable to finish extracting zip archive because it is truncated (%lld bytes appended)"), NumOfAppendedBytes));
+	}
+
+	if (!ValidateCentralDirectory())
+	{
+		return false;
+	}
+
+	PendingData.Empty();
+	PendingOffset = 0;
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully extracted %d zip entries (%lld bytes, %lld bytes skipped) to '%s' while streaming %lld bytes of archive data"), ExtractedEntries.Num(), NumOfExtractedBytes, NumOfSkippedBytes, *DirectoryPath, NumOfAppendedBytes);
+	return true;
+}
+
+bool FRuntimeArchiverZipStreamExtractor::ProcessPendingData()
+{
+	bool bNeedMoreData{false};
+
+	while (!bNeedMoreData)
+	{
+		switch (State)
+		{
+		case EState::Signature:
+			{
+				if (GetNumOfPendingBytes() < 4)
+				{
+					bNeedMoreData = true;
+					break;
+				}
+
+				const uint32 Signature{ReadUInt32(GetPendingBytes())};
+				if (Signature == LocalHeaderSignature)
+				{
+					State = EState::LocalHeader;
+				}
+				else if (Signature == CentralHeaderSignature || Signature == Zip64EndOfCentralDirectorySignature || Signature == EndOfCentralDirectorySignature)
+				{
+					State = EState::CentralDirectory;
+				}
+				else
+				{
+					return Fail(FString::Printf(TEXT("Unexpected zip record signature 0x%08x at offset %lld"), Signature, NumOfAppendedBytes - GetNumOfPendingBytes()));
+				}
+				break;
+			}
+		case EState::LocalHeader:
+			{
+				if (!ReadLocalHeader(bNeedMoreData))
+				{
+					return false;
+				}
+				break;
+			}
+		case EState::EntryData:
+			{
+				if (!ReadEntryData(bNeedMoreData))
+				{
+					return false;
+				}
+				break;
+			}
+		case EState::DataDescriptor:
+			{
+				if (!ReadDataDescriptor(bNeedMoreData))
+				{
+					return false;
+				}
+				break;
+			}
+		case EState::CentralDirectory:
+			{
+				// The central directory is validated once all data has been appended
+				bNeedMoreData = true;
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FRuntimeArchiverZipStreamExtractor::ReadLocalHeader(bool& bNeedMoreData)
+{
+	if (GetNumOfPendingBytes() < LocalHeaderSize)
+	{
+		bNeedMoreData = true;
+		return true;
+	}
+
+	const uint8* Header{GetPendingBytes()};
+	const uint16 NameSize{ReadUInt16(Header + 26)};
+	const uint16 ExtraSize{ReadUInt16(Header + 28)};
+
+	if (GetNumOfPendingBytes() < LocalHeaderSize + NameSize + ExtraSize)
+	{
+		bNeedMoreData = true;
+		return true;
+	}
+
+	EntryFlags = ReadUInt16(Header + 6);
+	EntryMethod = ReadUInt16(Header + 8);
+	EntryHeaderCrc32 = ReadUInt32(Header + 14);
+	EntryHeaderCompressedSize = ReadUInt32(Header + 18);
+	EntryHeaderUncompressedSize = ReadUInt32(Header + 22);
+	EntryName = ReadEntryName(Header + LocalHeaderSize, NameSize);
+	bEntryZip64 = false;
+
+	ReadZip64Sizes(Header + LocalHeaderSize + NameSize, ExtraSize, EntryHeaderUncompressedSize, EntryHeaderCompressedSize, bEntryZip64);
+
+	PendingOffset += LocalHeaderSize + NameSize + ExtraSize;
+
+	if (EntryFlags & FlagEncrypted)
+	{
+		return Fail(FString::Printf(TEXT("Unable to extract zip entry '%s' because it is encrypted"), *EntryName));
+	}
+
+	if (EntryMethod != MethodStored && EntryMethod != MethodDeflated)
+	{
+		return Fail(FString::Printf(TEXT("Unable to extract zip entry '%s' because its compression method %u is not supported"), *EntryName, EntryMethod));
+	}
+
+	// The end of stored data can only be found using the sizes, which are not known in advance if the data descriptor is used
+	if (EntryMethod == MethodStored && (EntryFlags & FlagDataDescriptor))
+	{
+		return Fail(FString::Printf(TEXT("Unable to extract stored zip entry '%s' while streaming because its size is only specified after its data"), *EntryName));
+	}
+
+	// Protecting against entries that would be extracted outside the directory
+	FString FilePath{FPaths::Combine(DirectoryPath, EntryName)};
+	FPaths::NormalizeFilename(FilePath);
+	if (EntryName.IsEmpty() || !FPaths::IsRelative(EntryName) || !FPaths::CollapseRelativeDirectories(FilePath) || !FPaths::IsUnderDirectory(FilePath, DirectoryPath))
+	{
+		return Fail(FString::Printf(TEXT("Unable to extract zip entry '%s' because its path is not valid"), *EntryName));
+	}
+
+	EntryFilePath = FilePath;
+	EntryConsumedSize = 0;
+	EntryWrittenSize = 0;
+	EntryCrc32 = MZ_CRC32_INIT;
+
+	IPlatformFile& PlatformFile{FPlatformFileManager::Get().GetPlatformFile()};
+	const bool bIsDirectory{EntryName.EndsWith(TEXT("/"))};
+
+	// Entries can only be skipped if it is known in advance where their data ends and what it is expected to be
+	bEntrySkipped = !bIsDirectory && !(EntryFlags & FlagDataDescriptor) && ShouldSkipEntry && ShouldSkipEntry(EntryName, EntryHeaderCrc32, EntryHeaderUncompressedSize);
+	if (bEntrySkipped)
+	{
+		State = EState::EntryData;
+		return true;
+	}
+
+	if (bIsDirectory)
+	{
+		if (!PlatformFile.DirectoryExists(*EntryFilePath) && !PlatformFile.CreateDirectoryTree(*EntryFilePath))
+		{
+			return Fail(FString::Printf(TEXT("Unable to create directory '%s' for zip entry '%s'"), *EntryFilePath, *EntryName));
+		}
+	}
+	else
+	{
+		const FString EntryDirectoryPath{FPaths::GetPath(EntryFilePath)};
+		if (!PlatformFile.DirectoryExists(*EntryDirectoryPath) && !PlatformFile.CreateDirectoryTree(*EntryDirectoryPath))
+		{
+			return Fail(FString::Printf(TEXT("Unable to create directory '%s' for zip entry '%s'"), *EntryDirectoryPath, *EntryName));
+		}
+
+		if (PlatformFile.FileExists(*EntryFilePath))
+		{
+			if (!bForceOverwrite)
+			{
+				return Fail(FString::Printf(TEXT("Unable to extract zip entry '%s' because file '%s' already exists"), *EntryName, *EntryFilePath));
+			}
+
+			// Replacing the existing file instead of writing into it, so that other hardlinks to it are left untouched
+			if (!PlatformFile.DeleteFile(*EntryFilePath))
+			{
+				return Fail(FString::Printf(TEXT("Unable to delete existing file '%s' to extract zip entry '%s'"), *EntryFilePath, *EntryName));
+			}
+		}
+
+		EntryFileHandle.Reset(PlatformFile.OpenWrite(*EntryFilePath));
+		if (!EntryFileHandle.IsValid())
+		{
+			return Fail(FString::Printf(TEXT("Unable to open file '%s' to extract zip entry '%s'"), *EntryFilePath, *EntryName));
+		}
+	}
+
+	if (EntryMethod == MethodDeflated)
+	{
+		if (!Inflator)
+		{
+			Inflator = tinfl_decompressor_alloc();
+			Dictionary.SetNumUninitialized(TINFL_LZ_DICT_SIZE);
+		}
+
+		if (!Inflator)
+		{
+			return Fail(TEXT("Unable to allocate memory for zip entry decompressor"));
+		}
+
+		tinfl_init(static_cast<tinfl_decompressor*>(Inflator));
+		DictionaryOffset = 0;
+	}
+
+	State = EState::EntryData;
+	return true;
+}
+
+bool FRuntimeArchiverZipStreamExtractor::ReadEntryData(bool& bNeedMoreData)
+{
+	if (bEntrySkipped)
+	{
+		return SkipEntryData(bNeedMoreData);
+	}
+
+	const bool bSizeKnown{!(EntryFlags & FlagDataDescriptor)};
+
+	if (EntryMethod == MethodStored)
+	{
+		const int64 SizeToWrite{FMath::Min<int64>(GetNumOfPendingBytes(), EntryHeaderCompressedSize - EntryConsumedSize)};
+		if (SizeToWrite > 0 && !WriteEntryData(GetPendingBytes(), SizeToWrite))
+		{
+			return false;
+		}
+
+		PendingOffset += SizeToWrite;
+		EntryConsumedSize += SizeToWrite;
+
+		if (EntryConsumedSize < EntryHeaderCompressedSize)
+		{
+			bNeedMoreData = true;
+			return true;
+		}
+
+		return CompleteEntry(EntryHeaderCrc32, EntryHeaderCompressedSize, EntryHeaderUncompressedSize);
+	}
+
+	while (true)
+	{
+		const int64 RemainingCompressedSize{bSizeKnown ? EntryHeaderCompressedSize - EntryConsumedSize : GetNumOfPendingBytes()};
+		const int64 AvailableSize{FMath::Min<int64>(GetNumOfPendingBytes(), RemainingCompressedSize)};
+		const bool bHasMoreInput{!bSizeKnown || AvailableSize < RemainingCompressedSize};
+
+		size_t InSize{static_cast<size_t>(AvailableSize)};
+		size_t OutSize{static_cast<size_t>(Dictionary.Num() - DictionaryOffset)};
+
+		const tinfl_status Status{tinfl_decompress(static_cast<tinfl_decompressor*>(Inflator), GetPendingBytes(), &InSize,
+		                                           Dictionary.GetData(), Dictionary.GetData() + DictionaryOffset, &OutSize, bHasMoreInput ? TINFL_FLAG_HAS_MORE_INPUT : 0)};
+
+		PendingOffset += InSize;
+		EntryConsumedSize += InSize;
+
+		if (OutSize > 0 && !WriteEntryData(Dictionary.GetData() + DictionaryOffset, OutSize))
+		{
+			return false;
+		}
+
+		DictionaryOffset = (DictionaryOffset + static_cast<int32>(OutSize)) & (TINFL_LZ_DICT_SIZE - 1);
+
+		if (Status < TINFL_STATUS_DONE)
+		{
+			return Fail(FString::Printf(TEXT("Unable to inflate zip entry '%s', the data is corrupted (status %d)"), *EntryName, static_cast<int32>(Status)));
+		}
+
+		if (Status == TINFL_STATUS_DONE)
+		{
+			return CompleteEntry(EntryHeaderCrc32, bSizeKnown ? EntryHeaderCompressedSize : EntryConsumedSize, EntryHeaderUncompressedSize);
+		}
+
+		// The inflator has consumed all available input and waits for more
+		if (Status == TINFL_STATUS_NEEDS_MORE_INPUT && GetNumOfPendingBytes() == 0)
+		{
+			bNeedMoreData = true;
+			return true;
+		}
+	}
+}
+
+bool FRuntimeArchiverZipStreamExtractor::SkipEntryData(bool& bNeedMoreData)
+{
+	const int64 SizeToSkip{FMath::Min<int64>(GetNumOfPendingBytes(), EntryHeaderCompressedSize - EntryConsumedSize)};
+	PendingOffset += SizeToSkip;
+	EntryConsumedSize += SizeToSkip;
+
+	if (EntryConsumedSize < EntryHeaderCompressedSize)
+	{
+		bNeedMoreData = true;
+		return true;
+	}
+
+	// The entry is validated against the central directory using the values from its local header
+	ExtractedEntries.Add(EntryName, FExtractedEntry{EntryHeaderCrc32, EntryHeaderUncompressedSize, true});
+	NumOfSkippedBytes += EntryHeaderUncompressedSize;
+	bEntrySkipped = false;
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Skipped zip entry '%s' (%lld bytes) while streaming"), *EntryName, EntryHeaderUncompressedSize);
+
+	State = EState::Signature;
+	return true;
+}
+
+bool FRuntimeArchiverZipStreamExtractor::ReadDataDescriptor(bool& bNeedMoreData)
+{
+	if (GetNumOfPendingBytes() < 4)
+	{
+		bNeedMoreData = true;
+		return true;
+	}
+
+	// The data descriptor signature is optional
+	const int64 SignatureSize{ReadUInt32(GetPendingBytes()) == DataDescriptorSignature ? 4 : 0};
+	const int64 SizeFieldSize{bEntryZip64 ? 8 : 4};
+	const int64 DescriptorSize{SignatureSize + 4 + SizeFieldSize * 2};
+
+	if (GetNumOfPendingBytes() < DescriptorSize)
+	{
+		bNeedMoreData = true;
+		return true;
+	}
+
+	const uint8* Descriptor{GetPendingBytes() + SignatureSize};
+	const uint32 Crc32{ReadUInt32(Descriptor)};
+	const int64 CompressedSize{bEntryZip64 ? static_cast<int64>(ReadUInt64(Descriptor + 4)) : ReadUInt32(Descriptor + 4)};
+	const int64 UncompressedSize{bEntryZip64 ? static_cast<int64>(ReadUInt64(Descriptor + 12)) : ReadUInt32(Descriptor + 8)};
+
+	PendingOffset += DescriptorSize;
+
+	// Clearing the flag, so that the entry is validated against the sizes from the descriptor
+	EntryFlags &= static_cast<uint16>(~FlagDataDescriptor);
+	return CompleteEntry(Crc32, CompressedSize, UncompressedSize);
+}
+
+bool FRuntimeArchiverZipStreamExtractor::CompleteEntry(uint32 ExpectedCrc32, int64 ExpectedCompressedSize, int64 ExpectedUncompressedSize)
+{
+	// The actual CRC-32 and sizes follow the data
+	if (EntryFlags & FlagDataDescriptor)
+	{
+		State = EState::DataDescriptor;
+		return true;
+	}
+
+	if (EntryCrc32 != ExpectedCrc32 || EntryWrittenSize != ExpectedUncompressedSize || EntryConsumedSize != ExpectedCompressedSize)
+	{
+		CloseEntryFile(true);
+		return Fail(FString::Printf(TEXT("Zip entry '%s' is corrupted: CRC-32 0x%08x, size %lld (%lld compressed), expected CRC-32 0x%08x, size %lld (%lld compressed)"),
+		                            *EntryName, EntryCrc32, EntryWrittenSize, EntryConsumedSize, ExpectedCrc32, ExpectedUncompressedSize, ExpectedCompressedSize));
+	}
+
+	const bool bIsFile{EntryFileHandle.IsValid()};
+	CloseEntryFile(false);
+
+	if (bIsFile)
+	{
+		ExtractedFilePaths.Add(EntryFilePath);
+	}
+
+	ExtractedEntries.Add(EntryName, FExtractedEntry{EntryCrc32, EntryWrittenSize, false});
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("Extracted zip entry '%s' (%lld bytes) while streaming"), *EntryName, EntryWrittenSize);
+
+	State = EState::Signature;
+	return true;
+}
+
+bool FRuntimeArchiverZipStreamExtractor::WriteEntryData(const uint8* Data, int64 Size)
+{
+	EntryCrc32 = static_cast<uint32>(mz_crc32(EntryCrc32, Data, static_cast<size_t>(Size)));
+	EntryWrittenSize += Size;
+	NumOfExtractedBytes += Size;
+
+	if (!EntryFileHandle.IsValid())
+	{
+		if (Size > 0)
+		{
+			return Fail(FString::Printf(TEXT("Unable to extract zip entry '%s' because it is a directory containing data"), *EntryName));
+		}
+
+		return true;
+	}
+
+	if (!EntryFileHandle->Write(Data, Size))
+	{
+		CloseEntryFile(true);
+		return Fail(FString::Printf(TEXT("Unable to write zip entry '%s' to '%s'"), *EntryName, *EntryFilePath));
+	}
+
+	return true;
+}
+
+bool FRuntimeArchiverZipStreamExtractor::ValidateCentralDirectory()
+{
+	TSet<FString> ListedEntries;
+
+	while (GetNumOfPendingBytes() >= 4 && ReadUInt32(GetPendingBytes()) == CentralHeaderSignature)
+	{
+		if (GetNumOfPendingBytes() < CentralHeaderSize)
+		{
+			return Fail(TEXT("Unable to validate zip archive because its central directory is truncated"));
+		}
+
+		const uint8* Header{GetPendingBytes()};
+		const uint16 NameSize{ReadUInt16(Header + 28)};
+		const uint16 ExtraSize{ReadUInt16(Header + 30)};
+		const uint16 CommentSize{ReadUInt16(Header + 32)};
+
+		if (GetNumOfPendingBytes() < CentralHeaderSize + NameSize + ExtraSize + CommentSize)
+		{
+			return Fail(TEXT("Unable to validate zip archive because its central directory is truncated"));
+		}
+
+		const uint32 Crc32{ReadUInt32(Header + 16)};
+		int64 CompressedSize{ReadUInt32(Header + 20)};
+		int64 UncompressedSize{ReadUInt32(Header + 24)};
+		const FString Name{ReadEntryName(Header + CentralHeaderSize, NameSize)};
+		bool bZip64{false};
+
+		ReadZip64Sizes(Header + CentralHeaderSize + NameSize, ExtraSize, UncompressedSize, CompressedSize, bZip64);
+
+		const FExtractedEntry* ExtractedEntry{ExtractedEntries.Find(Name)};
+		if (!ExtractedEntry)
+		{
+			return Fail(FString::Printf(TEXT("Zip entry '%s' is listed in the central directory but was not found in the archive data"), *Name));
+		}
+
+		if (ExtractedEntry->Crc32 != Crc32 || ExtractedEntry->UncompressedSize != UncompressedSize)
+		{
+			return Fail(FString::Printf(TEXT("Zip entry '%s' does not match the central directory"), *Name));
+		}
+
+		ListedEntries.Add(Name);
+		PendingOffset += CentralHeaderSize + NameSize + ExtraSize + CommentSize;
+	}
+
+	if (ListedEntries.Num() != ExtractedEntries.Num())
+	{
+		return Fail(FString::Printf(TEXT("Zip archive contains %d entries, but its central directory lists %d"), ExtractedEntries.Num(), ListedEntries.Num()));
+	}
+
+	return true;
+}
+
+bool FRuntimeArchiverZipStreamExtractor::Fail(const FString& Message)
+{
+	UE_LOG(LogRuntimeArchiver, Error, TEXT("%s"), *Message);
+
+	CloseEntryFile(true);
+	ErrorMessage = Message;
+	bFailed = true;
+	return false;
+}
+
+void FRuntimeArchiverZipStreamExtractor::CloseEntryFile(bool bDelete)
+{
+	if (!EntryFileHandle.IsValid())
+	{
+		return;
+	}
+
+	EntryFileHandle.Reset();
+
+	if (bDelete)
+	{
+		FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*EntryFilePath);
+	}
+}
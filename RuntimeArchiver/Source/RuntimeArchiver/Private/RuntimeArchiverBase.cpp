@@ -13,6 +13,7 @@
 URuntimeArchiverBase::URuntimeArchiverBase()
 	: Mode(ERuntimeArchiverMode::Undefined)
   , Location(ERuntimeArchiverLocation::Undefined)
+  , MaxWorkers(0)
 {
 }
 
@@ -103,6 +104,18 @@ bool URuntimeArchiverBase::OpenArchiveFromMemory(TArray<uint8> ArchiveData)
 }
 
 bool URuntimeArchiverBase::OpenArchiveFromMemory(const TArray64<uint8>& ArchiveData)
+{
+	return OpenArchiveFromMemory(TArray64<uint8>(ArchiveData));
+}
+
+bool URuntimeArchiverBase::OpenArchiveFromMemory(TArray64<uint8>&& ArchiveData)
+{
+	// Keeping the data alive for as long as the archive is open, so that archivers can read it in place
+	OwnedArchiveData = MoveTemp(ArchiveData);
+	return OpenArchiveFromMemoryView(OwnedArchiveData);
+}
+
+bool URuntimeArchiverBase::OpenArchiveFromMemoryView(TArrayView64<const uint8> ArchiveData)
 {
 	if (!Initialize())
 	{
@@ -279,22 +292,22 @@ void URuntimeArchiverBase::AddEntriesFromStorage(const FRuntimeArchiverAsyncOper
 			});
 		};
 
-		for (TArray<FString>::SizeType FilePathsIndex = 0; FilePathsIndex < FilePaths.Num(); ++FilePathsIndex)
-		{
-			FString FilePath = FilePaths[FilePathsIndex];
+		TArray<TPair<FString, FString>> EntriesToAdd;
+		EntriesToAdd.Reserve(FilePaths.Num());
 
+		for (FString FilePath : FilePaths)
+		{
 			FPaths::NormalizeFilename(FilePath);
 
-			const FString EntryName{FPaths::GetCleanFilename(FilePath)};
-
-			if (!AddEntryFromStorage(EntryName, FilePath, CompressionLevel))
-			{
-				ReportError(ERuntimeArchiverErrorCode::AddError, FString::Printf(TEXT("Cannot add '%s' entry. Aborting async adding entries"), *EntryName));
-				ExecuteResult(false);
-				return;
-			}
+			FString EntryName{FPaths::GetCleanFilename(FilePath)};
+			EntriesToAdd.Emplace(MoveTemp(EntryName), MoveTemp(FilePath));
+		}
 
-			ExecuteProgress(static_cast<float>(FilePathsIndex + 1) / FilePaths.Num() * 100);
+		if (!AddEntriesFromStorage_Internal(EntriesToAdd, CompressionLevel, ExecuteProgress))
+		{
+			ReportError(ERuntimeArchiverErrorCode::AddError, TEXT("Cannot add entries. Aborting async adding entries"));
+			ExecuteResult(false);
+			return;
 		}
 
 		UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully added '%d' entries"), FilePaths.Num());
@@ -362,15 +375,14 @@ bool URuntimeArchiverBase::AddEntriesFromStorage_Directory_Internal(FString Base
 {
 	class FDirectoryVisitor_EntryAppender : public IPlatformFile::FDirectoryVisitor
 	{
-		URuntimeArchiverBase* RuntimeArchiver;
 		const FString BaseDirectoryPathToExclude;
-		const ERuntimeArchiverCompressionLevel CompressionLevel;
 
 	public:
-		FDirectoryVisitor_EntryAppender(URuntimeArchiverBase* RuntimeArchiver, const FString& BaseDirectoryPathToExclude, ERuntimeArchiverCompressionLevel CompressionLevel)
-			: RuntimeArchiver(RuntimeArchiver)
-		  , BaseDirectoryPathToExclude(BaseDirectoryPathToExclude)
-		  , CompressionLevel(CompressionLevel)
+		/** Entry names along with the paths to the found files */
+		TArray<TPair<FString, FString>> Entries;
+
+		explicit FDirectoryVisitor_EntryAppender(const FString& BaseDirectoryPathToExclude)
+			: BaseDirectoryPathToExclude(BaseDirectoryPathToExclude)
 		{
 		}
 
@@ -383,21 +395,39 @@ bool URuntimeArchiverBase::AddEntriesFromStorage_Directory_Internal(FString Base
 			}
 
 			// Get the entry name by truncating the base directory from the found file
-			const FString EntryName{FString(FilenameOrDirectory).RightChop(BaseDirectoryPathToExclude.Len())};
-
-			if (!RuntimeArchiver->AddEntryFromStorage(EntryName, FilenameOrDirectory, CompressionLevel))
-			{
-				RuntimeArchiver->ReportError(ERuntimeArchiverErrorCode::AddError, FString::Printf(TEXT("Cannot add '%s' entry. Aborting recursive adding entries"), *EntryName));
-				return false;
-			}
+			Entries.Emplace(FString(FilenameOrDirectory).RightChop(BaseDirectoryPathToExclude.Len()), FilenameOrDirectory);
 
 			return true;
 		}
 	};
 
-	FDirectoryVisitor_EntryAppender DirectoryVisitor_EntryAppender(this, BaseDirectoryPathToExclude, CompressionLevel);
+	FDirectoryVisitor_EntryAppender DirectoryVisitor_EntryAppender(BaseDirectoryPathToExclude);
 
-	return FPlatformFileManager::Get().GetPlatformFile().IterateDirectoryRecursively(*DirectoryPath, DirectoryVisitor_EntryAppender);
+	if (!FPlatformFileManager::Get().GetPlatformFile().IterateDirectoryRecursively(*DirectoryPath, DirectoryVisitor_EntryAppender))
+	{
+		ReportError(ERuntimeArchiverErrorCode::AddError, FString::Printf(TEXT("Unable to scan directory '%s'. Aborting recursive adding entries"), *DirectoryPath));
+		return false;
+	}
+
+	return AddEntriesFromStorage_Internal(DirectoryVisitor_EntryAppender.Entries, CompressionLevel, [](int32 Percentage) {});
+}
+
+bool URuntimeArchiverBase::AddEntriesFromStorage_Internal(const TArray<TPair<FString, FString>>& Entries, ERuntimeArchiverCompressionLevel CompressionLevel, const TFunction<void(int32)>& OnProgress)
+{
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		const FString& EntryName = Entries[EntryIndex].Key;
+
+		if (!AddEntryFromStorage(EntryName, Entries[EntryIndex].Value, CompressionLevel))
+		{
+			ReportError(ERuntimeArchiverErrorCode::AddError, FString::Printf(TEXT("Cannot add '%s' entry"), *EntryName));
+			return false;
+		}
+
+		OnProgress(static_cast<float>(EntryIndex + 1) / Entries.Num() * 100);
+	}
+
+	return true;
 }
 
 bool URuntimeArchiverBase::AddEntryFromMemory(FString EntryName, TArray<uint8> DataToBeArchived, ERuntimeArchiverCompressionLevel CompressionLevel)
@@ -492,16 +522,36 @@ bool URuntimeArchiverBase::ExtractEntryToStorage(const FRuntimeArchiveEntry& Ent
 			UE_LOG(LogRuntimeArchiver, Warning, TEXT("File '%s' already exists. It will be overwritten"), *FilePath);
 		}
 
-		TArray64<uint8> EntryData;
-		if (!ExtractEntryToMemory(EntryInfo, EntryData))
+		IPlatformFile& PlatformFile{FPlatformFileManager::Get().GetPlatformFile()};
+
+		// Ensure we have a valid directory to extract entry to
 		{
-			ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to extract the entry '%s' from archive to memory for file '%s'"), *EntryInfo.Name, *FilePath));
-			return false;
+			const FString DirectoryPath{FPaths::GetPath(FilePath)};
+			if (!DirectoryPath.IsEmpty() && !PlatformFile.CreateDirectoryTree(*DirectoryPath))
+			{
+				ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to create subdirectory '%s' to extract entry '%s'"), *DirectoryPath, *EntryInfo.Name));
+				return false;
+			}
 		}
 
-		if (!FFileHelper::SaveArrayToFile(EntryData, *FilePath))
+		bool bExtracted;
+
+		// Extracting the entry straight into the file, so that the whole entry does not have to be held in memory
 		{
-			ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to save the entry '%s' from memory to file '%s'"), *EntryInfo.Name, *FilePath));
+			TUniquePtr<IFileHandle> FileHandle{PlatformFile.OpenWrite(*FilePath)};
+			if (!FileHandle.IsValid())
+			{
+				ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to open file '%s' to extract entry '%s'"), *FilePath, *EntryInfo.Name));
+				return false;
+			}
+
+			bExtracted = ExtractEntryToFileHandle(EntryInfo, *FileHandle);
+		}
+
+		if (!bExtracted)
+		{
+			PlatformFile.DeleteFile(*FilePath);
+			ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to extract the entry '%s' from archive to file '%s'"), *EntryInfo.Name, *FilePath));
 			return false;
 		}
 
@@ -542,10 +592,11 @@ void URuntimeArchiverBase::ExtractEntriesToStorage(const FRuntimeArchiverAsyncOp
 			});
 		};
 
-		for (int32 EntryIndex = 0; EntryIndex < EntryInfo.Num(); ++EntryIndex)
-		{
-			const FRuntimeArchiveEntry& Entry = EntryInfo[EntryIndex];
+		TArray<TPair<FRuntimeArchiveEntry, FString>> EntriesToExtract;
+		EntriesToExtract.Reserve(EntryInfo.Num());
 
+		for (const FRuntimeArchiveEntry& Entry : EntryInfo)
+		{
 			const FString ExtractFilePath = [&Entry]()
 			{
 				FString FilePath = Entry.Name;
@@ -553,14 +604,14 @@ void URuntimeArchiverBase::ExtractEntriesToStorage(const FRuntimeArchiverAsyncOp
 				return FilePath;
 			}();
 
-			if (!ExtractEntryToStorage(Entry, FPaths::Combine(DirectoryPath, TEXT("/"), ExtractFilePath), bForceOverwrite))
-			{
-				ReportError(ERuntimeArchiverErrorCode::AddError, FString::Printf(TEXT("Cannot extract '%s' entry. Aborting async extracting entries"), *Entry.Name));
-				ExecuteResult(false);
-				return;
-			}
+			EntriesToExtract.Emplace(Entry, FPaths::Combine(DirectoryPath, TEXT("/"), ExtractFilePath));
+		}
 
-			ExecuteProgress(static_cast<float>(EntryIndex + 1) / EntryInfo.Num() * 100);
+		if (!ExtractEntriesToStorage_Internal(EntriesToExtract, bForceOverwrite, ExecuteProgress))
+		{
+			ReportError(ERuntimeArchiverErrorCode::ExtractError, TEXT("Cannot extract entries. Aborting async extracting entries"));
+			ExecuteResult(false);
+			return;
 		}
 
 		UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully extracted '%d' entries"), EntryInfo.Num());
@@ -641,6 +692,8 @@ void URuntimeArchiverBase::ExtractEntriesToStorage_Directory(const FRuntimeArchi
 		FGCObjectScopeGuard Guard(this);
 		bool bResult{true};
 
+		TArray<TPair<FRuntimeArchiveEntry, FString>> EntriesToExtract;
+
 		for (int32 EntryIndex = 0; EntryIndex < NumOfEntries; ++EntryIndex)
 		{
 			FRuntimeArchiveEntry ArchiveEntry;
@@ -655,16 +708,16 @@ void URuntimeArchiverBase::ExtractEntriesToStorage_Directory(const FRuntimeArchi
 			if (EntryName.IsEmpty() || CheckEntryNameBelongsToBaseName(EntryName, ArchiveEntry.Name))
 			{
 				// Get the file path by truncating the base directory from the found entry
-				const FString SpecificFilePath{FPaths::Combine(DirectoryPath, ArchiveEntry.Name.RightChop(BaseDirectoryPathToExclude.Len()))};
-
-				if (!ExtractEntryToStorage(ArchiveEntry, SpecificFilePath, bForceOverwrite))
-				{
-					bResult = false;
-					break;
-				}
+				FString SpecificFilePath{FPaths::Combine(DirectoryPath, ArchiveEntry.Name.RightChop(BaseDirectoryPathToExclude.Len()))};
+				EntriesToExtract.Emplace(MoveTemp(ArchiveEntry), MoveTemp(SpecificFilePath));
 			}
 		}
 
+		if (bResult)
+		{
+			bResult = ExtractEntriesToStorage_Internal(EntriesToExtract, bForceOverwrite, [](int32 Percentage) {});
+		}
+
 		if (bResult)
 		{
 			UE_LOG(LogRuntimeArchiver, Log, TEXT("Successfully extracted entries from '%s'"), *EntryName);
@@ -677,6 +730,30 @@ void URuntimeArchiverBase::ExtractEntriesToStorage_Directory(const FRuntimeArchi
 	});
 }
 
+bool URuntimeArchiverBase::ExtractEntriesToStorage_Internal(const TArray<TPair<FRuntimeArchiveEntry, FString>>& Entries, bool bForceOverwrite, const TFunction<void(int32)>& OnProgress)
+{
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		const FRuntimeArchiveEntry& Entry = Entries[EntryIndex].Key;
+
+		if (!ExtractEntryToStorage(Entry, Entries[EntryIndex].Value, bForceOverwrite))
+		{
+			ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Cannot extract '%s' entry"), *Entry.Name));
+			return false;
+		}
+
+		OnProgress(static_cast<float>(EntryIndex + 1) / Entries.Num() * 100);
+	}
+
+	return true;
+}
+
+int32 URuntimeArchiverBase::GetNumOfWorkers(int32 NumOfEntries) const
+{
+	const int32 NumOfWorkers{MaxWorkers > 0 ? MaxWorkers : FTaskGraphInterface::Get().GetNumWorkerThreads()};
+	return FMath::Clamp(NumOfWorkers, 1, FMath::Max(NumOfEntries, 1));
+}
+
 bool URuntimeArchiverBase::ExtractEntryToMemory(const FRuntimeArchiveEntry& EntryInfo, TArray<uint8>& UnarchivedData)
 {
 	TArray64<uint8> UnarchivedData64;
@@ -720,6 +797,24 @@ bool URuntimeArchiverBase::ExtractEntryToMemory(const FRuntimeArchiveEntry& Entr
 	return true;
 }
 
+bool URuntimeArchiverBase::ExtractEntryToFileHandle(const FRuntimeArchiveEntry& EntryInfo, IFileHandle& FileHandle)
+{
+	TArray64<uint8> EntryData;
+	if (!ExtractEntryToMemory(EntryInfo, EntryData))
+	{
+		ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to extract the entry '%s' from archive to memory"), *EntryInfo.Name));
+		return false;
+	}
+
+	if (!FileHandle.Write(EntryData.GetData(), EntryData.Num()))
+	{
+		ReportError(ERuntimeArchiverErrorCode::ExtractError, FString::Printf(TEXT("Unable to write the entry '%s' from memory to file"), *EntryInfo.Name));
+		return false;
+	}
+
+	return true;
+}
+
 bool URuntimeArchiverBase::Initialize()
 {
 	return true;
@@ -734,6 +829,12 @@ void URuntimeArchiverBase::Reset()
 {
 	Mode = ERuntimeArchiverMode::Undefined;
 	Location = ERuntimeArchiverLocation::Undefined;
+	OwnedArchiveData.Empty();
+}
+
+void URuntimeArchiverBase::SetMaxWorkers(int32 NewMaxWorkers)
+{
+	MaxWorkers = FMath::Max(NewMaxWorkers, 0);
 }
 
 void URuntimeArchiverBase::ReportError(ERuntimeArchiverErrorCode ErrorCode, const FString& ErrorString) const
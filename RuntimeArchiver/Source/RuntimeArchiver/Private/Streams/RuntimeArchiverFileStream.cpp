@@ -4,12 +4,18 @@
 #include "GenericPlatform/GenericPlatformFile.h"
 #include "HAL/PlatformFileManager.h"
 
-FRuntimeArchiverFileStream::FRuntimeArchiverFileStream(const FString& ArchivePath, bool bWrite)
+FRuntimeArchiverFileStream::FRuntimeArchiverFileStream(const FString& ArchivePath, bool bWrite, int32 WriteBufferSize)
 	: FRuntimeArchiverBaseStream(bWrite)
+  , WriteBufferSize(bWrite ? FMath::Max(WriteBufferSize, 0) : 0)
 {
 	IPlatformFile& PlatformFile{FPlatformFileManager::Get().GetPlatformFile()};
 	FileHandle = bWrite ? PlatformFile.OpenWrite(*ArchivePath, false, true) : PlatformFile.OpenRead(*ArchivePath, false);
 
+	if (this->WriteBufferSize > 0)
+	{
+		WriteBuffer.Reserve(this->WriteBufferSize);
+	}
+
 	UE_LOG(LogRuntimeArchiver, Log, TEXT("File opened at '%s', bWrite: %s. Validity: %s"),
 	       *ArchivePath, bWrite ? TEXT("true") : TEXT("false"), FRuntimeArchiverFileStream::IsValid() ? TEXT("true") : TEXT("false"));
 }
@@ -18,6 +24,11 @@ FRuntimeArchiverFileStream::~FRuntimeArchiverFileStream()
 {
 	if (FRuntimeArchiverFileStream::IsValid())
 	{
+		if (!FRuntimeArchiverFileStream::Flush())
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to write the remaining buffered data when closing the file stream"));
+		}
+
 		delete FileHandle;
 		FileHandle = nullptr;
 	}
@@ -30,7 +41,7 @@ bool FRuntimeArchiverFileStream::IsValid() const
 
 bool FRuntimeArchiverFileStream::Read(void* Data, int64 Size)
 {
-	if (!IsValid())
+	if (!IsValid() || !Flush())
 	{
 		return false;
 	}
@@ -49,6 +60,25 @@ bool FRuntimeArchiverFileStream::Write(const void* Data, int64 Size)
 		return false;
 	}
 
+	// Small writes (such as tar headers and padding) are accumulated to reduce the number of file system calls
+	if (Size < WriteBufferSize)
+	{
+		if (WriteBuffer.Num() + Size > WriteBufferSize && !Flush())
+		{
+			return false;
+		}
+
+		WriteBuffer.Append(static_cast<const uint8*>(Data), Size);
+		Position += Size;
+		return true;
+	}
+
+	// Large writes go directly to the file, keeping the order with the previously buffered data
+	if (!Flush())
+	{
+		return false;
+	}
+
 	const bool bSuccess{FileHandle->Write(static_cast<const uint8*>(Data), Size)};
 	Position = FileHandle->Tell();
 	return bSuccess;
@@ -56,7 +86,7 @@ bool FRuntimeArchiverFileStream::Write(const void* Data, int64 Size)
 
 bool FRuntimeArchiverFileStream::Seek(int64 NewPosition)
 {
-	if (!IsValid())
+	if (!IsValid() || !Flush())
 	{
 		return false;
 	}
@@ -68,10 +98,38 @@ bool FRuntimeArchiverFileStream::Seek(int64 NewPosition)
 
 int64 FRuntimeArchiverFileStream::Size()
 {
-	if (!IsValid())
+	if (!IsValid() || !Flush())
 	{
 		return -1;
 	}
 
 	return FileHandle->Size();
 }
+
+bool FRuntimeArchiverFileStream::Flush()
+{
+	if (WriteBuffer.Num() == 0)
+	{
+		return true;
+	}
+
+	if (!IsValid())
+	{
+		return false;
+	}
+
+	const bool bSuccess{FileHandle->Write(WriteBuffer.GetData(), WriteBuffer.Num())};
+	WriteBuffer.Reset();
+	Position = FileHandle->Tell();
+	return bSuccess;
+}
+
+bool FRuntimeArchiverFileStream::Finish()
+{
+	if (!IsValid() || !Flush())
+	{
+		return false;
+	}
+
+	return !bWrite || FileHandle->Flush();
+}
@@ -0,0 +1,500 @@
+﻿#include "Streams/RuntimeArchiverGZipStream.h"
+
+#include "RuntimeArchiverDefines.h"
+
+#if !defined(__ORDER_LITTLE_ENDIAN__)
+#define __ORDER_LITTLE_ENDIAN__ PLATFORM_LITTLE_ENDIAN
+#endif
+
+THIRD_PARTY_INCLUDES_START
+#include "miniz.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace
+{
+	/** GZip header flags */
+	constexpr uint8 GZipFlagHeaderCrc = 0x02;
+	constexpr uint8 GZipFlagExtra = 0x04;
+	constexpr uint8 GZipFlagName = 0x08;
+	constexpr uint8 GZipFlagComment = 0x10;
+	constexpr uint8 GZipFlagReserved = 0xE0;
+
+	/** Size of the fixed part of the gzip header */
+	constexpr int64 GZipHeaderSize = 10;
+
+	/** Size of the gzip trailer containing CRC-32 and the uncompressed size */
+	constexpr int64 GZipTrailerSize = 8;
+
+	/** Size of the compressed data read or written at once */
+	constexpr int32 CompressedBufferSize = 256 * 1024;
+
+	/** Size of the window at which the inflated data behind the current position starts to be dropped */
+	constexpr int64 MaxWindowSize = 4 * 1024 * 1024;
+
+	/** Size of the inflated data kept behind the current position, so that small backward seeks do not restart inflating */
+	constexpr int64 WindowKeepBehindSize = 1024 * 1024;
+
+	/** Distance ahead of the current position within which the size is confirmed by inflating, since the size in the gzip trailer is only stored modulo 2^32 */
+	constexpr int64 SizeLookaheadSize = 64 * 1024;
+
+	/**
+	 * Skip a zero-terminated string in the gzip header
+	 */
+	bool SkipZeroTerminatedString(FRuntimeArchiverBaseStream& Stream)
+	{
+		uint8 Character;
+		do
+		{
+			if (!Stream.Read(&Character, 1))
+			{
+				return false;
+			}
+		}
+		while (Character != 0);
+
+		return true;
+	}
+
+	/**
+	 * Write a 32-bit value in little-endian byte order
+	 */
+	bool WriteUInt32(FRuntimeArchiverBaseStream& Stream, uint32 Value)
+	{
+		const uint8 Bytes[4] = {static_cast<uint8>(Value), static_cast<uint8>(Value >> 8), static_cast<uint8>(Value >> 16), static_cast<uint8>(Value >> 24)};
+		return Stream.Write(Bytes, sizeof(Bytes));
+	}
+}
+
+FRuntimeArchiverGZipStream::FRuntimeArchiverGZipStream(FRuntimeArchiverBaseStream& CompressedStream, ERuntimeArchiverCompressionLevel CompressionLevel)
+	: FRuntimeArchiverBaseStream(CompressedStream.IsWrite())
+  , CompressedStream(CompressedStream)
+  , CompressionLevel(CompressionLevel)
+  , MinizCodec(nullptr)
+  , DeflateDataPosition(0)
+  , CompressedPosition(0)
+  , TrailerPosition(0)
+  , UncompressedSizeHint(0)
+  , CompressedBufferOffset(0)
+  , DictionaryOffset(0)
+  , WindowPosition(0)
+  , bInflateDone(false)
+  , Crc32(MZ_CRC32_INIT)
+  , bValid(false)
+  , bFinished(false)
+{
+	if (!CompressedStream.IsValid())
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open gzip stream because the compressed stream is not valid"));
+		return;
+	}
+
+	if (bWrite)
+	{
+		// Deflate, no flags, no modification time, unknown OS
+		const uint8 Header[GZipHeaderSize] = {0x1F, 0x8B, 0x08, 0, 0, 0, 0, 0, 0, 0xFF};
+
+		bValid = CompressedStream.Write(Header, sizeof(Header));
+		if (!bValid)
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to write gzip header"));
+		}
+
+		return;
+	}
+
+	MinizCodec = tinfl_decompressor_alloc();
+	if (!MinizCodec)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to allocate memory for gzip decompressor"));
+		return;
+	}
+
+	Dictionary.SetNumUninitialized(TINFL_LZ_DICT_SIZE);
+
+	bValid = ReadGZipHeader() && RestartInflating();
+}
+
+FRuntimeArchiverGZipStream::~FRuntimeArchiverGZipStream()
+{
+	if (bWrite)
+	{
+		Finish();
+	}
+
+	if (MinizCodec)
+	{
+		if (bWrite)
+		{
+			tdefl_compressor_free(static_cast<tdefl_compressor*>(MinizCodec));
+		}
+		else
+		{
+			tinfl_decompressor_free(static_cast<tinfl_decompressor*>(MinizCodec));
+		}
+
+		MinizCodec = nullptr;
+	}
+}
+
+void FRuntimeArchiverGZipStream::SetCompressionLevel(ERuntimeArchiverCompressionLevel NewCompressionLevel)
+{
+	// The compressor is created with the first written data and cannot change the level afterwards
+	if (!MinizCodec)
+	{
+		CompressionLevel = NewCompressionLevel;
+	}
+}
+
+bool FRuntimeArchiverGZipStream::IsValid() const
+{
+	return bValid && CompressedStream.IsValid();
+}
+
+bool FRuntimeArchiverGZipStream::Read(void* Data, int64 Size)
+{
+	if (!IsValid() || bWrite)
+	{
+		return false;
+	}
+
+	// The end of the data is detected by the inflate stream, reading past it fails while inflating
+	if (Size < 0)
+	{
+		return false;
+	}
+
+	// Deflate data can only be inflated from the beginning
+	if (Position < WindowPosition && !RestartInflating())
+	{
+		return false;
+	}
+
+	uint8* Destination{static_cast<uint8*>(Data)};
+
+	while (Size > 0)
+	{
+		while (Position >= WindowPosition + Window.Num())
+		{
+			if (!InflateMore())
+			{
+				return false;
+			}
+		}
+
+		const int64 OffsetInWindow{Position - WindowPosition};
+		const int64 SizeToCopy{FMath::Min<int64>(Size, Window.Num() - OffsetInWindow)};
+
+		FMemory::Memcpy(Destination, Window.GetData() + OffsetInWindow, SizeToCopy);
+
+		Destination += SizeToCopy;
+		Position += SizeToCopy;
+		Size -= SizeToCopy;
+	}
+
+	return true;
+}
+
+bool FRuntimeArchiverGZipStream::Write(const void* Data, int64 Size)
+{
+	ensureMsgf(bWrite, TEXT("Cannot write data to the stream because it is in read-only mode"));
+
+	if (!IsValid() || !bWrite || bFinished)
+	{
+		return false;
+	}
+
+	Crc32 = static_cast<uint32>(mz_crc32(Crc32, static_cast<const uint8*>(Data), static_cast<size_t>(Size)));
+
+	if (!Deflate(static_cast<const uint8*>(Data), Size, false))
+	{
+		return false;
+	}
+
+	Position += Size;
+	return true;
+}
+
+bool FRuntimeArchiverGZipStream::Seek(int64 NewPosition)
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+
+	// The data is deflated as it arrives, so it can only be appended
+	if (bWrite)
+	{
+		return NewPosition == Position;
+	}
+
+	if (NewPosition < 0)
+	{
+		return false;
+	}
+
+	// The data is inflated lazily when reading, so seeking past the end only fails once reading there
+	Position = NewPosition;
+	return true;
+}
+
+bool FRuntimeArchiverGZipStream::Finish()
+{
+	if (!bWrite || bFinished)
+	{
+		return true;
+	}
+
+	bFinished = true;
+
+	if (!IsValid() || !Deflate(nullptr, 0, true))
+	{
+		return false;
+	}
+
+	// The uncompressed size is stored modulo 2^32 as required by the gzip format
+	if (!WriteUInt32(CompressedStream, Crc32) || !WriteUInt32(CompressedStream, static_cast<uint32>(Position & 0xFFFFFFFF)))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to write gzip trailer"));
+		return false;
+	}
+
+	return CompressedStream.Flush();
+}
+
+int64 FRuntimeArchiverGZipStream::Size()
+{
+	if (!IsValid())
+	{
+		return -1;
+	}
+
+	if (bWrite)
+	{
+		return Position;
+	}
+
+	// Inflating a bit ahead when the size could be exceeded soon, so that archives over 4 GB are not cut off at the size stored in the trailer
+	while (!bInflateDone && Position + SizeLookaheadSize > GetKnownUncompressedSize())
+	{
+		const int64 PreviousKnownSize{GetKnownUncompressedSize()};
+
+		while (!bInflateDone && WindowPosition + Window.Num() <= PreviousKnownSize)
+		{
+			if (!InflateMore())
+			{
+				return GetKnownUncompressedSize();
+			}
+		}
+	}
+
+	return GetKnownUncompressedSize();
+}
+
+int64 FRuntimeArchiverGZipStream::GetKnownUncompressedSize() const
+{
+	const int64 InflatedSize{WindowPosition + Window.Num()};
+
+	if (bInflateDone)
+	{
+		return InflatedSize;
+	}
+
+	// The smallest size matching the trailer that is not less than what was inflated so far
+	constexpr int64 SizeModulo{static_cast<int64>(1) << 32};
+	int64 KnownSize{UncompressedSizeHint};
+
+	if (KnownSize < InflatedSize)
+	{
+		KnownSize += (InflatedSize - KnownSize + SizeModulo - 1) / SizeModulo * SizeModulo;
+	}
+
+	return KnownSize;
+}
+
+bool FRuntimeArchiverGZipStream::ReadGZipHeader()
+{
+	const int64 CompressedSize{CompressedStream.Size()};
+	if (CompressedSize < GZipHeaderSize + GZipTrailerSize)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read gzip header because the data is too small (%lld bytes)"), CompressedSize);
+		return false;
+	}
+
+	uint8 Header[GZipHeaderSize];
+	if (!CompressedStream.Seek(0) || !CompressedStream.Read(Header, sizeof(Header)))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read gzip header"));
+		return false;
+	}
+
+	if (Header[0] != 0x1F || Header[1] != 0x8B || Header[2] != 0x08 || (Header[3] & GZipFlagReserved) != 0)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read gzip header because the data is not in gzip format"));
+		return false;
+	}
+
+	const uint8 Flags{Header[3]};
+
+	if (Flags & GZipFlagExtra)
+	{
+		uint8 ExtraSize[2];
+		if (!CompressedStream.Read(ExtraSize, sizeof(ExtraSize)) || !CompressedStream.Seek(CompressedStream.Tell() + (ExtraSize[0] | ExtraSize[1] << 8)))
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to skip gzip extra field"));
+			return false;
+		}
+	}
+
+	if ((Flags & GZipFlagName && !SkipZeroTerminatedString(CompressedStream)) || (Flags & GZipFlagComment && !SkipZeroTerminatedString(CompressedStream)))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to skip gzip file name or comment"));
+		return false;
+	}
+
+	DeflateDataPosition = CompressedStream.Tell() + (Flags & GZipFlagHeaderCrc ? 2 : 0);
+	TrailerPosition = CompressedSize - GZipTrailerSize;
+
+	if (DeflateDataPosition > TrailerPosition)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read gzip header because the data is truncated"));
+		return false;
+	}
+
+	uint8 Trailer[GZipTrailerSize];
+	if (!CompressedStream.Seek(TrailerPosition) || !CompressedStream.Read(Trailer, sizeof(Trailer)))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read gzip trailer"));
+		return false;
+	}
+
+	UncompressedSizeHint = static_cast<int64>(static_cast<uint32>(Trailer[4]) | static_cast<uint32>(Trailer[5]) << 8 | static_cast<uint32>(Trailer[6]) << 16 | static_cast<uint32>(Trailer[7]) << 24);
+	return true;
+}
+
+bool FRuntimeArchiverGZipStream::RestartInflating()
+{
+	tinfl_decompressor* Decompressor{static_cast<tinfl_decompressor*>(MinizCodec)};
+	tinfl_init(Decompressor);
+
+	CompressedPosition = DeflateDataPosition;
+	CompressedBuffer.Reset();
+	CompressedBufferOffset = 0;
+	DictionaryOffset = 0;
+	Window.Reset();
+	WindowPosition = 0;
+	bInflateDone = false;
+
+	return true;
+}
+
+bool FRuntimeArchiverGZipStream::InflateMore()
+{
+	if (bInflateDone)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to inflate gzip data beyond its end"));
+		return false;
+	}
+
+	// Dropping the inflated data far behind the current position, so that the window does not grow with the archive
+	if (Window.Num() >= MaxWindowSize)
+	{
+		const int64 NumToDrop{FMath::Min<int64>(Position, WindowPosition + Window.Num()) - WindowKeepBehindSize - WindowPosition};
+		if (NumToDrop > 0)
+		{
+			Window.RemoveAt(0, NumToDrop, false);
+			WindowPosition += NumToDrop;
+		}
+	}
+
+	if (CompressedBufferOffset >= CompressedBuffer.Num() && CompressedPosition < TrailerPosition)
+	{
+		const int32 SizeToRead{static_cast<int32>(FMath::Min<int64>(CompressedBufferSize, TrailerPosition - CompressedPosition))};
+		CompressedBuffer.SetNumUninitialized(SizeToRead, false);
+
+		// The compressed stream may be shared, so the position is always set explicitly
+		if (!CompressedStream.Seek(CompressedPosition) || !CompressedStream.Read(CompressedBuffer.GetData(), SizeToRead))
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read gzip data at offset %lld"), CompressedPosition);
+			return false;
+		}
+
+		CompressedPosition += SizeToRead;
+		CompressedBufferOffset = 0;
+	}
+
+	const bool bHasMoreInput{CompressedPosition < TrailerPosition};
+
+	size_t InSize{static_cast<size_t>(CompressedBuffer.Num() - CompressedBufferOffset)};
+	size_t OutSize{static_cast<size_t>(Dictionary.Num() - DictionaryOffset)};
+
+	const tinfl_status Status{tinfl_decompress(static_cast<tinfl_decompressor*>(MinizCodec), CompressedBuffer.GetData() + CompressedBufferOffset, &InSize,
+	                                           Dictionary.GetData(), Dictionary.GetData() + DictionaryOffset, &OutSize, bHasMoreInput ? TINFL_FLAG_HAS_MORE_INPUT : 0)};
+
+	CompressedBufferOffset += static_cast<int32>(InSize);
+
+	Window.Append(Dictionary.GetData() + DictionaryOffset, OutSize);
+	DictionaryOffset = (DictionaryOffset + static_cast<int32>(OutSize)) & (TINFL_LZ_DICT_SIZE - 1);
+
+	if (Status < TINFL_STATUS_DONE)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to inflate gzip data, the data is corrupted or truncated (status %d)"), static_cast<int32>(Status));
+		return false;
+	}
+
+	bInflateDone = Status == TINFL_STATUS_DONE;
+	return true;
+}
+
+bool FRuntimeArchiverGZipStream::Deflate(const uint8* Data, int64 Size, bool bFinish)
+{
+	if (!MinizCodec)
+	{
+		tdefl_compressor* Compressor{tdefl_compressor_alloc()};
+		if (!Compressor)
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to allocate memory for gzip compressor"));
+			return false;
+		}
+
+		MinizCodec = Compressor;
+
+		// Negative window bits produce raw deflate data, since the gzip header and trailer are written separately
+		const mz_uint Flags{tdefl_create_comp_flags_from_zip_params(static_cast<int>(CompressionLevel), -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY)};
+		if (tdefl_init(Compressor, nullptr, nullptr, static_cast<int>(Flags)) != TDEFL_STATUS_OKAY)
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to initialize gzip compressor"));
+			return false;
+		}
+
+		CompressedBuffer.SetNumUninitialized(CompressedBufferSize);
+	}
+
+	tdefl_compressor* Compressor{static_cast<tdefl_compressor*>(MinizCodec)};
+
+	while (true)
+	{
+		size_t InSize{static_cast<size_t>(Size)};
+		size_t OutSize{static_cast<size_t>(CompressedBuffer.Num())};
+
+		const tdefl_status Status{tdefl_compress(Compressor, Data, &InSize, CompressedBuffer.GetData(), &OutSize, bFinish ? TDEFL_FINISH : TDEFL_NO_FLUSH)};
+		if (Status < TDEFL_STATUS_OKAY)
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to deflate gzip data (status %d)"), static_cast<int32>(Status));
+			return false;
+		}
+
+		if (OutSize > 0 && !CompressedStream.Write(CompressedBuffer.GetData(), static_cast<int64>(OutSize)))
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to write deflated gzip data"));
+			return false;
+		}
+
+		Data += InSize;
+		Size -= static_cast<int64>(InSize);
+
+		if (bFinish ? Status == TDEFL_STATUS_DONE : Size == 0 && OutSize < static_cast<size_t>(CompressedBuffer.Num()))
+		{
+			return true;
+		}
+	}
+}
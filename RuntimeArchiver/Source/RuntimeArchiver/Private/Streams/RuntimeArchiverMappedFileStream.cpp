@@ -0,0 +1,85 @@
+﻿#include "Streams/RuntimeArchiverMappedFileStream.h"
+
+#include "RuntimeArchiverDefines.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+
+FRuntimeArchiverMappedFileStream::FRuntimeArchiverMappedFileStream(const FString& ArchivePath)
+	: FRuntimeArchiverBaseStream(false)
+  , MappedFileHandle(nullptr)
+  , MappedFileRegion(nullptr)
+{
+	MappedFileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*ArchivePath);
+
+	// Empty files cannot be mapped
+	if (MappedFileHandle && MappedFileHandle->GetFileSize() > 0)
+	{
+		MappedFileRegion = MappedFileHandle->MapRegion(0, MappedFileHandle->GetFileSize());
+	}
+
+	UE_LOG(LogRuntimeArchiver, Log, TEXT("File mapped at '%s'. Validity: %s"), *ArchivePath, FRuntimeArchiverMappedFileStream::IsValid() ? TEXT("true") : TEXT("false"));
+}
+
+FRuntimeArchiverMappedFileStream::~FRuntimeArchiverMappedFileStream()
+{
+	delete MappedFileRegion;
+	MappedFileRegion = nullptr;
+
+	delete MappedFileHandle;
+	MappedFileHandle = nullptr;
+}
+
+bool FRuntimeArchiverMappedFileStream::IsValid() const
+{
+	return MappedFileRegion != nullptr;
+}
+
+bool FRuntimeArchiverMappedFileStream::Read(void* Data, int64 Size)
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+
+	if (Size < 0 || Position + Size > MappedFileRegion->GetMappedSize())
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(Data, MappedFileRegion->GetMappedPtr() + Position, Size);
+	Position += Size;
+
+	return true;
+}
+
+bool FRuntimeArchiverMappedFileStream::Seek(int64 NewPosition)
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+
+	if (NewPosition < 0 || NewPosition > MappedFileRegion->GetMappedSize())
+	{
+		return false;
+	}
+
+	Position = NewPosition;
+
+	return true;
+}
+
+int64 FRuntimeArchiverMappedFileStream::Size()
+{
+	if (!IsValid())
+	{
+		return -1;
+	}
+
+	return MappedFileRegion->GetMappedSize();
+}
+
+const uint8* FRuntimeArchiverMappedFileStream::GetData() const
+{
+	return IsValid() ? MappedFileRegion->GetMappedPtr() : nullptr;
+}
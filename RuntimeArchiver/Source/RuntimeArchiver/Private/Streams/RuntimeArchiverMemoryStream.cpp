@@ -3,6 +3,20 @@
 FRuntimeArchiverMemoryStream::FRuntimeArchiverMemoryStream(const TArray64<uint8>& ArchiveData)
 	: FRuntimeArchiverBaseStream(false)
   , ArchiveData(ArchiveData)
+  , ArchiveDataView(this->ArchiveData)
+{
+}
+
+FRuntimeArchiverMemoryStream::FRuntimeArchiverMemoryStream(TArray64<uint8>&& ArchiveData)
+	: FRuntimeArchiverBaseStream(false)
+  , ArchiveData(MoveTemp(ArchiveData))
+  , ArchiveDataView(this->ArchiveData)
+{
+}
+
+FRuntimeArchiverMemoryStream::FRuntimeArchiverMemoryStream(TArrayView64<const uint8> ArchiveDataView)
+	: FRuntimeArchiverBaseStream(false)
+  , ArchiveDataView(ArchiveDataView)
 {
 }
 
@@ -24,12 +38,14 @@ bool FRuntimeArchiverMemoryStream::Read(void* Data, int64 Size)
 		return false;
 	}
 
-	if (Position + Size > ArchiveData.Num())
+	const TArrayView64<const uint8> DataView{GetDataView()};
+
+	if (Position + Size > DataView.Num())
 	{
 		return false;
 	}
 
-	const bool bSuccess{FMemory::Memcpy(Data, ArchiveData.GetData() + Position, Size) != nullptr};
+	const bool bSuccess{FMemory::Memcpy(Data, DataView.GetData() + Position, Size) != nullptr};
 	Position += Size;
 
 	return bSuccess;
@@ -69,7 +85,7 @@ bool FRuntimeArchiverMemoryStream::Seek(int64 NewPosition)
 		return true;
 	}
 
-	if (NewPosition > ArchiveData.Num())
+	if (NewPosition > GetDataView().Num())
 	{
 		if (NewPosition != 0)
 		{
@@ -89,5 +105,15 @@ int64 FRuntimeArchiverMemoryStream::Size()
 		return -1;
 	}
 
-	return ArchiveData.Num();
+	return GetDataView().Num();
+}
+
+const uint8* FRuntimeArchiverMemoryStream::GetData() const
+{
+	return GetDataView().GetData();
+}
+
+TArrayView64<const uint8> FRuntimeArchiverMemoryStream::GetDataView() const
+{
+	return bWrite ? TArrayView64<const uint8>(ArchiveData) : ArchiveDataView;
 }
@@ -0,0 +1,385 @@
+﻿#include "Streams/RuntimeArchiverRawBlockStream.h"
+
+#include "RuntimeArchiverDefines.h"
+#include "ArchiverRaw/RuntimeArchiverRaw.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/ByteSwap.h"
+
+namespace
+{
+	/** Magic identifying the block stream */
+	constexpr uint8 BlockStreamMagic[4] = {'R', 'A', 'B', 'S'};
+
+	/** Version of the block stream layout */
+	constexpr uint32 BlockStreamVersion = 1;
+
+	/** Block stream header. All values are little-endian */
+	struct FBlockStreamHeader
+	{
+		uint8 Magic[4];
+		uint32 Version;
+		uint32 RawFormat;
+		uint32 BlockSize;
+	};
+
+	/** Frame header preceding each block. All values are little-endian. An empty frame marks the end of the stream */
+	struct FBlockFrameHeader
+	{
+		uint32 UncompressedSize;
+		uint32 CompressedSize;
+	};
+
+	static_assert(sizeof(FBlockStreamHeader) == 16, "Block stream header must be packed");
+	static_assert(sizeof(FBlockFrameHeader) == 8, "Block frame header must be packed");
+}
+
+FRuntimeArchiverRawBlockStream::FRuntimeArchiverRawBlockStream(FRuntimeArchiverBaseStream& CompressedStream, ERuntimeArchiverRawFormat RawFormat, ERuntimeArchiverCompressionLevel CompressionLevel, int32 BlockSize)
+	: FRuntimeArchiverBaseStream(CompressedStream.IsWrite())
+  , CompressedStream(CompressedStream)
+  , RawFormat(RawFormat)
+  , CompressionLevel(CompressionLevel)
+  , BlockSize(FMath::Max(BlockSize, 1))
+  , bBlockIndexComplete(false)
+  , CurrentBlockIndex(INDEX_NONE)
+  , bValid(false)
+  , bFinished(false)
+{
+	if (!CompressedStream.IsValid())
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open block stream because the compressed stream is not valid"));
+		return;
+	}
+
+	FBlockStreamHeader Header;
+
+	if (bWrite)
+	{
+		FMemory::Memcpy(Header.Magic, BlockStreamMagic, sizeof(BlockStreamMagic));
+		Header.Version = INTEL_ORDER32(BlockStreamVersion);
+		Header.RawFormat = INTEL_ORDER32(static_cast<uint32>(RawFormat));
+		Header.BlockSize = INTEL_ORDER32(static_cast<uint32>(this->BlockSize));
+
+		bValid = CompressedStream.Write(&Header, sizeof(Header));
+		if (!bValid)
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to write block stream header"));
+		}
+
+		BlockData.Reserve(this->BlockSize);
+		return;
+	}
+
+	if (!CompressedStream.Seek(0) || !CompressedStream.Read(&Header, sizeof(Header)) || FMemory::Memcmp(Header.Magic, BlockStreamMagic, sizeof(BlockStreamMagic)) != 0)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open block stream because the header is missing"));
+		return;
+	}
+
+	if (INTEL_ORDER32(Header.Version) != BlockStreamVersion)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open block stream because its version %u is not supported"), INTEL_ORDER32(Header.Version));
+		return;
+	}
+
+	const uint32 RawFormatValue{INTEL_ORDER32(Header.RawFormat)};
+	if (RawFormatValue > static_cast<uint32>(ERuntimeArchiverRawFormat::LZ4))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to open block stream because its raw format %u is unknown"), RawFormatValue);
+		return;
+	}
+
+	// The archive describes itself, so the format stored in the header takes precedence
+	this->RawFormat = static_cast<ERuntimeArchiverRawFormat>(RawFormatValue);
+	this->BlockSize = static_cast<int32>(INTEL_ORDER32(Header.BlockSize));
+
+	bValid = true;
+}
+
+FRuntimeArchiverRawBlockStream::~FRuntimeArchiverRawBlockStream()
+{
+	if (bWrite)
+	{
+		Finish();
+	}
+}
+
+bool FRuntimeArchiverRawBlockStream::IsBlockStream(FRuntimeArchiverBaseStream& CompressedStream)
+{
+	if (!CompressedStream.IsValid() || CompressedStream.Size() < static_cast<int64>(sizeof(FBlockStreamHeader)))
+	{
+		return false;
+	}
+
+	uint8 Magic[sizeof(BlockStreamMagic)];
+	const bool bIsBlockStream{CompressedStream.Seek(0) && CompressedStream.Read(Magic, sizeof(Magic)) && FMemory::Memcmp(Magic, BlockStreamMagic, sizeof(BlockStreamMagic)) == 0};
+
+	CompressedStream.Seek(0);
+	return bIsBlockStream;
+}
+
+void FRuntimeArchiverRawBlockStream::SetCompressionLevel(ERuntimeArchiverCompressionLevel NewCompressionLevel)
+{
+	CompressionLevel = NewCompressionLevel;
+}
+
+bool FRuntimeArchiverRawBlockStream::IsValid() const
+{
+	return bValid && CompressedStream.IsValid();
+}
+
+bool FRuntimeArchiverRawBlockStream::Read(void* Data, int64 Size)
+{
+	if (!IsValid() || bWrite)
+	{
+		return false;
+	}
+
+	if (Size < 0 || Position + Size > this->Size())
+	{
+		return false;
+	}
+
+	uint8* Destination{static_cast<uint8*>(Data)};
+
+	while (Size > 0)
+	{
+		if (!LoadBlockAt(Position))
+		{
+			return false;
+		}
+
+		const FBlockInfo& Block{BlockIndex[CurrentBlockIndex]};
+		const int64 OffsetInBlock{Position - Block.UncompressedOffset};
+		const int64 SizeToCopy{FMath::Min<int64>(Size, Block.UncompressedSize - OffsetInBlock)};
+
+		FMemory::Memcpy(Destination, BlockData.GetData() + OffsetInBlock, SizeToCopy);
+
+		Destination += SizeToCopy;
+		Position += SizeToCopy;
+		Size -= SizeToCopy;
+	}
+
+	return true;
+}
+
+bool FRuntimeArchiverRawBlockStream::Write(const void* Data, int64 Size)
+{
+	ensureMsgf(bWrite, TEXT("Cannot write data to the stream because it is in read-only mode"));
+
+	if (!IsValid() || !bWrite || bFinished)
+	{
+		return false;
+	}
+
+	const uint8* Source{static_cast<const uint8*>(Data)};
+
+	while (Size > 0)
+	{
+		const int64 SizeToAppend{FMath::Min<int64>(Size, BlockSize - BlockData.Num())};
+		BlockData.Append(Source, SizeToAppend);
+
+		Source += SizeToAppend;
+		Position += SizeToAppend;
+		Size -= SizeToAppend;
+
+		if (BlockData.Num() >= BlockSize && !FlushBlock())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FRuntimeArchiverRawBlockStream::Seek(int64 NewPosition)
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+
+	// The data is compressed as it arrives, so it can only be appended
+	if (bWrite)
+	{
+		return NewPosition == Position;
+	}
+
+	if (NewPosition < 0 || NewPosition > Size())
+	{
+		return false;
+	}
+
+	// Blocks are uncompressed lazily when reading
+	Position = NewPosition;
+	return true;
+}
+
+bool FRuntimeArchiverRawBlockStream::Finish()
+{
+	if (!bWrite || bFinished)
+	{
+		return true;
+	}
+
+	bFinished = true;
+
+	if (!IsValid())
+	{
+		return false;
+	}
+
+	if (BlockData.Num() > 0 && !FlushBlock())
+	{
+		return false;
+	}
+
+	const FBlockFrameHeader EndFrame{0, 0};
+	if (!CompressedStream.Write(&EndFrame, sizeof(EndFrame)))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to write the end of block stream"));
+		return false;
+	}
+
+	return CompressedStream.Flush();
+}
+
+int64 FRuntimeArchiverRawBlockStream::Size()
+{
+	if (!IsValid())
+	{
+		return -1;
+	}
+
+	if (bWrite)
+	{
+		return Position;
+	}
+
+	// Only frame headers are read here, so the size can be obtained without uncompressing anything
+	while (!bBlockIndexComplete)
+	{
+		if (!IndexNextBlock())
+		{
+			return -1;
+		}
+	}
+
+	return BlockIndex.Num() > 0 ? BlockIndex.Last().UncompressedOffset + BlockIndex.Last().UncompressedSize : 0;
+}
+
+bool FRuntimeArchiverRawBlockStream::IndexNextBlock()
+{
+	const int64 FrameOffset{BlockIndex.Num() > 0 ? BlockIndex.Last().FrameOffset + sizeof(FBlockFrameHeader) + BlockIndex.Last().CompressedSize : static_cast<int64>(sizeof(FBlockStreamHeader))};
+	const int64 UncompressedOffset{BlockIndex.Num() > 0 ? BlockIndex.Last().UncompressedOffset + BlockIndex.Last().UncompressedSize : 0};
+
+	FBlockFrameHeader FrameHeader;
+	if (!CompressedStream.Seek(FrameOffset) || !CompressedStream.Read(&FrameHeader, sizeof(FrameHeader)))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read block frame at offset %lld"), FrameOffset);
+		return false;
+	}
+
+	const uint32 UncompressedSize{INTEL_ORDER32(FrameHeader.UncompressedSize)};
+	const uint32 CompressedSize{INTEL_ORDER32(FrameHeader.CompressedSize)};
+
+	if (UncompressedSize == 0)
+	{
+		bBlockIndexComplete = true;
+		return true;
+	}
+
+	// Blocks are never larger than the block size, and blocks that do not shrink are stored as is
+	if (UncompressedSize > static_cast<uint32>(BlockSize) || CompressedSize == 0 || CompressedSize > UncompressedSize)
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Block frame at offset %lld is corrupted"), FrameOffset);
+		return false;
+	}
+
+	BlockIndex.Add(FBlockInfo{UncompressedOffset, FrameOffset, UncompressedSize, CompressedSize});
+	return true;
+}
+
+bool FRuntimeArchiverRawBlockStream::LoadBlockAt(int64 UncompressedPosition)
+{
+	if (CurrentBlockIndex != INDEX_NONE)
+	{
+		const FBlockInfo& CurrentBlock{BlockIndex[CurrentBlockIndex]};
+		if (UncompressedPosition >= CurrentBlock.UncompressedOffset && UncompressedPosition < CurrentBlock.UncompressedOffset + CurrentBlock.UncompressedSize)
+		{
+			return true;
+		}
+	}
+
+	while (!bBlockIndexComplete && (BlockIndex.Num() == 0 || BlockIndex.Last().UncompressedOffset + BlockIndex.Last().UncompressedSize <= UncompressedPosition))
+	{
+		if (!IndexNextBlock())
+		{
+			return false;
+		}
+	}
+
+	const int32 BlockIndexToLoad{static_cast<int32>(Algo::UpperBoundBy(BlockIndex, UncompressedPosition, &FBlockInfo::UncompressedOffset)) - 1};
+	if (!BlockIndex.IsValidIndex(BlockIndexToLoad))
+	{
+		return false;
+	}
+
+	const FBlockInfo& Block{BlockIndex[BlockIndexToLoad]};
+
+	CurrentBlockIndex = INDEX_NONE;
+	BlockData.SetNumUninitialized(Block.UncompressedSize);
+
+	if (!CompressedStream.Seek(Block.FrameOffset + sizeof(FBlockFrameHeader)))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to seek to block data at offset %lld"), Block.FrameOffset);
+		return false;
+	}
+
+	// Blocks that did not benefit from compression are stored as is
+	if (Block.CompressedSize == Block.UncompressedSize)
+	{
+		if (!CompressedStream.Read(BlockData.GetData(), Block.UncompressedSize))
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read stored block at offset %lld"), Block.FrameOffset);
+			return false;
+		}
+	}
+	else
+	{
+		CompressedBlockData.SetNumUninitialized(Block.CompressedSize);
+
+		if (!CompressedStream.Read(CompressedBlockData.GetData(), Block.CompressedSize))
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to read compressed block at offset %lld"), Block.FrameOffset);
+			return false;
+		}
+
+		if (!URuntimeArchiverRaw::UncompressRawBlock(RawFormat, CompressedBlockData.GetData(), Block.CompressedSize, BlockData.GetData(), Block.UncompressedSize))
+		{
+			UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to uncompress block at offset %lld"), Block.FrameOffset);
+			return false;
+		}
+	}
+
+	CurrentBlockIndex = BlockIndexToLoad;
+	return true;
+}
+
+bool FRuntimeArchiverRawBlockStream::FlushBlock()
+{
+	const bool bCompressed{URuntimeArchiverRaw::CompressRawBlock(RawFormat, CompressionLevel, BlockData.GetData(), BlockData.Num(), CompressedBlockData) && CompressedBlockData.Num() < BlockData.Num()};
+
+	// Storing the block as is if compression failed or did not reduce the size
+	const TArray64<uint8>& DataToWrite{bCompressed ? CompressedBlockData : BlockData};
+
+	const FBlockFrameHeader FrameHeader{INTEL_ORDER32(static_cast<uint32>(BlockData.Num())), INTEL_ORDER32(static_cast<uint32>(DataToWrite.Num()))};
+
+	if (!CompressedStream.Write(&FrameHeader, sizeof(FrameHeader)) || !CompressedStream.Write(DataToWrite.GetData(), DataToWrite.Num()))
+	{
+		UE_LOG(LogRuntimeArchiver, Error, TEXT("Unable to write block frame with size %lld"), DataToWrite.Num());
+		return false;
+	}
+
+	BlockData.Reset();
+	return true;
+}
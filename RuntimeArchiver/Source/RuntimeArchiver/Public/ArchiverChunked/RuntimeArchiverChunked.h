@@ -0,0 +1,187 @@
+﻿// Georgy Treshchev 2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RuntimeArchiverBase.h"
+#include "Streams/RuntimeArchiverBaseStream.h"
+#include "RuntimeArchiverChunked.generated.h"
+
+/**
+ * Compressed block of the chunked archive
+ */
+struct FRuntimeArchiverChunkedBlock
+{
+	/** Position of the compressed block data in the archive */
+	int64 Offset;
+
+	/** Compressed block size. Equal to the uncompressed size if the block is stored without compression */
+	uint32 CompressedSize;
+
+	/** Uncompressed block size. Equal to the block size for all blocks except the last one */
+	uint32 UncompressedSize;
+};
+
+/**
+ * Entry of the chunked archive
+ */
+struct FRuntimeArchiverChunkedEntry
+{
+	/** Entry name */
+	FString Name;
+
+	/** Position of the entry data in the uncompressed data of all blocks */
+	int64 Offset;
+
+	/** Uncompressed entry size */
+	int64 Size;
+
+	/** Entry creation time */
+	FDateTime CreationTime;
+
+	/** Whether this entry is a directory or not */
+	bool bIsDirectory;
+};
+
+/**
+ * Chunked archiver class. Works with chunked container archives, a format specific to this plugin
+ * The data of all entries is compressed in fixed-size independent blocks (LZ4 or Oodle), followed by the block index and the entry table at the end of the archive
+ * Any entry can be read by uncompressing only the blocks it covers, which is done in parallel, so single entries can be lazy-loaded at runtime
+ */
+UCLASS(BlueprintType, Category = "Runtime Archiver")
+class RUNTIMEARCHIVER_API URuntimeArchiverChunked : public URuntimeArchiverBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Default size of an uncompressed block */
+	static constexpr int32 DefaultBlockSize = 256 * 1024;
+
+	/** Default constructor */
+	URuntimeArchiverChunked();
+
+	//~ Begin URuntimeArchiverBase Interface
+	virtual bool CreateArchiveInStorage(FString ArchivePath) override;
+	virtual bool CreateArchiveInMemory(int32 InitialAllocationSize = 0) override;
+
+	virtual bool OpenArchiveFromStorage(FString ArchivePath) override;
+	virtual bool OpenArchiveFromMemoryView(TArrayView64<const uint8> ArchiveData) override;
+
+	virtual bool CloseArchive() override;
+
+	virtual bool GetArchiveData(TArray64<uint8>& ArchiveData) override;
+
+	virtual bool GetArchiveEntries(int32& NumOfArchiveEntries) override;
+
+	virtual bool GetArchiveEntryInfoByName(FString EntryName, FRuntimeArchiveEntry& EntryInfo) override;
+	virtual bool GetArchiveEntryInfoByIndex(int32 EntryIndex, FRuntimeArchiveEntry& EntryInfo) override;
+
+	virtual bool AddEntryFromMemory(FString EntryName, const TArray64<uint8>& DataToBeArchived, ERuntimeArchiverCompressionLevel CompressionLevel) override;
+
+	virtual bool ExtractEntryToMemory(const FRuntimeArchiveEntry& EntryInfo, TArray64<uint8>& UnarchivedData) override;
+	virtual bool ExtractEntryToFileHandle(const FRuntimeArchiveEntry& EntryInfo, IFileHandle& FileHandle) override;
+
+	virtual bool Initialize() override;
+	virtual bool IsInitialized() const override;
+	virtual void Reset() override;
+
+	virtual void ReportError(ERuntimeArchiverErrorCode ErrorCode, const FString& ErrorString) const override;
+	//~ End URuntimeArchiverBase Interface
+
+	/**
+	 * Set the raw format used to compress blocks of archives created afterwards. Archives opened to read use the format they were created with
+	 * Can only be set while no archive is open. Closing an archive restores the default format
+	 *
+	 * @param NewRawFormat Raw format
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Runtime Archiver|Settings")
+	void SetRawFormat(ERuntimeArchiverRawFormat NewRawFormat);
+
+	/**
+	 * Set the uncompressed block size of archives created afterwards. Smaller blocks make reading small entries cheaper, larger blocks compress better
+	 * Can only be set while no archive is open. Closing an archive restores the default block size
+	 *
+	 * @param NewBlockSize Block size in bytes
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Runtime Archiver|Settings")
+	void SetBlockSize(int32 NewBlockSize);
+
+private:
+	/**
+	 * Append data to the uncompressed data of all blocks, compressing the blocks that are full
+	 *
+	 * @param Data Data to append
+	 * @param Size Data size
+	 * @return Whether the operation was successful or not
+	 */
+	bool AppendData(const uint8* Data, int64 Size);
+
+	/**
+	 * Compress the pending data in parallel and write the compressed blocks
+	 *
+	 * @param bIncludePartialBlock Whether to also write the last block if it is not full
+	 * @return Whether the operation was successful or not
+	 */
+	bool WritePendingBlocks(bool bIncludePartialBlock);
+
+	/**
+	 * Write the remaining blocks, the block index and the entry table
+	 *
+	 * @return Whether the operation was successful or not
+	 */
+	bool Finalize();
+
+	/**
+	 * Read the block index and the entry table from the end of the archive
+	 *
+	 * @return Whether the operation was successful or not
+	 */
+	bool ReadTable();
+
+	/**
+	 * Read the entry data by uncompressing the blocks it covers, in parallel batches
+	 *
+	 * @param Entry Entry to read
+	 * @param Consumer Called in order with consecutive portions of the entry data. Should return false to stop reading
+	 * @return Whether the operation was successful or not
+	 */
+	bool ReadEntryData(const FRuntimeArchiverChunkedEntry& Entry, TFunctionRef<bool(const uint8*, int64)> Consumer);
+
+	/**
+	 * Convert the chunked entry to the archive entry
+	 *
+	 * @param EntryIndex Entry index
+	 * @param EntryInfo Converted entry
+	 */
+	void ToEntry(int32 EntryIndex, FRuntimeArchiveEntry& EntryInfo) const;
+
+	/** Stream containing the archive data */
+	TUniquePtr<FRuntimeArchiverBaseStream> Stream;
+
+	/** Raw format used to compress the blocks */
+	ERuntimeArchiverRawFormat RawFormat;
+
+	/** Uncompressed block size */
+	int32 BlockSize;
+
+	/** Compression level used for the blocks being written */
+	ERuntimeArchiverCompressionLevel CompressionLevel;
+
+	/** Blocks of the archive, in order */
+	TArray<FRuntimeArchiverChunkedBlock> Blocks;
+
+	/** Entries of the archive, in order */
+	TArray<FRuntimeArchiverChunkedEntry> Entries;
+
+	/** Entry indices by entry name. If names are duplicated, the first entry is used */
+	TMap<FString, int32> EntryIndicesByName;
+
+	/** Uncompressed data not written as blocks yet */
+	TArray64<uint8> PendingData;
+
+	/** Total size of the uncompressed data of all entries */
+	int64 TotalUncompressedSize;
+
+	/** Whether the archive was finalized or not */
+	bool bIsFinalized;
+};
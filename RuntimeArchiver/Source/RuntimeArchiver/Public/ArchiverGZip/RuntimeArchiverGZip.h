@@ -8,9 +8,12 @@
 #include "UObject/StrongObjectPtr.h"
 #include "RuntimeArchiverGZip.generated.h"
 
+class FRuntimeArchiverGZipStream;
+
 /**
  * GZip archiver class. Works with tar.gz (tgz) archives
  * Archiving of data occurs through the Tar archiver and their subsequent compression through GZip raw archiver (the same applies for unarchiving)
+ * The tar data is deflated while being written and inflated while being read, so the archive is not held in memory
  */
 UCLASS(BlueprintType, Category = "Runtime Archiver")
 class RUNTIMEARCHIVER_API URuntimeArchiverGZip : public URuntimeArchiverBase
@@ -25,7 +28,7 @@ public:
 	virtual bool CreateArchiveInMemory(int32 InitialAllocationSize = 0) override;
 
 	virtual bool OpenArchiveFromStorage(FString ArchivePath) override;
-	virtual bool OpenArchiveFromMemory(const TArray64<uint8>& ArchiveData) override;
+	virtual bool OpenArchiveFromMemoryView(TArrayView64<const uint8> ArchiveData) override;
 
 	virtual bool CloseArchive() override;
 
@@ -48,12 +51,22 @@ public:
 	//~ End URuntimeArchiverBase Interface
 
 private:
+	/**
+	 * Open the tar archiver on top of the gzip stream wrapping the compressed stream
+	 *
+	 * @return Whether the operation was successful or not
+	 */
+	bool OpenTarArchiveFromCompressedStream();
+
 	/** Tar archiver used for internal operations */
 	TStrongObjectPtr<URuntimeArchiverTar> TarArchiver;
 
-	/** Stream containing LZ4 compressed data */
+	/** Stream containing GZip compressed data */
 	TUniquePtr<FRuntimeArchiverBaseStream> CompressedStream;
 
+	/** GZip stream between the tar archiver and the compressed stream. Owned by the tar archiver */
+	FRuntimeArchiverGZipStream* GZipStream;
+
 	/** Last saved compression level */
 	ERuntimeArchiverCompressionLevel LastCompressionLevel;
 };
@@ -8,10 +8,12 @@
 #include "UObject/StrongObjectPtr.h"
 #include "RuntimeArchiverLZ4.generated.h"
 
+class FRuntimeArchiverRawBlockStream;
+
 /**
  * LZ4 archiver class. Works with tar.lz4 (tlz4) archives
  * Archiving of data occurs through the Tar archiver and their subsequent compression through LZ4 raw archiver (the same applies for unarchiving)
- * Note that it currently has some bugs when unarchiving data from a tar archive
+ * The tar data is compressed in independent blocks while being written, and blocks are uncompressed only when read, so the archive is not held in memory
  */
 UCLASS(BlueprintType, Category = "Runtime Archiver")
 class RUNTIMEARCHIVER_API URuntimeArchiverLZ4 : public URuntimeArchiverBase
@@ -26,7 +28,7 @@ public:
 	virtual bool CreateArchiveInMemory(int32 InitialAllocationSize = 0) override;
 
 	virtual bool OpenArchiveFromStorage(FString ArchivePath) override;
-	virtual bool OpenArchiveFromMemory(const TArray64<uint8>& ArchiveData) override;
+	virtual bool OpenArchiveFromMemoryView(TArrayView64<const uint8> ArchiveData) override;
 
 	virtual bool CloseArchive() override;
 
@@ -49,12 +51,22 @@ public:
 	//~ End URuntimeArchiverBase Interface
 
 private:
+	/**
+	 * Open the tar archiver on top of the block stream wrapping the compressed stream
+	 *
+	 * @return Whether the operation was successful or not
+	 */
+	bool OpenTarArchiveFromCompressedStream();
+
 	/** Tar archiver used for internal operations */
 	TStrongObjectPtr<URuntimeArchiverTar> TarArchiver;
 
 	/** Stream containing LZ4 compressed data */
 	TUniquePtr<FRuntimeArchiverBaseStream> CompressedStream;
 
+	/** Block stream between the tar archiver and the compressed stream. Owned by the tar archiver, nullptr if the archive is not streamed */
+	FRuntimeArchiverRawBlockStream* BlockStream;
+
 	/** Last saved compression level */
 	ERuntimeArchiverCompressionLevel LastCompressionLevel;
 };
@@ -19,6 +19,9 @@ class RUNTIMEARCHIVER_API URuntimeArchiverRaw : public UObject
 	GENERATED_BODY()
 
 public:
+	/** Default size of the blocks the data is split into when compressing in parallel */
+	static constexpr int32 DefaultParallelBlockSize = 1024 * 1024;
+
 	/**
 	 * Asynchronously compress raw data
 	 *
@@ -53,6 +56,59 @@ public:
 	 */
 	static bool CompressRawData(ERuntimeArchiverRawFormat RawFormat, ERuntimeArchiverCompressionLevel CompressionLevel, const TArray64<uint8>& UncompressedData, TArray64<uint8>& CompressedData);
 
+	/**
+	 * Asynchronously compress raw data by splitting it into blocks compressed in parallel. Suitable for large data
+	 *
+	 * @param RawFormat Raw format
+	 * @param CompressionLevel Compression level. The higher the level, the more compression
+	 * @param UncompressedData Uncompressed data
+	 * @param OnResult Delegate broadcasting the result
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Runtime Archiver|Raw")
+	static void CompressRawDataParallelAsync(ERuntimeArchiverRawFormat RawFormat, ERuntimeArchiverCompressionLevel CompressionLevel, TArray<uint8> UncompressedData, const FRuntimeArchiverRawMemoryResult& OnResult);
+
+	/**
+	 * Asynchronously compress raw data by splitting it into blocks compressed in parallel. Prefer to use this function if possible
+	 *
+	 * @param RawFormat Raw format
+	 * @param CompressionLevel Compression level. The higher the level, the more compression
+	 * @param UncompressedData Uncompressed data
+	 * @param OnResult Delegate broadcasting the result
+	 * @param BlockSize Size of the independently compressed blocks
+	 */
+	static void CompressRawDataParallelAsync(ERuntimeArchiverRawFormat RawFormat, ERuntimeArchiverCompressionLevel CompressionLevel, TArray64<uint8> UncompressedData, const FRuntimeArchiverRawMemoryResultNative& OnResult, int32 BlockSize = DefaultParallelBlockSize);
+
+	/**
+	 * Compress raw data by splitting it into blocks compressed in parallel. The result starts with a header describing the blocks, so it can also be uncompressed in parallel
+	 * UncompressRawData recognizes such data automatically
+	 *
+	 * @param RawFormat Raw format
+	 * @param CompressionLevel Compression level. The higher the level, the more compression
+	 * @param UncompressedData Uncompressed data
+	 * @param CompressedData Out compressed data
+	 * @param BlockSize Size of the independently compressed blocks. Smaller blocks parallelize better, larger blocks compress better
+	 * @return Whether the compression was successful or not
+	 */
+	static bool CompressRawDataParallel(ERuntimeArchiverRawFormat RawFormat, ERuntimeArchiverCompressionLevel CompressionLevel, const TArray64<uint8>& UncompressedData, TArray64<uint8>& CompressedData, int32 BlockSize = DefaultParallelBlockSize);
+
+	/**
+	 * Uncompress raw data compressed by CompressRawDataParallel, uncompressing the blocks in parallel
+	 *
+	 * @param RawFormat Raw format
+	 * @param CompressedData Compressed data
+	 * @param UncompressedData Out uncompressed data
+	 * @return Whether the uncompression was successful or not
+	 */
+	static bool UncompressRawDataParallel(ERuntimeArchiverRawFormat RawFormat, const TArray64<uint8>& CompressedData, TArray64<uint8>& UncompressedData);
+
+	/**
+	 * Check if the compressed data was produced by CompressRawDataParallel
+	 *
+	 * @param CompressedData Compressed data
+	 * @return Whether the data is split into parallel blocks or not
+	 */
+	static bool IsParallelRawData(const TArray64<uint8>& CompressedData);
+
 	/**
 	 * Asynchronously uncompress raw data
 	 *
@@ -101,4 +157,28 @@ public:
 	 * @return Guessed size
 	 */
 	static int64 GuessUncompressedSize(ERuntimeArchiverRawFormat RawFormat, const TArray64<uint8>& CompressedData);
+
+	/**
+	 * Compress a single block of raw data. Unlike CompressRawData, no size information is stored, so the block can only be uncompressed if its uncompressed size is known
+	 *
+	 * @param RawFormat Raw format
+	 * @param CompressionLevel Compression level. The higher the level, the more compression
+	 * @param UncompressedData Uncompressed block data
+	 * @param UncompressedSize Uncompressed block size
+	 * @param CompressedData Out compressed block data
+	 * @return Whether the compression was successful or not
+	 */
+	static bool CompressRawBlock(ERuntimeArchiverRawFormat RawFormat, ERuntimeArchiverCompressionLevel CompressionLevel, const uint8* UncompressedData, int64 UncompressedSize, TArray64<uint8>& CompressedData);
+
+	/**
+	 * Uncompress a single block of raw data compressed by CompressRawBlock
+	 *
+	 * @param RawFormat Raw format
+	 * @param CompressedData Compressed block data
+	 * @param CompressedSize Compressed block size
+	 * @param UncompressedData Memory to uncompress the block into
+	 * @param UncompressedSize Exact uncompressed block size
+	 * @return Whether the uncompression was successful or not
+	 */
+	static bool UncompressRawBlock(ERuntimeArchiverRawFormat RawFormat, const uint8* CompressedData, int64 CompressedSize, uint8* UncompressedData, int64 UncompressedSize);
 };
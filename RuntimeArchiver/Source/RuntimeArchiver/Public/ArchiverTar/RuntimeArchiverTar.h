@@ -25,7 +25,7 @@ public:
 	virtual bool CreateArchiveInMemory(int32 InitialAllocationSize = 0) override;
 
 	virtual bool OpenArchiveFromStorage(FString ArchivePath) override;
-	virtual bool OpenArchiveFromMemory(const TArray64<uint8>& ArchiveData) override;
+	virtual bool OpenArchiveFromMemoryView(TArrayView64<const uint8> ArchiveData) override;
 
 	virtual bool CloseArchive() override;
 
@@ -39,6 +39,7 @@ public:
 	virtual bool AddEntryFromMemory(FString EntryName, const TArray64<uint8>& DataToBeArchived, ERuntimeArchiverCompressionLevel CompressionLevel) override;
 
 	virtual bool ExtractEntryToMemory(const FRuntimeArchiveEntry& EntryInfo, TArray64<uint8>& UnarchivedData) override;
+	virtual bool ExtractEntryToFileHandle(const FRuntimeArchiveEntry& EntryInfo, IFileHandle& FileHandle) override;
 
 	virtual bool Initialize() override;
 	virtual bool IsInitialized() const override;
@@ -47,6 +48,15 @@ public:
 	virtual void ReportError(ERuntimeArchiverErrorCode ErrorCode, const FString& ErrorString) const override;
 	//~ End URuntimeArchiverBase Interface
 
+	/**
+	 * Open a tar archive on top of the specified stream, for reading or writing depending on the stream. Used to read and write tar archives through compression streams without holding them in memory
+	 *
+	 * @param Stream Stream to read the archive from or write it to
+	 * @param StreamLocation Where the stream data is located
+	 * @return Whether the operation was successful or not
+	 */
+	bool OpenArchiveFromStream(TUniquePtr<FRuntimeArchiverBaseStream> Stream, ERuntimeArchiverLocation StreamLocation);
+
 private:
 	/** Tar encapsulator */
 	TUniquePtr<FRuntimeArchiverTarEncapsulator> TarEncapsulator;
@@ -69,14 +79,14 @@ public:
 	bool IsValid();
 
 	/**
-	 * Test if tar archive contains valid data or not. Only the first header is checked for performance
+	 * Test if tar archive contains valid data or not. Only the first header is checked for performance, the entry index is built when entries are looked up
 	 * 
 	 * @return Whether the archive contains valid data or not
 	 */
 	bool TestArchive();
 
 	/**
-	 * Open a tar archive from a file as a stream for reading or writing
+	 * Open a tar archive from a file as a stream for reading or writing. Files opened for reading are memory-mapped if the platform supports it
 	 *
 	 * @param ArchivePath Path to archive to open
 	 * @param bWrite Whether to open for writing or for reading
@@ -87,12 +97,20 @@ public:
 	/**
 	 * Open a tar archive from memory as a stream for reading or writing
 	 *
-	 * @param ArchiveData Tar archive data. Must be empty if read-only mode is used
+	 * @param ArchiveData Tar archive data, read in place. Must be empty if write mode is used
 	 * @param InitialAllocationSize Estimated archive size if known. Avoids unnecessary memory allocation. Must be empty if read-only mode is used
 	 * @param bWrite Whether to open for writing or for reading
 	 * @return Whether the archive was successfully opened or not
 	 */
-	bool OpenMemory(const TArray64<uint8>& ArchiveData, int32 InitialAllocationSize, bool bWrite);
+	bool OpenMemory(TArrayView64<const uint8> ArchiveData, int32 InitialAllocationSize, bool bWrite);
+
+	/**
+	 * Open a tar archive from the specified stream for reading or writing, depending on the stream
+	 *
+	 * @param NewStream Stream to use
+	 * @return Whether the archive was successfully opened or not
+	 */
+	bool OpenStream(TUniquePtr<FRuntimeArchiverBaseStream> NewStream);
 
 	/**
 	 * Find header from the tar archive. Optionally updates the reading position of the found header. Works similar to the std::find_if algorithm
@@ -105,6 +123,35 @@ public:
 	 */
 	bool FindIf(TFunctionRef<bool(const FTarHeader&, int32)> ComparePredicate, FTarHeader& Header, int32& Index, bool bRemainPosition);
 
+	/**
+	 * Find header by the entry name using the entry index. Optionally updates the reading position of the found header
+	 *
+	 * @param EntryName Entry name to look for
+	 * @param Header Found header
+	 * @param Index Found entry index
+	 * @param bRemainPosition Whether to keep the previous read/write position, or update
+	 * @return Whether the header was found or not
+	 */
+	bool FindByName(const FString& EntryName, FTarHeader& Header, int32& Index, bool bRemainPosition);
+
+	/**
+	 * Find header by the entry index using the entry index. Optionally updates the reading position of the found header
+	 *
+	 * @param Index Entry index to look for
+	 * @param Header Found header
+	 * @param bRemainPosition Whether to keep the previous read/write position, or update
+	 * @return Whether the header was found or not
+	 */
+	bool FindByIndex(int32 Index, FTarHeader& Header, bool bRemainPosition);
+
+	/**
+	 * Check whether the archive contains an entry with the specified name
+	 *
+	 * @param EntryName Entry name to look for
+	 * @return Whether the entry exists or not
+	 */
+	bool ContainsEntry(const FString& EntryName);
+
 	/**
 	 * Get the number of tar archive entries
 	 *
@@ -151,6 +198,14 @@ public:
 	 */
 	bool ReadData(TArray64<uint8>& UnarchivedData);
 
+	/**
+	 * Get the archived data of the entry at the current position without copying. Only possible if the stream is backed by contiguous memory
+	 *
+	 * @param DataView View of the archived data
+	 * @return Whether the operation was successful or not
+	 */
+	bool ReadDataView(TArrayView64<const uint8>& DataView);
+
 	/**
 	 * Write the header from the current position
 	 *
@@ -176,13 +231,28 @@ public:
 	bool WriteNullBytes(int64 NumOfBytes) const;
 
 	/**
-	 * Write additional null bytes at the end to finalize the archive data
+	 * Write additional null bytes at the end to finalize the archive data, and finish the stream
 	 *
 	 * @return Whether the operation was successful or not
 	 */
 	bool Finalize();
 
 private:
+	/**
+	 * Add the next header not indexed yet to the entry index. Keeps the read/write position
+	 *
+	 * @return Whether an entry was indexed, or false if all entries are indexed
+	 */
+	bool IndexNextEntry();
+
+	/**
+	 * Add the header to the entry index
+	 *
+	 * @param Header Header to add
+	 * @param HeaderPosition Position of the header in the stream
+	 */
+	void AddToIndex(const FTarHeader& Header, int64 HeaderPosition);
+
 	/** Used stream */
 	TUniquePtr<FRuntimeArchiverBaseStream> Stream;
 
@@ -192,8 +262,17 @@ private:
 	/** Last header position */
 	int64 LastHeaderPosition;
 
-	/** Cached number of headers for a small optimization */
-	int32 CachedNumOfHeaders;
+	/** Header positions of all entries, in the order of entries */
+	TArray<int64> HeaderPositions;
+
+	/** Entry indices by entry name. If names are duplicated, the first entry is used */
+	TMap<FString, int32> EntryIndicesByName;
+
+	/** Position of the first header not indexed yet */
+	int64 NextIndexedHeaderPosition;
+
+	/** Whether all headers are indexed or not */
+	bool bIndexComplete;
 
 	/** Whether the tar archive was finalized or not */
 	bool bIsFinalized;
@@ -6,6 +6,9 @@
 #include "RuntimeArchiverBase.h"
 #include "RuntimeArchiverZip.generated.h"
 
+class IMappedFileHandle;
+class IMappedFileRegion;
+
 /**
  * Zip archiver class. Works with zip archives
  */
@@ -23,7 +26,7 @@ public:
 	virtual bool CreateArchiveInMemory(int32 InitialAllocationSize = 0) override;
 
 	virtual bool OpenArchiveFromStorage(FString ArchivePath) override;
-	virtual bool OpenArchiveFromMemory(const TArray64<uint8>& ArchiveData) override;
+	virtual bool OpenArchiveFromMemoryView(TArrayView64<const uint8> ArchiveData) override;
 
 	virtual bool CloseArchive() override;
 
@@ -37,12 +40,17 @@ public:
 	virtual bool AddEntryFromMemory(FString EntryName, const TArray64<uint8>& DataToBeArchived, ERuntimeArchiverCompressionLevel CompressionLevel) override;
 
 	virtual bool ExtractEntryToMemory(const FRuntimeArchiveEntry& EntryInfo, TArray64<uint8>& UnarchivedData) override;
+	virtual bool ExtractEntryToFileHandle(const FRuntimeArchiveEntry& EntryInfo, IFileHandle& FileHandle) override;
 
 	virtual bool Initialize() override;
 	virtual bool IsInitialized() const override;
 	virtual void Reset() override;
 
 	virtual void ReportError(ERuntimeArchiverErrorCode ErrorCode, const FString& ErrorString) const override;
+
+protected:
+	virtual bool AddEntriesFromStorage_Internal(const TArray<TPair<FString, FString>>& Entries, ERuntimeArchiverCompressionLevel CompressionLevel, const TFunction<void(int32)>& OnProgress) override;
+	virtual bool ExtractEntriesToStorage_Internal(const TArray<TPair<FRuntimeArchiveEntry, FString>>& Entries, bool bForceOverwrite, const TFunction<void(int32)>& OnProgress) override;
 	//~ End URuntimeArchiverBase Interface
 
 public:
@@ -59,6 +67,15 @@ private:
 	/** Whether to use append mode or not */
 	bool bAppendMode;
 
+	/** Path to the archive opened from storage. Used to open additional readers for parallel extraction */
+	FString OpenedArchivePath;
+
 	/** Miniz archiver */
 	void* MinizArchiver;
+
+	/** Mapped archive file when opened from storage to read. Must outlive the mapped region */
+	IMappedFileHandle* MappedFileHandle;
+
+	/** Region covering the whole mapped archive file, which miniz reads from */
+	IMappedFileRegion* MappedFileRegion;
 };
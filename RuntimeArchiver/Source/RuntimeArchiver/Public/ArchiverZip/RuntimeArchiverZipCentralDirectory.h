@@ -0,0 +1,93 @@
+﻿// Georgy Treshchev 2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Reads the central directory of a zip archive from the end of the archive, without reading the entry data
+ * Knowing where each entry is located allows comparing two archives entry by entry, e.g. to download only the changed entries of an updated archive
+ */
+class RUNTIMEARCHIVER_API FRuntimeArchiverZipCentralDirectory
+{
+public:
+	/** Information about an entry listed in the central directory */
+	struct FEntry
+	{
+		FString Name;
+
+		/** General purpose flags and compression method */
+		uint16 Flags;
+		uint16 Method;
+
+		/** Modification time and date in the MS-DOS format, as the time in the low and the date in the high 16 bits */
+		uint32 DosTime;
+
+		uint32 Crc32;
+		int64 CompressedSize;
+		int64 UncompressedSize;
+
+		/** Offset of the local header of the entry in the archive */
+		int64 LocalHeaderOffset;
+
+		/** Offset following the entry in the archive, including its local header, data and data descriptor */
+		int64 EndOffset;
+
+		/**
+		 * Get the number of bytes the entry occupies in the archive
+		 */
+		int64 GetSpanSize() const { return EndOffset - LocalHeaderOffset; }
+	};
+
+	/** Number of bytes at the end of an archive that always contain the end of central directory record, unless the archive comment is longer */
+	static constexpr int64 DefaultTailSize = 64 * 1024;
+
+	FRuntimeArchiverZipCentralDirectory();
+
+	/**
+	 * Read the central directory from the last bytes of an archive
+	 *
+	 * @param TailData The last bytes of the archive
+	 * @param TailSize Number of the last bytes of the archive
+	 * @param ArchiveSize Size of the whole archive
+	 * @param RequiredTailSize Number of the last bytes required to read the central directory. If it is greater than TailSize, reading has to be repeated with more data
+	 * @return Whether the central directory was read successfully or not
+	 */
+	bool Read(const uint8* TailData, int64 TailSize, int64 ArchiveSize, int64& RequiredTailSize);
+
+	/**
+	 * Read the central directory of an archive in storage
+	 *
+	 * @param ArchivePath Path to the archive
+	 * @return Whether the central directory was read successfully or not
+	 */
+	bool ReadFromFile(const FString& ArchivePath);
+
+	/**
+	 * Get the entries listed in the central directory, sorted by their offset in the archive
+	 */
+	const TArray<FEntry>& GetEntries() const { return Entries; }
+
+	/**
+	 * Get the offset of the central directory in the archive. Everything from it to the end of the archive belongs to the central directory and the records following it
+	 */
+	int64 GetCentralDirectoryOffset() const { return CentralDirectoryOffset; }
+
+	/**
+	 * Get the description of the error reading has failed with
+	 */
+	const FString& GetErrorMessage() const { return ErrorMessage; }
+
+private:
+	/** Mark reading as failed */
+	bool Fail(const FString& Message);
+
+	/** Entries listed in the central directory, sorted by their offset in the archive */
+	TArray<FEntry> Entries;
+
+	/** Offset of the central directory in the archive */
+	int64 CentralDirectoryOffset;
+
+	/** Description of the error reading has failed with */
+	FString ErrorMessage;
+};
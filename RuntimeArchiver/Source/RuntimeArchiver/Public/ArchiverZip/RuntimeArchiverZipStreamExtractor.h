@@ -0,0 +1,233 @@
+﻿// Georgy Treshchev 2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IFileHandle;
+
+/**
+ * Extracts a zip archive to storage while its data is still arriving, e.g. while it is being downloaded
+ * Data must be appended sequentially from the beginning of the archive. Each entry is extracted as soon as its local header and data have been appended,
+ * and the central directory at the end of the archive is used to validate the extracted entries once all data has been appended
+ * Not thread-safe: appending and finishing must not be done from multiple threads at the same time
+ */
+class RUNTIMEARCHIVER_API FRuntimeArchiverZipStreamExtractor
+{
+public:
+	/** Information about an extracted entry */
+	struct FExtractedEntry
+	{
+		uint32 Crc32;
+		int64 UncompressedSize;
+
+		/** Whether the entry data was skipped instead of being written to storage */
+		bool bSkipped;
+	};
+
+	/**
+	 * Decides whether an entry is already present elsewhere and does not need to be extracted
+	 * Called with the entry name, CRC-32 and uncompressed size as specified in the local header
+	 */
+	using FShouldSkipEntry = TFunction<bool(const FString& EntryName, uint32 Crc32, int64 UncompressedSize)>;
+
+	/** It should be impossible to create this object by the default constructor */
+	FRuntimeArchiverZipStreamExtractor() = delete;
+
+	/**
+	 * Create an extractor
+	 *
+	 * @param DirectoryPath Path to the directory to extract the entries to
+	 * @param bForceOverwrite Whether to overwrite existing files or fail
+	 */
+	explicit FRuntimeArchiverZipStreamExtractor(const FString& DirectoryPath, bool bForceOverwrite = true);
+
+	~FRuntimeArchiverZipStreamExtractor();
+
+	FRuntimeArchiverZipStreamExtractor(const FRuntimeArchiverZipStreamExtractor&) = delete;
+	FRuntimeArchiverZipStreamExtractor& operator=(const FRuntimeArchiverZipStreamExtractor&) = delete;
+
+	/**
+	 * Append the next part of the archive data, extracting the entries that become complete
+	 *
+	 * @param Data Archive data following the previously appended data
+	 * @param Size Data size
+	 * @return Whether the operation was successful or not
+	 */
+	bool Append(const uint8* Data, int64 Size);
+
+	/**
+	 * Complete the extraction after all archive data has been appended, validating the extracted entries against the central directory
+	 *
+	 * @return Whether all entries were extracted and validated successfully or not
+	 */
+	bool Finish();
+
+	/**
+	 * Set the callback deciding which file entries are skipped instead of being extracted
+	 * Only entries whose CRC-32 and sizes are specified in the local header can be skipped. Their data is still validated against the central directory
+	 *
+	 * @param InShouldSkipEntry Callback returning true for the entries to skip
+	 */
+	void SetShouldSkipEntry(FShouldSkipEntry InShouldSkipEntry) { ShouldSkipEntry = MoveTemp(InShouldSkipEntry); }
+
+	/**
+	 * Check if the extraction has failed. Appending more data has no effect afterwards
+	 */
+	bool HasFailed() const { return bFailed; }
+
+	/**
+	 * Get the description of the error the extraction has failed with
+	 */
+	const FString& GetErrorMessage() const { return ErrorMessage; }
+
+	/**
+	 * Get the number of bytes of the archive appended so far
+	 */
+	int64 GetNumOfAppendedBytes() const { return NumOfAppendedBytes; }
+
+	/**
+	 * Get the number of bytes written to the extracted files so far
+	 */
+	int64 GetNumOfExtractedBytes() const { return NumOfExtractedBytes; }
+
+	/**
+	 * Get the paths of the files extracted so far
+	 */
+	const TArray<FString>& GetExtractedFilePaths() const { return ExtractedFilePaths; }
+
+	/**
+	 * Get the entries extracted or skipped so far, by name
+	 */
+	const TMap<FString, FExtractedEntry>& GetExtractedEntries() const { return ExtractedEntries; }
+
+	/**
+	 * Get the number of uncompressed bytes of the entries skipped so far
+	 */
+	int64 GetNumOfSkippedBytes() const { return NumOfSkippedBytes; }
+
+private:
+	/** What the extractor expects to read next */
+	enum class EState : uint8
+	{
+		Signature,
+		LocalHeader,
+		EntryData,
+		DataDescriptor,
+		CentralDirectory
+	};
+
+	/** Process as much of the pending data as possible */
+	bool ProcessPendingData();
+
+	/** Read the local header of the next entry and prepare its extraction */
+	bool ReadLocalHeader(bool& bNeedMoreData);
+
+	/** Extract the available data of the current entry */
+	bool ReadEntryData(bool& bNeedMoreData);
+
+	/** Consume the available data of the current entry without extracting it */
+	bool SkipEntryData(bool& bNeedMoreData);
+
+	/** Read the data descriptor following the current entry data */
+	bool ReadDataDescriptor(bool& bNeedMoreData);
+
+	/** Validate the current entry and finish its extraction */
+	bool CompleteEntry(uint32 ExpectedCrc32, int64 ExpectedCompressedSize, int64 ExpectedUncompressedSize);
+
+	/** Write the uncompressed data of the current entry */
+	bool WriteEntryData(const uint8* Data, int64 Size);
+
+	/** Validate the extracted entries against the central directory */
+	bool ValidateCentralDirectory();
+
+	/** Get the number of pending bytes that have not been processed yet */
+	int64 GetNumOfPendingBytes() const { return PendingData.Num() - PendingOffset; }
+
+	/** Get the pending bytes that have not been processed yet */
+	const uint8* GetPendingBytes() const { return PendingData.GetData() + PendingOffset; }
+
+	/** Mark the extraction as failed */
+	bool Fail(const FString& Message);
+
+	/** Close the file of the current entry */
+	void CloseEntryFile(bool bDelete);
+
+	/** Path to the directory to extract the entries to */
+	FString DirectoryPath;
+
+	/** Whether to overwrite existing files or fail */
+	bool bForceOverwrite;
+
+	/** Appended data that has not been processed yet, starting at PendingOffset */
+	TArray64<uint8> PendingData;
+	int64 PendingOffset;
+
+	/** What the extractor expects to read next */
+	EState State;
+
+	/** Name of the current entry */
+	FString EntryName;
+
+	/** Full path of the current entry in storage */
+	FString EntryFilePath;
+
+	/** General purpose flags, compression method and sizes of the current entry as specified in the local header */
+	uint16 EntryFlags;
+	uint16 EntryMethod;
+	uint32 EntryHeaderCrc32;
+	int64 EntryHeaderCompressedSize;
+	int64 EntryHeaderUncompressedSize;
+
+	/** Whether the current entry uses 64-bit sizes or not */
+	bool bEntryZip64;
+
+	/** Whether the data of the current entry is skipped instead of being extracted */
+	bool bEntrySkipped;
+
+	/** Callback deciding which file entries are skipped */
+	FShouldSkipEntry ShouldSkipEntry;
+
+	/** Number of compressed bytes of the current entry processed so far */
+	int64 EntryConsumedSize;
+
+	/** Number of uncompressed bytes of the current entry written so far */
+	int64 EntryWrittenSize;
+
+	/** CRC-32 of the uncompressed data of the current entry written so far */
+	uint32 EntryCrc32;
+
+	/** The file handle the current entry is written to. Null for directories */
+	TUniquePtr<IFileHandle> EntryFileHandle;
+
+	/** Miniz inflator used for deflated entries */
+	void* Inflator;
+
+	/** Circular dictionary the inflator writes to */
+	TArray<uint8> Dictionary;
+	int32 DictionaryOffset;
+
+	/** Entries extracted so far, by name */
+	TMap<FString, FExtractedEntry> ExtractedEntries;
+
+	/** Paths of the files extracted so far */
+	TArray<FString> ExtractedFilePaths;
+
+	/** Number of bytes of the archive appended so far */
+	int64 NumOfAppendedBytes;
+
+	/** Number of bytes written to the extracted files so far */
+	int64 NumOfExtractedBytes;
+
+	/** Number of uncompressed bytes of the entries skipped so far */
+	int64 NumOfSkippedBytes;
+
+	/** Description of the error the extraction has failed with */
+	FString ErrorMessage;
+
+	/** Whether the extraction has failed or not */
+	bool bFailed;
+
+	/** Whether the extraction has been finished or not */
+	bool bFinished;
+};
@@ -8,6 +8,8 @@
 #include "Templates/SubclassOf.h"
 #include "RuntimeArchiverBase.generated.h"
 
+class IFileHandle;
+
 /**
  * The base class for the archiver. Do not create it manually!
  */
@@ -71,12 +73,28 @@ public:
 	bool OpenArchiveFromMemory(TArray<uint8> ArchiveData);
 
 	/**
-	 * Open an archive from memory. Prefer to use this function if possible
+	 * Open an archive from memory. The data is copied, so it does not have to outlive the archive
+	 *
+	 * @param ArchiveData Binary archive data
+	 * @return Whether the operation was successful or not
+	 */
+	bool OpenArchiveFromMemory(const TArray64<uint8>& ArchiveData);
+
+	/**
+	 * Open an archive from memory, taking ownership of the data without copying. Prefer to use this function if possible
+	 *
+	 * @param ArchiveData Binary archive data
+	 * @return Whether the operation was successful or not
+	 */
+	bool OpenArchiveFromMemory(TArray64<uint8>&& ArchiveData);
+
+	/**
+	 * Open an archive from memory, reading the data in place without copying. The data must outlive the archive
 	 *
 	 * @param ArchiveData Binary archive data
 	 * @return Whether the operation was successful or not
 	 */
-	virtual bool OpenArchiveFromMemory(const TArray64<uint8>& ArchiveData);
+	virtual bool OpenArchiveFromMemoryView(TArrayView64<const uint8> ArchiveData);
 
 	/**
 	 * Close previously created/opened archive
@@ -252,6 +270,15 @@ public:
 	 */
 	virtual bool ExtractEntryToMemory(const FRuntimeArchiveEntry& EntryInfo, TArray64<uint8>& UnarchivedData);
 
+	/**
+	 * Extract entry into the file handle. By default, the entry is extracted into memory first, so archivers capable of decompressing in chunks should override this
+	 *
+	 * @param EntryInfo Information about the entry
+	 * @param FileHandle File handle opened for writing
+	 * @return Whether the operation was successful or not
+	 */
+	virtual bool ExtractEntryToFileHandle(const FRuntimeArchiveEntry& EntryInfo, IFileHandle& FileHandle);
+
 	/**
 	 * Initialize the archiver
 	 */
@@ -267,7 +294,40 @@ public:
 	 */
 	virtual void Reset();
 
+	/**
+	 * Set the maximum number of workers used to process entries in parallel. Only used by archivers that support it
+	 *
+	 * @param NewMaxWorkers Maximum number of workers. 0 means the number of task graph worker threads
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Runtime Archiver|Settings")
+	void SetMaxWorkers(int32 NewMaxWorkers);
+
 protected:
+	/**
+	 * Add the entries from storage. Called from a background thread
+	 *
+	 * @param Entries Entry names along with the paths to the files to be archived
+	 * @param CompressionLevel Compression level. The higher the level, the more compression
+	 * @param OnProgress Called with the overall progress percentage
+	 * @return Whether the operation was successful or not
+	 */
+	virtual bool AddEntriesFromStorage_Internal(const TArray<TPair<FString, FString>>& Entries, ERuntimeArchiverCompressionLevel CompressionLevel, const TFunction<void(int32)>& OnProgress);
+
+	/**
+	 * Extract the entries to storage. Called from a background thread
+	 *
+	 * @param Entries Entries to extract along with the file paths to extract them to
+	 * @param bForceOverwrite Whether to force a file to be overwritten if it exists or not
+	 * @param OnProgress Called with the overall progress percentage
+	 * @return Whether the operation was successful or not
+	 */
+	virtual bool ExtractEntriesToStorage_Internal(const TArray<TPair<FRuntimeArchiveEntry, FString>>& Entries, bool bForceOverwrite, const TFunction<void(int32)>& OnProgress);
+
+	/**
+	 * Get the number of workers to use for processing the specified number of entries in parallel
+	 */
+	int32 GetNumOfWorkers(int32 NumOfEntries) const;
+
 	/**
 	 * Report an error in the archiver
 	 *
@@ -281,4 +341,10 @@ protected:
 
 	/** Archive location */
 	ERuntimeArchiverLocation Location;
+
+	/** Maximum number of workers used to process entries in parallel. 0 means the number of task graph worker threads */
+	int32 MaxWorkers;
+
+	/** Archive data owned by the archiver when opened from memory by copying or moving, which archivers read in place */
+	TArray64<uint8> OwnedArchiveData;
 };
@@ -79,6 +79,26 @@ public:
 		return false;
 	}
 
+	/**
+	 * Write out any data buffered by the stream to the underlying storage, without completing writing
+	 *
+	 * @return Whether the operation was successful or not
+	 */
+	virtual bool Flush()
+	{
+		return true;
+	}
+
+	/**
+	 * Complete writing. Streams that transform the data (such as compression streams) write out the remaining data here, so nothing can be written afterwards
+	 *
+	 * @return Whether the operation was successful or not
+	 */
+	virtual bool Finish()
+	{
+		return true;
+	}
+
 	/**
 	 * Get the total size
 	 */
@@ -88,6 +108,16 @@ public:
 		return 0;
 	}
 
+	/**
+	 * Get direct access to the whole data, allowing it to be read without copying
+	 *
+	 * @return Pointer to the beginning of the data, or nullptr if the stream is not backed by contiguous memory
+	 */
+	virtual const uint8* GetData() const
+	{
+		return nullptr;
+	}
+
 protected:
 	/** Current read or write position */
 	int64 Position;
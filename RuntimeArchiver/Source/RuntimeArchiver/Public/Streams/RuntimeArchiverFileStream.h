@@ -10,13 +10,17 @@ public:
 	/** It should be impossible to create this object by the default constructor */
 	FRuntimeArchiverFileStream() = delete;
 
+	/** Default size of the buffer that accumulates small writes before passing them to the file system */
+	static constexpr int32 DefaultWriteBufferSize{256 * 1024};
+
 	/**
 	 * Open a tar archive file stream
 	 *
 	 * @param ArchivePath Path to open an archive
 	 * @param bWrite Whether to open for writing or not
+	 * @param WriteBufferSize Size of the write buffer in bytes. 0 disables buffering and writes the data directly
 	 */
-	explicit FRuntimeArchiverFileStream(const FString& ArchivePath, bool bWrite);
+	explicit FRuntimeArchiverFileStream(const FString& ArchivePath, bool bWrite, int32 WriteBufferSize = DefaultWriteBufferSize);
 
 	virtual ~FRuntimeArchiverFileStream() override;
 
@@ -26,9 +30,17 @@ public:
 	virtual bool Write(const void* Data, int64 Size) override;
 	virtual bool Seek(int64 NewPosition) override;
 	virtual int64 Size() override;
+	virtual bool Flush() override;
+	virtual bool Finish() override;
 	//~ End FRuntimeArchiverBaseStream Interface
 
 private:
 	/** The file handle used to read or write */
 	IFileHandle* FileHandle;
+
+	/** Data written but not yet passed to the file handle */
+	TArray64<uint8> WriteBuffer;
+
+	/** Maximum number of bytes accumulated in the write buffer before it is flushed */
+	int32 WriteBufferSize;
 };
@@ -0,0 +1,130 @@
+﻿#pragma once
+#include "RuntimeArchiverBaseStream.h"
+#include "RuntimeArchiverTypes.h"
+
+/**
+ * GZip tar stream. Deflates data while writing to the compressed stream and inflates it while reading, keeping only a window of the uncompressed data in memory
+ * Seeking forward inflates up to the requested position, while seeking backward past the window restarts inflating from the beginning
+ */
+class RUNTIMEARCHIVER_API FRuntimeArchiverGZipStream : public FRuntimeArchiverBaseStream
+{
+public:
+	/** It should be impossible to create this object by the default constructor */
+	FRuntimeArchiverGZipStream() = delete;
+
+	/**
+	 * Open a gzip stream on top of the compressed stream. Reads or writes depending on the compressed stream
+	 *
+	 * @param CompressedStream Stream containing the compressed data. Must outlive this stream
+	 * @param CompressionLevel Compression level used when writing
+	 */
+	explicit FRuntimeArchiverGZipStream(FRuntimeArchiverBaseStream& CompressedStream, ERuntimeArchiverCompressionLevel CompressionLevel = ERuntimeArchiverCompressionLevel::Compression6);
+
+	virtual ~FRuntimeArchiverGZipStream() override;
+
+	/**
+	 * Set the compression level. Has no effect once data has been written
+	 *
+	 * @param NewCompressionLevel Compression level
+	 */
+	void SetCompressionLevel(ERuntimeArchiverCompressionLevel NewCompressionLevel);
+
+	//~ Begin FRuntimeArchiverBaseStream Interface
+	virtual bool IsValid() const override;
+	virtual bool Read(void* Data, int64 Size) override;
+	virtual bool Write(const void* Data, int64 Size) override;
+	virtual bool Seek(int64 NewPosition) override;
+	virtual bool Finish() override;
+	virtual int64 Size() override;
+	//~ End FRuntimeArchiverBaseStream Interface
+
+private:
+	/**
+	 * Parse the gzip header and the trailer of the compressed stream
+	 *
+	 * @return Whether the operation was successful or not
+	 */
+	bool ReadGZipHeader();
+
+	/**
+	 * Start inflating from the beginning of the compressed data
+	 *
+	 * @return Whether the operation was successful or not
+	 */
+	bool RestartInflating();
+
+	/**
+	 * Inflate the next portion of the compressed data into the window
+	 *
+	 * @return Whether the operation was successful or not
+	 */
+	bool InflateMore();
+
+	/**
+	 * Get the uncompressed size as far as it is known without inflating further. Exact once the deflate data was completely inflated
+	 *
+	 * @return The smallest uncompressed size matching the gzip trailer that is not less than the inflated size
+	 */
+	int64 GetKnownUncompressedSize() const;
+
+	/**
+	 * Deflate the data and write the compressed output
+	 *
+	 * @param Data Data to deflate. Can be nullptr if finishing
+	 * @param Size Data size
+	 * @param bFinish Whether to finish the deflate stream or not
+	 * @return Whether the operation was successful or not
+	 */
+	bool Deflate(const uint8* Data, int64 Size, bool bFinish);
+
+	/** Stream containing the compressed data */
+	FRuntimeArchiverBaseStream& CompressedStream;
+
+	/** Compression level used when writing */
+	ERuntimeArchiverCompressionLevel CompressionLevel;
+
+	/** Miniz compressor (tdefl_compressor) or decompressor (tinfl_decompressor) */
+	void* MinizCodec;
+
+	/** Position of the deflate data in the compressed stream */
+	int64 DeflateDataPosition;
+
+	/** Position of the next compressed data to read from the compressed stream */
+	int64 CompressedPosition;
+
+	/** Position of the gzip trailer in the compressed stream */
+	int64 TrailerPosition;
+
+	/** Uncompressed size taken from the gzip trailer. Only a hint, since it is stored modulo 2^32 by the gzip format */
+	int64 UncompressedSizeHint;
+
+	/** Compressed data read from the compressed stream but not inflated yet, or deflated data to be written */
+	TArray<uint8> CompressedBuffer;
+
+	/** Offset of the data not inflated yet in the compressed buffer */
+	int32 CompressedBufferOffset;
+
+	/** Inflate dictionary */
+	TArray<uint8> Dictionary;
+
+	/** Offset of the next inflated data in the dictionary */
+	int32 DictionaryOffset;
+
+	/** Window of the inflated data */
+	TArray64<uint8> Window;
+
+	/** Uncompressed position of the first byte in the window */
+	int64 WindowPosition;
+
+	/** Whether the deflate data was completely inflated or not */
+	bool bInflateDone;
+
+	/** CRC-32 of the written uncompressed data */
+	uint32 Crc32;
+
+	/** Whether the stream is valid or not */
+	bool bValid;
+
+	/** Whether writing was completed or not */
+	bool bFinished;
+};
@@ -0,0 +1,39 @@
+﻿#pragma once
+#include "RuntimeArchiverBaseStream.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Memory-mapped file tar stream. Reads data straight from the mapped file region, leaving the buffering to the OS page cache. Read-only
+ */
+class RUNTIMEARCHIVER_API FRuntimeArchiverMappedFileStream : public FRuntimeArchiverBaseStream
+{
+public:
+	/** It should be impossible to create this object by the default constructor */
+	FRuntimeArchiverMappedFileStream() = delete;
+
+	/**
+	 * Map the archive file for reading
+	 *
+	 * @param ArchivePath Path to open an archive
+	 */
+	explicit FRuntimeArchiverMappedFileStream(const FString& ArchivePath);
+
+	virtual ~FRuntimeArchiverMappedFileStream() override;
+
+	//~ Begin FRuntimeArchiverBaseStream Interface
+	virtual bool IsValid() const override;
+	virtual bool Read(void* Data, int64 Size) override;
+	virtual bool Seek(int64 NewPosition) override;
+	virtual int64 Size() override;
+	virtual const uint8* GetData() const override;
+	//~ End FRuntimeArchiverBaseStream Interface
+
+private:
+	/** The mapped file handle. Must outlive the mapped region */
+	IMappedFileHandle* MappedFileHandle;
+
+	/** The region covering the whole file */
+	IMappedFileRegion* MappedFileRegion;
+};
@@ -19,6 +19,20 @@ public:
 	 */
 	explicit FRuntimeArchiverMemoryStream(const TArray64<uint8>& ArchiveData);
 
+	/**
+	 * Read-only constructor that takes ownership of the data without copying
+	 *
+	 * @param ArchiveData Binary archive data
+	 */
+	explicit FRuntimeArchiverMemoryStream(TArray64<uint8>&& ArchiveData);
+
+	/**
+	 * Read-only constructor that reads the data in place without copying. The data must outlive the stream
+	 *
+	 * @param ArchiveDataView Binary archive data
+	 */
+	explicit FRuntimeArchiverMemoryStream(TArrayView64<const uint8> ArchiveDataView);
+
 	/**
 	 * Write constructor
 	 *
@@ -32,9 +46,16 @@ public:
 	virtual bool Write(const void* Data, int64 Size) override;
 	virtual bool Seek(int64 NewPosition) override;
 	virtual int64 Size() override;
+	virtual const uint8* GetData() const override;
 	//~ End FArchiverTarBaseStream Interface
 
 protected:
-	/** Binary archive data */
+	/** Get the data currently managed by the stream, either written or to be read */
+	TArrayView64<const uint8> GetDataView() const;
+
+	/** Binary archive data. Used for writing and for reading when the data is owned by the stream */
 	TArray64<uint8> ArchiveData;
+
+	/** View of the data to read from. Points either to the owned archive data or to the external data */
+	TArrayView64<const uint8> ArchiveDataView;
 };
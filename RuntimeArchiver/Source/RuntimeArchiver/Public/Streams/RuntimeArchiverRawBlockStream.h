@@ -0,0 +1,125 @@
+﻿#pragma once
+#include "RuntimeArchiverBaseStream.h"
+#include "RuntimeArchiverTypes.h"
+
+/**
+ * Block compression tar stream. Compresses data in independent raw blocks (LZ4, Oodle, etc.) while writing to the compressed stream, and uncompresses only the blocks being read
+ * The stream starts with a small header, followed by frames consisting of the uncompressed size, the compressed size and the block data, and ends with an empty frame
+ */
+class RUNTIMEARCHIVER_API FRuntimeArchiverRawBlockStream : public FRuntimeArchiverBaseStream
+{
+public:
+	/** Default size of an uncompressed block */
+	static constexpr int32 DefaultBlockSize = 1024 * 1024;
+
+	/** It should be impossible to create this object by the default constructor */
+	FRuntimeArchiverRawBlockStream() = delete;
+
+	/**
+	 * Open a block compression stream on top of the compressed stream. Reads or writes depending on the compressed stream
+	 *
+	 * @param CompressedStream Stream containing the compressed data. Must outlive this stream
+	 * @param RawFormat Raw format used to compress the blocks
+	 * @param CompressionLevel Compression level used when writing
+	 * @param BlockSize Size of an uncompressed block used when writing
+	 */
+	explicit FRuntimeArchiverRawBlockStream(FRuntimeArchiverBaseStream& CompressedStream, ERuntimeArchiverRawFormat RawFormat, ERuntimeArchiverCompressionLevel CompressionLevel = ERuntimeArchiverCompressionLevel::Compression6, int32 BlockSize = DefaultBlockSize);
+
+	virtual ~FRuntimeArchiverRawBlockStream() override;
+
+	/**
+	 * Check if the stream contains block compressed data. The stream position is reset to the beginning
+	 *
+	 * @param CompressedStream Stream to check
+	 * @return Whether the stream starts with the block stream header or not
+	 */
+	static bool IsBlockStream(FRuntimeArchiverBaseStream& CompressedStream);
+
+	/**
+	 * Set the compression level used for the blocks written afterwards
+	 *
+	 * @param NewCompressionLevel Compression level
+	 */
+	void SetCompressionLevel(ERuntimeArchiverCompressionLevel NewCompressionLevel);
+
+	//~ Begin FRuntimeArchiverBaseStream Interface
+	virtual bool IsValid() const override;
+	virtual bool Read(void* Data, int64 Size) override;
+	virtual bool Write(const void* Data, int64 Size) override;
+	virtual bool Seek(int64 NewPosition) override;
+	virtual bool Finish() override;
+	virtual int64 Size() override;
+	//~ End FRuntimeArchiverBaseStream Interface
+
+private:
+	/** Information about a compressed block, obtained without uncompressing it */
+	struct FBlockInfo
+	{
+		/** Position of the block in the uncompressed data */
+		int64 UncompressedOffset;
+
+		/** Position of the block frame in the compressed stream */
+		int64 FrameOffset;
+
+		/** Uncompressed block size */
+		uint32 UncompressedSize;
+
+		/** Compressed block size. Equal to the uncompressed size if the block is stored without compression */
+		uint32 CompressedSize;
+	};
+
+	/**
+	 * Read the frame header following the last indexed block and add it to the block index
+	 *
+	 * @return Whether the operation was successful or not
+	 */
+	bool IndexNextBlock();
+
+	/**
+	 * Uncompress the block containing the specified uncompressed position, unless it is already uncompressed
+	 *
+	 * @param UncompressedPosition Position in the uncompressed data
+	 * @return Whether the operation was successful or not
+	 */
+	bool LoadBlockAt(int64 UncompressedPosition);
+
+	/**
+	 * Compress the pending block data and write it as a frame
+	 *
+	 * @return Whether the operation was successful or not
+	 */
+	bool FlushBlock();
+
+	/** Stream containing the compressed data */
+	FRuntimeArchiverBaseStream& CompressedStream;
+
+	/** Raw format used to compress the blocks */
+	ERuntimeArchiverRawFormat RawFormat;
+
+	/** Compression level used when writing */
+	ERuntimeArchiverCompressionLevel CompressionLevel;
+
+	/** Size of an uncompressed block used when writing */
+	int32 BlockSize;
+
+	/** Blocks discovered so far while reading */
+	TArray<FBlockInfo> BlockIndex;
+
+	/** Whether all blocks were indexed or not */
+	bool bBlockIndexComplete;
+
+	/** Index of the block currently held in BlockData, or INDEX_NONE */
+	int32 CurrentBlockIndex;
+
+	/** Uncompressed data of the current block when reading, or pending data of the block being written */
+	TArray64<uint8> BlockData;
+
+	/** Temporary compressed data of a single block */
+	TArray64<uint8> CompressedBlockData;
+
+	/** Whether the stream header was successfully read or written */
+	bool bValid;
+
+	/** Whether writing was completed or not */
+	bool bFinished;
+};
@@ -48,6 +48,48 @@ void UBaseFilesDownloader::GetContentSize(const FString& URL, float Timeout, con
 	});
 }
 
+bool UBaseFilesDownloader::SetDownloadRateLimit(int64 BytesPerSecond)
+{
+	DownloadRateLimit = BytesPerSecond;
+
+	if (!RuntimeChunkDownloaderPtr.IsValid())
+	{
+		return false;
+	}
+
+	RuntimeChunkDownloaderPtr->SetRateLimit(BytesPerSecond);
+	return true;
+}
+
+bool UBaseFilesDownloader::SetAdaptiveChunkSize(float TargetChunkDuration, int64 MinChunkSize)
+{
+	AdaptiveChunkDuration = TargetChunkDuration;
+	AdaptiveMinChunkSize = MinChunkSize;
+
+	if (!RuntimeChunkDownloaderPtr.IsValid())
+	{
+		return false;
+	}
+
+	RuntimeChunkDownloaderPtr->SetAdaptiveChunkSize(TargetChunkDuration, MinChunkSize);
+	return true;
+}
+
+float UBaseFilesDownloader::GetDownloadThroughput() const
+{
+	return RuntimeChunkDownloaderPtr.IsValid() ? static_cast<float>(RuntimeChunkDownloaderPtr->GetDownloadStats().SmoothedThroughput) : 0.f;
+}
+
+void UBaseFilesDownloader::SetGlobalDownloadRateLimit(int64 BytesPerSecond)
+{
+	FRuntimeChunkDownloader::SetGlobalRateLimit(BytesPerSecond);
+}
+
+int64 UBaseFilesDownloader::GetGlobalDownloadRateLimit()
+{
+	return FRuntimeChunkDownloader::GetGlobalRateLimit();
+}
+
 FString UBaseFilesDownloader::BytesToString(const TArray<uint8>& Bytes)
 {
 	const uint8* BytesData = Bytes.GetData();
@@ -91,6 +133,13 @@ bool UBaseFilesDownloader::IsFileExist(const FString& FilePath)
 	return FPaths::FileExists(FilePath);
 }
 
+void UBaseFilesDownloader::CreateChunkDownloader()
+{
+	RuntimeChunkDownloaderPtr = MakeShared<FRuntimeChunkDownloader>();
+	RuntimeChunkDownloaderPtr->SetRateLimit(DownloadRateLimit);
+	RuntimeChunkDownloaderPtr->SetAdaptiveChunkSize(AdaptiveChunkDuration, AdaptiveMinChunkSize);
+}
+
 void UBaseFilesDownloader::BroadcastProgress(int64 BytesReceived, int64 ContentLength, float ProgressRatio) const
 {
 	if (OnDownloadProgress.IsBound())
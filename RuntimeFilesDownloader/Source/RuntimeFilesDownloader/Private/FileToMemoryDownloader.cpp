@@ -99,7 +99,7 @@ void UFileToMemoryDownloader::DownloadFileToMemory(const FString& URL, float Tim
 		OnDownloadComplete.ExecuteIfBound(Result.Data, Result.Result);
 	};
 
-	RuntimeChunkDownloaderPtr = MakeShared<FRuntimeChunkDownloader>();
+	CreateChunkDownloader();
 	if (bForceByPayload)
 	{
 		RuntimeChunkDownloaderPtr->DownloadFileByPayload(URL, Timeout, ContentType, OnProgress).Next(OnResult);
@@ -126,7 +126,7 @@ void UFileToMemoryDownloader::DownloadFileToMemoryPerChunk(const FString& URL, f
 		Timeout = 0;
 	}
 
-	RuntimeChunkDownloaderPtr = MakeShared<FRuntimeChunkDownloader>();
+	CreateChunkDownloader();
 	RuntimeChunkDownloaderPtr->DownloadFilePerChunk(URL, Timeout, ContentType, MaxChunkSize, FInt64Vector2(), [this](int64 BytesReceived, int64 ContentSize)
 	{
 		BroadcastProgress(BytesReceived, ContentSize, ContentSize <= 0 ? 0 : static_cast<float>(BytesReceived) / ContentSize);
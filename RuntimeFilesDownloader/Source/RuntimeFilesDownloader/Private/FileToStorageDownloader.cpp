@@ -76,7 +76,7 @@ void UFileToStorageDownloader::DownloadFileToStorage(const FString& URL, const F
 	};
 
 	FileSavePath = SavePath;
-	RuntimeChunkDownloaderPtr = MakeShared<FRuntimeChunkDownloader>();
+	CreateChunkDownloader();
 
 	if (bForceByPayload)
 	{
@@ -134,34 +134,75 @@ void UFileToStorageDownloader::OnComplete_Internal(EDownloadToMemoryResult Resul
 		}
 	}
 
-	// Delete the file if it already exists
-	if (FPaths::FileExists(*FileSavePath))
+	// The content is written to a temporary sibling file first, so that an interrupted write never leaves a truncated file at the save path
+	const FString PartialFilePath{FileSavePath + PartialFileExtension};
+	if (!WritePartialFile(PartialFilePath, DownloadedContent))
 	{
-		IFileManager& FileManager = IFileManager::Get();
-		if (!FileManager.Delete(*FileSavePath))
-		{
-			UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Something went wrong while deleting the existing file '%s'"), *FileSavePath);
-			OnDownloadComplete.ExecuteIfBound(EDownloadToStorageResult::SaveFailed);
-			return;
-		}
+		PlatformFile.DeleteFile(*PartialFilePath);
+		OnDownloadComplete.ExecuteIfBound(EDownloadToStorageResult::SaveFailed);
+		return;
 	}
 
-	IFileHandle* FileHandle = PlatformFile.OpenWrite(*FileSavePath);
-	if (!FileHandle)
+	if (!CommitPartialFile(PartialFilePath))
 	{
-		UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Something went wrong while saving the file '%s'"), *FileSavePath);
+		PlatformFile.DeleteFile(*PartialFilePath);
 		OnDownloadComplete.ExecuteIfBound(EDownloadToStorageResult::SaveFailed);
 		return;
 	}
 
+	OnDownloadComplete.ExecuteIfBound(Result == EDownloadToMemoryResult::SucceededByPayload ? EDownloadToStorageResult::SucceededByPayload : EDownloadToStorageResult::Success);
+}
+
+bool UFileToStorageDownloader::WritePartialFile(const FString& PartialFilePath, const TArray64<uint8>& DownloadedContent) const
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	// A leftover partial file from an interrupted download is never resumed from, so it is simply overwritten
+	TUniquePtr<IFileHandle> FileHandle{PlatformFile.OpenWrite(*PartialFilePath)};
+	if (!FileHandle.IsValid())
+	{
+		UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Something went wrong while saving the file '%s'"), *PartialFilePath);
+		return false;
+	}
+
 	if (!FileHandle->Write(DownloadedContent.GetData(), DownloadedContent.Num()))
 	{
-		UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Something went wrong while writing the response data to the file '%s'"), *FileSavePath);
-		delete FileHandle;
-		OnDownloadComplete.ExecuteIfBound(EDownloadToStorageResult::SaveFailed);
-		return;
+		UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Something went wrong while writing the response data to the file '%s'"), *PartialFilePath);
+		return false;
 	}
 
-	delete FileHandle;
-	OnDownloadComplete.ExecuteIfBound(Result == EDownloadToMemoryResult::SucceededByPayload ? EDownloadToStorageResult::SucceededByPayload : EDownloadToStorageResult::Success);
+	// Make sure the data has reached the disk before the file is renamed, otherwise a crash could still leave a truncated file behind
+	if (!FileHandle->Flush(true))
+	{
+		UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Something went wrong while flushing the file '%s' to disk"), *PartialFilePath);
+		return false;
+	}
+
+	return true;
+}
+
+bool UFileToStorageDownloader::CommitPartialFile(const FString& PartialFilePath) const
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	// On platforms where renaming replaces the existing file, the file at the save path is swapped atomically
+	if (PlatformFile.MoveFile(*FileSavePath, *PartialFilePath))
+	{
+		return true;
+	}
+
+	// Otherwise the existing file has to be deleted first
+	if (PlatformFile.FileExists(*FileSavePath) && !PlatformFile.DeleteFile(*FileSavePath))
+	{
+		UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Something went wrong while deleting the existing file '%s'"), *FileSavePath);
+		return false;
+	}
+
+	if (!PlatformFile.MoveFile(*FileSavePath, *PartialFilePath))
+	{
+		UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Something went wrong while renaming the file '%s' to '%s'"), *PartialFilePath, *FileSavePath);
+		return false;
+	}
+
+	return true;
 }
@@ -4,9 +4,14 @@
 
 #include "FileToMemoryDownloader.h"
 #include "RuntimeFilesDownloaderDefines.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
 
 FRuntimeChunkDownloader::FRuntimeChunkDownloader()
 	: bCanceled(false)
+	, bResolvedURLRefreshed(false)
+	, TargetChunkDuration(0)
+	, MinChunkSize(DefaultMinChunkSize)
 {}
 
 FRuntimeChunkDownloader::~FRuntimeChunkDownloader()
@@ -78,6 +83,13 @@ TFuture<FRuntimeChunkDownloaderResult> FRuntimeChunkDownloader::DownloadFile(con
 			return;
 		}
 
+		if (SharedThis->DownloadSession.RefusesRanges())
+		{
+			UE_LOG(LogRuntimeFilesDownloader, Warning, TEXT("The server does not accept ranged requests for %s. Trying to download the file by payload"), *URL);
+			DownloadByPayload();
+			return;
+		}
+
 		TSharedPtr<TArray64<uint8>> OverallDownloadedDataPtr = MakeShared<TArray64<uint8>>();
 		{
 			UE_LOG(LogRuntimeFilesDownloader, Warning, TEXT("Pre-allocating %lld bytes for file download from %s"), ContentSize, *URL);
@@ -87,7 +99,7 @@ TFuture<FRuntimeChunkDownloaderResult> FRuntimeChunkDownloader::DownloadFile(con
 		FInt64Vector2 ChunkRange;
 		{
 			ChunkRange.X = 0;
-			ChunkRange.Y = FMath::Min(MaxChunkSize, ContentSize) - 1;
+			ChunkRange.Y = FMath::Min(SharedThis->GetNextChunkSize(MaxChunkSize), ContentSize) - 1;
 		}
 
 		TSharedPtr<int64> ChunkOffsetPtr = MakeShared<int64>(ChunkRange.X);
@@ -238,8 +250,8 @@ TFuture<EDownloadToMemoryResult> FRuntimeChunkDownloader::DownloadFilePerChunk(c
 					return;
 				}
 
-				PromisePtr->SetValue(Result.Result);
 				OnChunkDownloaded(MoveTemp(Result.Data));
+				PromisePtr->SetValue(Result.Result);
 			});
 			return;
 		}
@@ -254,7 +266,7 @@ TFuture<EDownloadToMemoryResult> FRuntimeChunkDownloader::DownloadFilePerChunk(c
 		// If the chunk range is not specified, determine the range based on the max chunk size and the content size
 		if (ChunkRange.X == 0 && ChunkRange.Y == 0)
 		{
-			ChunkRange.Y = FMath::Min(MaxChunkSize, ContentSize) - 1;
+			ChunkRange.Y = FMath::Min(SharedThis->GetNextChunkSize(MaxChunkSize), ContentSize) - 1;
 		}
 
 		if (ChunkRange.Y > ContentSize)
@@ -264,6 +276,9 @@ TFuture<EDownloadToMemoryResult> FRuntimeChunkDownloader::DownloadFilePerChunk(c
 			return;
 		}
 
+		// Chunks are requested directly from the resolved URL, avoiding the redirect for each of them
+		const FString ChunkURL = SharedThis->DownloadSession.IsResolvedFor(URL) ? SharedThis->DownloadSession.ResolvedURL : URL;
+
 		auto OnProgressInternal = [WeakThisPtr, PromisePtr, URL, Timeout, ContentType, MaxChunkSize, OnChunkDownloaded, OnProgress, ChunkRange](int64 BytesReceived, int64 ContentSize) mutable
 		{
 			TSharedPtr<FRuntimeChunkDownloader> SharedThis = WeakThisPtr.Pin();
@@ -275,7 +290,12 @@ TFuture<EDownloadToMemoryResult> FRuntimeChunkDownloader::DownloadFilePerChunk(c
 			}
 		};
 
-		SharedThis->DownloadFileByChunk(URL, Timeout, ContentType, ContentSize, ChunkRange, OnProgressInternal).Next([WeakThisPtr, PromisePtr, URL, Timeout, ContentType, ContentSize, MaxChunkSize, OnChunkDownloaded, OnProgress, ChunkRange](FRuntimeChunkDownloaderResult&& Result)
+		const int64 ChunkSize = ChunkRange.Y - ChunkRange.X + 1;
+		const double ThrottleStartTime = FPlatformTime::Seconds();
+		SharedThis->DownloadStats.LastChunkSize = ChunkSize;
+
+		// The chunk is requested only once the bandwidth throttles allow it
+		SharedThis->WaitForBandwidth(ChunkSize, [WeakThisPtr, PromisePtr, URL, ChunkURL, Timeout, ContentType, ContentSize, MaxChunkSize, OnChunkDownloaded, OnProgress, OnProgressInternal, ChunkRange, ThrottleStartTime]() mutable
 		{
 			TSharedPtr<FRuntimeChunkDownloader> SharedThis = WeakThisPtr.Pin();
 			if (!SharedThis.IsValid())
@@ -292,30 +312,95 @@ TFuture<EDownloadToMemoryResult> FRuntimeChunkDownloader::DownloadFilePerChunk(c
 				return;
 			}
 
-			if (Result.Result != EDownloadToMemoryResult::Success && Result.Result != EDownloadToMemoryResult::SucceededByPayload)
+			const double ChunkStartTime = FPlatformTime::Seconds();
+			SharedThis->DownloadStats.ThrottledDuration += ChunkStartTime - ThrottleStartTime;
+
+			SharedThis->DownloadFileByChunk(ChunkURL, Timeout, ContentType, ContentSize, ChunkRange, OnProgressInternal).Next([WeakThisPtr, PromisePtr, URL, Timeout, ContentType, ContentSize, MaxChunkSize, OnChunkDownloaded, OnProgress, ChunkRange, ChunkStartTime](FRuntimeChunkDownloaderResult&& Result)
 			{
-				UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Failed to download file chunk from %s: %s"), *URL, *UEnum::GetValueAsString(Result.Result));
-				PromisePtr->SetValue(Result.Result);
-				return;
-			}
+				TSharedPtr<FRuntimeChunkDownloader> SharedThis = WeakThisPtr.Pin();
+				if (!SharedThis.IsValid())
+				{
+					UE_LOG(LogRuntimeFilesDownloader, Warning, TEXT("Failed to download file chunk from %s: downloader has been destroyed"), *URL);
+					PromisePtr->SetValue(EDownloadToMemoryResult::DownloadFailed);
+					return;
+				}
+
+				if (SharedThis->bCanceled)
+				{
+					UE_LOG(LogRuntimeFilesDownloader, Warning, TEXT("Canceled file chunk download from %s"), *URL);
+					PromisePtr->SetValue(EDownloadToMemoryResult::Cancelled);
+					return;
+				}
 
-			OnChunkDownloaded(MoveTemp(Result.Data));
+				if (Result.Result != EDownloadToMemoryResult::Success && Result.Result != EDownloadToMemoryResult::SucceededByPayload)
+				{
+					const FRuntimeChunkDownloadSession PreviousSession = SharedThis->DownloadSession;
 
-			// Check if the download is complete
-			if (ContentSize > ChunkRange.Y + 1)
-			{
-				const int64 ChunkStart = ChunkRange.Y + 1;
-				const int64 ChunkEnd = FMath::Min(ChunkStart + MaxChunkSize, ContentSize) - 1;
+					// The resolved URL may be a signed link that has expired, so the original URL is resolved once more to follow the redirect to a fresh link
+					if (!SharedThis->bResolvedURLRefreshed && PreviousSession.IsResolvedFor(URL) && PreviousSession.ResolvedURL != PreviousSession.OriginalURL)
+					{
+						UE_LOG(LogRuntimeFilesDownloader, Warning, TEXT("Failed to download file chunk from resolved URL %s. Resolving the original URL %s again"), *PreviousSession.ResolvedURL, *URL);
+						SharedThis->bResolvedURLRefreshed = true;
+
+						SharedThis->ResolveDownloadSession(URL, Timeout).Next([WeakThisPtr, PromisePtr, URL, Timeout, ContentType, MaxChunkSize, OnChunkDownloaded, OnProgress, ChunkRange, PreviousSession](bool bResolved) mutable
+						{
+							TSharedPtr<FRuntimeChunkDownloader> SharedThis = WeakThisPtr.Pin();
+							if (!SharedThis.IsValid())
+							{
+								UE_LOG(LogRuntimeFilesDownloader, Warning, TEXT("Failed to download file chunk from %s: downloader has been destroyed"), *URL);
+								PromisePtr->SetValue(EDownloadToMemoryResult::DownloadFailed);
+								return;
+							}
+
+							if (!bResolved)
+							{
+								UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Failed to download file chunk from %s: the URL could not be resolved again"), *URL);
+								PromisePtr->SetValue(EDownloadToMemoryResult::DownloadFailed);
+								return;
+							}
+
+							// The chunks downloaded so far must belong to the same version of the file as the remaining ones
+							const FRuntimeChunkDownloadSession& DownloadSession = SharedThis->DownloadSession;
+							if (DownloadSession.ContentLength != PreviousSession.ContentLength || DownloadSession.ETag != PreviousSession.ETag || DownloadSession.LastModified != PreviousSession.LastModified)
+							{
+								UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Failed to download file chunk from %s: the file has changed since the download started"), *URL);
+								PromisePtr->SetValue(EDownloadToMemoryResult::DownloadFailed);
+								return;
+							}
+
+							SharedThis->DownloadFilePerChunk(URL, Timeout, ContentType, MaxChunkSize, ChunkRange, OnProgress, OnChunkDownloaded).Next([PromisePtr](EDownloadToMemoryResult Result)
+							{
+								PromisePtr->SetValue(Result);
+							});
+						});
+						return;
+					}
 
-				SharedThis->DownloadFilePerChunk(URL, Timeout, ContentType, MaxChunkSize, FInt64Vector2(ChunkStart, ChunkEnd), OnProgress, OnChunkDownloaded).Next([WeakThisPtr, PromisePtr](EDownloadToMemoryResult Result)
+					UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Failed to download file chunk from %s: %s"), *URL, *UEnum::GetValueAsString(Result.Result));
+					PromisePtr->SetValue(Result.Result);
+					return;
+				}
+
+				SharedThis->RecordChunkThroughput(Result.Data.Num(), FPlatformTime::Seconds() - ChunkStartTime);
+				SharedThis->bResolvedURLRefreshed = false;
+				OnChunkDownloaded(MoveTemp(Result.Data));
+
+				// Check if the download is complete
+				if (ContentSize > ChunkRange.Y + 1)
 				{
-					PromisePtr->SetValue(Result);
-				});
-			}
-			else
-			{
-				PromisePtr->SetValue(EDownloadToMemoryResult::Success);
-			}
+					const int64 ChunkStart = ChunkRange.Y + 1;
+					const int64 ChunkEnd = FMath::Min(ChunkStart + SharedThis->GetNextChunkSize(MaxChunkSize), ContentSize) - 1;
+
+					SharedThis->DownloadFilePerChunk(URL, Timeout, ContentType, MaxChunkSize, FInt64Vector2(ChunkStart, ChunkEnd), OnProgress, OnChunkDownloaded).Next([WeakThisPtr, PromisePtr](EDownloadToMemoryResult Result)
+					{
+						PromisePtr->SetValue(Result);
+					});
+				}
+				else
+				{
+					PromisePtr->SetValue(EDownloadToMemoryResult::Success);
+				}
+			});
 		});
 	});
 
@@ -367,6 +452,16 @@ TFuture<FRuntimeChunkDownloaderResult> FRuntimeChunkDownloader::DownloadFileByCh
 	const FString RangeHeaderValue = FString::Format(TEXT("bytes={0}-{1}"), {ChunkRange.X, ChunkRange.Y});
 	HttpRequestRef->SetHeader(TEXT("Range"), RangeHeaderValue);
 
+	// If the file has changed since the session was resolved, the server responds with the whole file instead of the range, which fails the length check below
+	if (DownloadSession.ResolvedURL == URL || DownloadSession.OriginalURL == URL)
+	{
+		const FString RangeValidator = DownloadSession.GetRangeValidator();
+		if (!RangeValidator.IsEmpty())
+		{
+			HttpRequestRef->SetHeader(TEXT("If-Range"), RangeValidator);
+		}
+	}
+
 	HttpRequestRef->OnRequestProgress().BindLambda([WeakThisPtr, ContentSize, ChunkRange, OnProgress](FHttpRequestPtr Request, int32 BytesSent, int32 BytesReceived)
 	{
 		TSharedPtr<FRuntimeChunkDownloader> SharedThis = WeakThisPtr.Pin();
@@ -518,7 +613,30 @@ TFuture<FRuntimeChunkDownloaderResult> FRuntimeChunkDownloader::DownloadFileByPa
 
 TFuture<int64> FRuntimeChunkDownloader::GetContentSize(const FString& URL, float Timeout)
 {
-	TSharedPtr<TPromise<int64>> PromisePtr = MakeShared<TPromise<int64>>();
+	if (DownloadSession.IsResolvedFor(URL))
+	{
+		return MakeFulfilledPromise<int64>(DownloadSession.ContentLength).GetFuture();
+	}
+
+	TWeakPtr<FRuntimeChunkDownloader> WeakThisPtr = AsShared();
+	return ResolveDownloadSession(URL, Timeout).Next([WeakThisPtr](bool bResolved) -> int64
+	{
+		TSharedPtr<FRuntimeChunkDownloader> SharedThis = WeakThisPtr.Pin();
+		if (!bResolved || !SharedThis.IsValid())
+		{
+			return 0;
+		}
+
+		return SharedThis->DownloadSession.ContentLength;
+	});
+}
+
+TFuture<bool> FRuntimeChunkDownloader::ResolveDownloadSession(const FString& URL, float Timeout)
+{
+	DownloadSession = FRuntimeChunkDownloadSession();
+
+	TSharedPtr<TPromise<bool>> PromisePtr = MakeShared<TPromise<bool>>();
+	TWeakPtr<FRuntimeChunkDownloader> WeakThisPtr = AsShared();
 
 #if UE_VERSION_NEWER_THAN(4, 26, 0)
 	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequestRef = FHttpModule::Get().CreateRequest();
@@ -535,12 +653,20 @@ TFuture<int64> FRuntimeChunkDownloader::GetContentSize(const FString& URL, float
 	UE_LOG(LogRuntimeFilesDownloader, Warning, TEXT("The Timeout feature is only supported in engine version 4.26 or later. Please update your engine to use this feature"));
 #endif
 
-	HttpRequestRef->OnProcessRequestComplete().BindLambda([PromisePtr, URL](const FHttpRequestPtr& Request, const FHttpResponsePtr& Response, const bool bSucceeded)
+	HttpRequestRef->OnProcessRequestComplete().BindLambda([WeakThisPtr, PromisePtr, URL](const FHttpRequestPtr& Request, const FHttpResponsePtr& Response, const bool bSucceeded)
 	{
+		TSharedPtr<FRuntimeChunkDownloader> SharedThis = WeakThisPtr.Pin();
+		if (!SharedThis.IsValid())
+		{
+			UE_LOG(LogRuntimeFilesDownloader, Warning, TEXT("Failed to get size of file from %s: downloader has been destroyed"), *URL);
+			PromisePtr->SetValue(false);
+			return;
+		}
+
 		if (!bSucceeded || !Response.IsValid())
 		{
 			UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Failed to get size of file from %s: request failed"), *URL);
-			PromisePtr->SetValue(0);
+			PromisePtr->SetValue(false);
 			return;
 		}
 
@@ -548,18 +674,31 @@ TFuture<int64> FRuntimeChunkDownloader::GetContentSize(const FString& URL, float
 		if (ContentLength <= 0)
 		{
 			UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Failed to get size of file from %s: content length is %lld, expected > 0"), *URL, ContentLength);
-			PromisePtr->SetValue(0);
+			PromisePtr->SetValue(false);
 			return;
 		}
 
-		UE_LOG(LogRuntimeFilesDownloader, Log, TEXT("Got size of file from %s: %lld"), *URL, ContentLength);
-		PromisePtr->SetValue(ContentLength);
+		FRuntimeChunkDownloadSession& DownloadSession = SharedThis->DownloadSession;
+		DownloadSession.OriginalURL = URL;
+#if !UE_VERSION_OLDER_THAN(5, 4, 0)
+		DownloadSession.ResolvedURL = Response->GetEffectiveURL().IsEmpty() ? URL : Response->GetEffectiveURL();
+#else
+		// The URL after redirects is not exposed by older engine versions, so chunks keep following the redirect
+		DownloadSession.ResolvedURL = URL;
+#endif
+		DownloadSession.ContentLength = ContentLength;
+		DownloadSession.ETag = Response->GetHeader(TEXT("ETag"));
+		DownloadSession.LastModified = Response->GetHeader(TEXT("Last-Modified"));
+		DownloadSession.AcceptRanges = Response->GetHeader(TEXT("Accept-Ranges"));
+
+		UE_LOG(LogRuntimeFilesDownloader, Log, TEXT("Got size of file from %s: %lld. Resolved URL: %s, ETag: %s, Accept-Ranges: %s"), *URL, ContentLength, *DownloadSession.ResolvedURL, *DownloadSession.ETag, *DownloadSession.AcceptRanges);
+		PromisePtr->SetValue(true);
 	});
 
 	if (!HttpRequestRef->ProcessRequest())
 	{
 		UE_LOG(LogRuntimeFilesDownloader, Error, TEXT("Failed to get size of file from %s: request failed"), *URL);
-		return MakeFulfilledPromise<int64>(0).GetFuture();
+		return MakeFulfilledPromise<bool>(false).GetFuture();
 	}
 
 	HttpRequestPtr = HttpRequestRef;
@@ -581,3 +720,106 @@ void FRuntimeChunkDownloader::CancelDownload()
 	}
 	UE_LOG(LogRuntimeFilesDownloader, Warning, TEXT("Download canceled"));
 }
+
+void FRuntimeChunkDownloader::SetAdaptiveChunkSize(float InTargetChunkDuration, int64 InMinChunkSize)
+{
+	TargetChunkDuration = InTargetChunkDuration;
+	MinChunkSize = FMath::Max<int64>(InMinChunkSize, 1);
+}
+
+int64 FRuntimeChunkDownloader::GetNextChunkSize(int64 MaxChunkSize) const
+{
+	int64 ChunkSize = MaxChunkSize;
+
+	if (TargetChunkDuration > 0)
+	{
+		// Size the chunk so that its request lasts the target duration at the measured throughput
+		ChunkSize = DownloadStats.SmoothedThroughput > 0 ? static_cast<int64>(DownloadStats.SmoothedThroughput * TargetChunkDuration) : MinChunkSize;
+		ChunkSize = FMath::Clamp(ChunkSize, FMath::Min(MinChunkSize, MaxChunkSize), MaxChunkSize);
+	}
+
+	// When throttled, do not request more than the allowed rate delivers in the target duration, so that the bandwidth is spread evenly instead of being spent in bursts
+	// Applied after the minimum chunk size, which would otherwise allow bursts above low rate limits, and also without adaptation, since a single request for the whole file would arrive at full speed
+	const float RateLimitedChunkDuration = TargetChunkDuration > 0 ? TargetChunkDuration : DefaultTargetChunkDuration;
+	for (const int64 RateLimit : {Throttle.GetRateLimit(), FRuntimeDownloadThrottle::GetGlobal().GetRateLimit()})
+	{
+		if (RateLimit > 0)
+		{
+			ChunkSize = FMath::Min(ChunkSize, FMath::Max<int64>(static_cast<int64>(RateLimit * RateLimitedChunkDuration), 1));
+		}
+	}
+
+	return ChunkSize;
+}
+
+void FRuntimeChunkDownloader::WaitForBandwidth(int64 NumOfBytes, TFunction<void()>&& OnReady)
+{
+	// The bandwidth is only reserved once the consumer of the chunks has caught up, so that the throttles are not charged while waiting
+	if (!bCanceled && CanRequestChunk && !CanRequestChunk())
+	{
+		TWeakPtr<FRuntimeChunkDownloader> WeakThisPtr = AsShared();
+
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+		FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThisPtr, NumOfBytes, OnReady = MoveTemp(OnReady)](float DeltaTime)
+#else
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThisPtr, NumOfBytes, OnReady = MoveTemp(OnReady)](float DeltaTime)
+#endif
+		{
+			TFunction<void()> OnReadyCopy = OnReady;
+
+			TSharedPtr<FRuntimeChunkDownloader> SharedThis = WeakThisPtr.Pin();
+			if (SharedThis.IsValid())
+			{
+				SharedThis->WaitForBandwidth(NumOfBytes, MoveTemp(OnReadyCopy));
+			}
+			else
+			{
+				OnReadyCopy();
+			}
+
+			return false;
+		}), ChunkRequestGatePollInterval);
+		return;
+	}
+
+	// Both throttles are charged, and the request waits for the more restrictive one
+	const double Delay = FMath::Max(Throttle.Reserve(NumOfBytes), FRuntimeDownloadThrottle::GetGlobal().Reserve(NumOfBytes));
+	if (Delay <= 0)
+	{
+		OnReady();
+		return;
+	}
+
+	UE_LOG(LogRuntimeFilesDownloader, Log, TEXT("Throttling the request of %lld bytes by %f seconds"), NumOfBytes, Delay);
+
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+	FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([OnReady = MoveTemp(OnReady)](float DeltaTime)
+#else
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([OnReady = MoveTemp(OnReady)](float DeltaTime)
+#endif
+	{
+		OnReady();
+		return false;
+	}), static_cast<float>(Delay));
+}
+
+void FRuntimeChunkDownloader::RecordChunkThroughput(int64 NumOfBytes, double Duration)
+{
+	if (NumOfBytes <= 0 || Duration <= 0)
+	{
+		return;
+	}
+
+	// Weight of the last chunk in the smoothed throughput
+	constexpr double SmoothingFactor = 0.3;
+
+	const double Throughput = NumOfBytes / Duration;
+	DownloadStats.NumOfChunks++;
+	DownloadStats.NumOfBytes += NumOfBytes;
+	DownloadStats.DownloadDuration += Duration;
+	DownloadStats.LastThroughput = Throughput;
+	DownloadStats.SmoothedThroughput = DownloadStats.SmoothedThroughput <= 0 ? Throughput : SmoothingFactor * Throughput + (1 - SmoothingFactor) * DownloadStats.SmoothedThroughput;
+
+	UE_LOG(LogRuntimeFilesDownloader, Log, TEXT("Downloaded chunk of %lld bytes in %f seconds (%f bytes/s). Smoothed throughput: %f bytes/s, average: %f bytes/s, throttled for %f seconds overall"),
+		NumOfBytes, Duration, Throughput, DownloadStats.SmoothedThroughput, DownloadStats.GetAverageThroughput(), DownloadStats.ThrottledDuration);
+}
@@ -0,0 +1,65 @@
+﻿// Georgy Treshchev 2023.
+
+#include "RuntimeDownloadThrottle.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+FRuntimeDownloadThrottle::FRuntimeDownloadThrottle()
+	: BytesPerSecond(0)
+	, Tokens(0)
+	, LastRefillTime(FPlatformTime::Seconds())
+{}
+
+void FRuntimeDownloadThrottle::SetRateLimit(int64 InBytesPerSecond)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	Refill(CurrentTime);
+
+	const bool bWasLimited = BytesPerSecond > 0;
+	BytesPerSecond = FMath::Max<int64>(InBytesPerSecond, 0);
+
+	// Start with a full bucket when the limit is enabled, and drop the excess when the limit is lowered
+	const double Capacity = BytesPerSecond * BurstDuration;
+	Tokens = bWasLimited ? FMath::Min(Tokens, Capacity) : Capacity;
+	LastRefillTime = CurrentTime;
+}
+
+int64 FRuntimeDownloadThrottle::GetRateLimit() const
+{
+	FScopeLock Lock(&CriticalSection);
+	return BytesPerSecond;
+}
+
+double FRuntimeDownloadThrottle::Reserve(int64 NumOfBytes)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	if (BytesPerSecond <= 0 || NumOfBytes <= 0)
+	{
+		return 0;
+	}
+
+	Refill(FPlatformTime::Seconds());
+
+	// The tokens are allowed to go negative, so the following requests wait until the bandwidth of this one has been paid off
+	Tokens -= NumOfBytes;
+	return Tokens >= 0 ? 0 : -Tokens / BytesPerSecond;
+}
+
+FRuntimeDownloadThrottle& FRuntimeDownloadThrottle::GetGlobal()
+{
+	static FRuntimeDownloadThrottle GlobalThrottle;
+	return GlobalThrottle;
+}
+
+void FRuntimeDownloadThrottle::Refill(double CurrentTime)
+{
+	if (BytesPerSecond > 0)
+	{
+		Tokens = FMath::Min(Tokens + (CurrentTime - LastRefillTime) * BytesPerSecond, BytesPerSecond * BurstDuration);
+	}
+	LastRefillTime = CurrentTime;
+}
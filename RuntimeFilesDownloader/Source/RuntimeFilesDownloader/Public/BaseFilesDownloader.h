@@ -63,6 +63,49 @@ public:
 	 */
 	static void GetContentSize(const FString& URL, float Timeout, const FOnGetDownloadContentLengthNative& OnComplete);
 
+	/**
+	 * Limit the download rate of this downloader. The global rate limit applies in addition to it
+	 *
+	 * @param BytesPerSecond The maximum number of bytes downloaded per second. 0 or less removes the limit
+	 * @return Whether the limit was applied to a download in progress. Otherwise it is applied once the download starts
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Runtime Files Downloader|Throttling")
+	bool SetDownloadRateLimit(int64 BytesPerSecond);
+
+	/**
+	 * Let the chunk sizes of this downloader adapt to the measured throughput, so that a slow connection is not stuck in one long request
+	 *
+	 * @param TargetChunkDuration The duration each chunk request should last, in seconds. 0 or less disables adaptation
+	 * @param MinChunkSize The size of the first chunk and the lower bound for the following ones, in bytes
+	 * @return Whether the setting was applied to a download in progress. Otherwise it is applied once the download starts
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Runtime Files Downloader|Throttling")
+	bool SetAdaptiveChunkSize(float TargetChunkDuration, int64 MinChunkSize = 1048576);
+
+	/**
+	 * Get the throughput of the current download, smoothed over the recently downloaded chunks
+	 *
+	 * @return The throughput in bytes per second, or 0 if it has not been measured yet
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Runtime Files Downloader|Throttling")
+	float GetDownloadThroughput() const;
+
+	/**
+	 * Limit the download rate shared by all downloads, e.g. full speed in menus and capped during a match
+	 *
+	 * @param BytesPerSecond The maximum number of bytes downloaded per second. 0 or less removes the limit
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Runtime Files Downloader|Throttling")
+	static void SetGlobalDownloadRateLimit(int64 BytesPerSecond);
+
+	/**
+	 * Get the download rate limit shared by all downloads
+	 *
+	 * @return The maximum number of bytes downloaded per second, or 0 if the rate is not limited
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Runtime Files Downloader|Throttling")
+	static int64 GetGlobalDownloadRateLimit();
+
 	/**
 	 * Convert bytes to string
 	 *
@@ -138,6 +181,16 @@ protected:
 	 */
 	void BroadcastProgress(int64 BytesReceived, int64 ContentLength, float ProgressRatio) const;
 
+	/**
+	 * Create the internal downloader with the throttling settings made before the download started
+	 */
+	void CreateChunkDownloader();
+
 	/** Internal downloader */
 	TSharedPtr<class FRuntimeChunkDownloader> RuntimeChunkDownloaderPtr;
+
+	/** Throttling settings applied to the internal downloader once it is created */
+	int64 DownloadRateLimit = 0;
+	float AdaptiveChunkDuration = 0;
+	int64 AdaptiveMinChunkSize = 1024 * 1024;
 };
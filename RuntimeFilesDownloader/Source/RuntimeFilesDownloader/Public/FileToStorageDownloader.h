@@ -90,6 +90,27 @@ protected:
 	 */
 	void OnComplete_Internal(EDownloadToMemoryResult Result, TArray64<uint8> DownloadedContent);
 
+	/**
+	 * Write the downloaded content to a temporary file and flush it to disk
+	 *
+	 * @param PartialFilePath The path of the temporary file to write
+	 * @param DownloadedContent The downloaded content to write
+	 * @return True if the content was fully written and flushed
+	 */
+	bool WritePartialFile(const FString& PartialFilePath, const TArray64<uint8>& DownloadedContent) const;
+
+	/**
+	 * Rename the temporary file to the destination path, replacing the existing file if any
+	 *
+	 * @param PartialFilePath The path of the fully written temporary file
+	 * @return True if the file was moved to the destination path
+	 */
+	bool CommitPartialFile(const FString& PartialFilePath) const;
+
+public:
+	/** Extension appended to the save path for the file being written until it is complete */
+	static constexpr const TCHAR* PartialFileExtension = TEXT(".part");
+
 protected:
 	/** The destination path to save the downloaded file */
 	FString FileSavePath;
@@ -7,6 +7,7 @@
 #include "Templates/SharedPointer.h"
 #include "Async/Future.h"
 #include "Misc/EngineVersionComparison.h"
+#include "RuntimeDownloadThrottle.h"
 
 enum class EDownloadToMemoryResult : uint8;
 
@@ -57,6 +58,105 @@ struct TIntVector2
 using FInt64Vector2 = TIntVector2<int64>;
 #endif
 
+/**
+ * Information about a file to be downloaded, resolved once and then shared by all chunk requests of the download
+ */
+struct FRuntimeChunkDownloadSession
+{
+	/** The URL the download was requested with */
+	FString OriginalURL;
+
+	/** The final URL after following redirects (e.g. a signed CDN link). Chunks are requested from this URL */
+	FString ResolvedURL;
+
+	/** The size of the file in bytes */
+	int64 ContentLength = 0;
+
+	/** The entity tag of the file, used to make sure all chunks belong to the same version of the file */
+	FString ETag;
+
+	/** The last modification date of the file, used as a validator if the entity tag is not provided */
+	FString LastModified;
+
+	/** The value of the Accept-Ranges header, describing whether ranged requests are supported */
+	FString AcceptRanges;
+
+	/**
+	 * Check if the session has been resolved for the specified URL
+	 */
+	bool IsResolvedFor(const FString& URL) const
+	{
+		return ContentLength > 0 && OriginalURL == URL;
+	}
+
+	/**
+	 * Check if the server explicitly refuses ranged requests
+	 */
+	bool RefusesRanges() const
+	{
+		return AcceptRanges.Equals(TEXT("none"), ESearchCase::IgnoreCase);
+	}
+
+	/**
+	 * Check if the entity tag is weak (W/"..."). Weak entity tags must not be used with the If-Range header
+	 */
+	bool HasWeakETag() const
+	{
+		return ETag.StartsWith(TEXT("W/"), ESearchCase::CaseSensitive);
+	}
+
+	/**
+	 * Get the validator to send with the If-Range header, so that a changed file is not mixed with previously downloaded chunks
+	 * Servers answer an If-Range with a weak validator with the whole file, so the last modification date is used instead of a weak entity tag
+	 *
+	 * @return The strong entity tag, otherwise the last modification date, or an empty string if the If-Range header should not be sent
+	 */
+	FString GetRangeValidator() const
+	{
+		if (!ETag.IsEmpty() && !HasWeakETag())
+		{
+			return ETag;
+		}
+
+		return LastModified;
+	}
+};
+
+/**
+ * Throughput telemetry of the chunks downloaded by a chunk downloader
+ */
+struct FRuntimeChunkDownloadStats
+{
+	/** The number of chunks downloaded */
+	int32 NumOfChunks = 0;
+
+	/** The number of bytes downloaded in chunks */
+	int64 NumOfBytes = 0;
+
+	/** The time spent on chunk requests, in seconds */
+	double DownloadDuration = 0;
+
+	/** The time chunk requests were held back by the bandwidth throttles, in seconds */
+	double ThrottledDuration = 0;
+
+	/** The throughput of the last chunk request, in bytes per second */
+	double LastThroughput = 0;
+
+	/** The exponentially smoothed throughput of the chunk requests, in bytes per second. Used to size the next chunks */
+	double SmoothedThroughput = 0;
+
+	/** The size of the last requested chunk in bytes */
+	int64 LastChunkSize = 0;
+
+	/**
+	 * Get the throughput averaged over all chunk requests, in bytes per second
+	 */
+	double GetAverageThroughput() const
+	{
+		return DownloadDuration <= 0 ? 0 : NumOfBytes / DownloadDuration;
+	}
+};
+
 /**
  * A class that handles downloading data by chunks from URLs
  * This class is designed to handle large files beyond the limit supported by a TArray<uint8> (i.e. more than 2 GB) by using the HTTP Range header to download the file in chunks
@@ -119,7 +219,7 @@ public:
 	virtual TFuture<FRuntimeChunkDownloaderResult> DownloadFileByPayload(const FString& URL, float Timeout, const FString& ContentType, const TFunction<void(int64, int64)>& OnProgress);
 	
 	/**
-	 * Get the content size of the file to be downloaded
+	 * Get the content size of the file to be downloaded. The size is requested only once per URL, as it is taken from the download session afterwards
 	 *
 	 * @param URL The URL of the file to be downloaded
 	 * @param Timeout The timeout value in seconds
@@ -127,6 +227,80 @@ public:
 	 */
 	TFuture<int64> GetContentSize(const FString& URL, float Timeout);
 
+	/**
+	 * Resolve the download session for the specified URL by requesting the file headers once: the final URL after redirects, the content length and the validators
+	 *
+	 * @param URL The URL of the file to be downloaded
+	 * @param Timeout The timeout value in seconds
+	 * @return A future that resolves to true if the session was resolved successfully, false otherwise
+	 */
+	TFuture<bool> ResolveDownloadSession(const FString& URL, float Timeout);
+
+	/**
+	 * Get the current download session
+	 */
+	const FRuntimeChunkDownloadSession& GetDownloadSession() const { return DownloadSession; }
+
+	/**
+	 * Set the maximum download rate of this downloader. The global rate limit applies in addition to it
+	 *
+	 * @param BytesPerSecond The maximum number of bytes downloaded per second. 0 or less removes the limit
+	 */
+	void SetRateLimit(int64 BytesPerSecond) { Throttle.SetRateLimit(BytesPerSecond); }
+
+	/**
+	 * Get the maximum download rate of this downloader
+	 *
+	 * @return The maximum number of bytes downloaded per second, or 0 if the rate is not limited
+	 */
+	int64 GetRateLimit() const { return Throttle.GetRateLimit(); }
+
+	/**
+	 * Set the maximum download rate shared by all downloaders, e.g. to cap background downloads during a match
+	 *
+	 * @param BytesPerSecond The maximum number of bytes downloaded per second. 0 or less removes the limit
+	 */
+	static void SetGlobalRateLimit(int64 BytesPerSecond) { FRuntimeDownloadThrottle::GetGlobal().SetRateLimit(BytesPerSecond); }
+
+	/**
+	 * Get the maximum download rate shared by all downloaders
+	 *
+	 * @return The maximum number of bytes downloaded per second, or 0 if the rate is not limited
+	 */
+	static int64 GetGlobalRateLimit() { return FRuntimeDownloadThrottle::GetGlobal().GetRateLimit(); }
+
+	/**
+	 * Configure how chunk sizes adapt to the measured throughput. The chunk size passed to the download functions remains the upper bound
+	 * Adaptation is disabled by default, so that files fitting into the maximum chunk size are downloaded with a single request
+	 *
+	 * While a rate limit is set, chunks are capped to what the limit delivers in the target duration, or in DefaultTargetChunkDuration without adaptation
+	 *
+	 * @param InTargetChunkDuration The duration each chunk request should last, in seconds, e.g. DefaultTargetChunkDuration. 0 or less disables adaptation and uses the maximum chunk size unless a rate limit caps it
+	 * @param InMinChunkSize The size of the first chunk and the lower bound for the following ones, in bytes
+	 */
+	void SetAdaptiveChunkSize(float InTargetChunkDuration, int64 InMinChunkSize);
+
+	/**
+	 * Set a gate that holds back chunk requests while the downloaded chunks are not consumed fast enough, e.g. by a slower extraction
+	 *
+	 * @param InCanRequestChunk A function that is called on the game thread before each chunk is requested. While it returns false, the request is held back and the gate is polled again
+	 */
+	void SetChunkRequestGate(TFunction<bool()>&& InCanRequestChunk) { CanRequestChunk = MoveTemp(InCanRequestChunk); }
+
+	/**
+	 * Get the throughput telemetry of the downloaded chunks
+	 */
+	const FRuntimeChunkDownloadStats& GetDownloadStats() const { return DownloadStats; }
+
+	/** Suggested duration each chunk request should last when enabling adaptive chunk sizes, in seconds */
+	static constexpr float DefaultTargetChunkDuration = 2.0f;
+
+	/** Default size of the first chunk and lower bound for the following ones, in bytes */
+	static constexpr int64 DefaultMinChunkSize = 1024 * 1024;
+
+	/** Interval at which a closed chunk request gate is polled again, in seconds */
+	static constexpr float ChunkRequestGatePollInterval = 0.05f;
+
 	/**
 	 * Cancel the download
 	 */
@@ -140,6 +314,51 @@ protected:
 	TWeakPtr<IHttpRequest> HttpRequestPtr;
 #endif
 
+	/** Information about the file being downloaded, resolved once per download */
+	FRuntimeChunkDownloadSession DownloadSession;
+
+	/**
+	 * Get the size of the next chunk to request, based on the measured throughput and the rate limits
+	 *
+	 * @param MaxChunkSize The maximum size of the chunk in bytes
+	 * @return The size of the next chunk in bytes
+	 */
+	int64 GetNextChunkSize(int64 MaxChunkSize) const;
+
+	/**
+	 * Wait until the chunk request gate is open and both this downloader's and the global throttle allow downloading the specified number of bytes
+	 *
+	 * @param NumOfBytes The number of bytes about to be requested
+	 * @param OnReady A function that is called on the game thread once the request may be sent
+	 */
+	void WaitForBandwidth(int64 NumOfBytes, TFunction<void()>&& OnReady);
+
+	/**
+	 * Record the throughput of a downloaded chunk
+	 *
+	 * @param NumOfBytes The size of the downloaded chunk in bytes
+	 * @param Duration The duration of the chunk request in seconds
+	 */
+	void RecordChunkThroughput(int64 NumOfBytes, double Duration);
+
 	/** A flag indicating whether the download has been canceled */
 	bool bCanceled;
+
+	/** Whether the original URL has been resolved again after a failed chunk. Cleared once a chunk succeeds, so each failure refreshes an expired link only once */
+	bool bResolvedURLRefreshed;
+
+	/** The bandwidth throttle of this downloader */
+	FRuntimeDownloadThrottle Throttle;
+
+	/** The duration each chunk request should last, in seconds. 0 or less if the chunk size does not adapt, which is the default */
+	float TargetChunkDuration;
+
+	/** The size of the first chunk and the lower bound for the following ones, in bytes */
+	int64 MinChunkSize;
+
+	/** Throughput telemetry of the downloaded chunks */
+	FRuntimeChunkDownloadStats DownloadStats;
+
+	/** The gate holding back chunk requests, if set */
+	TFunction<bool()> CanRequestChunk;
 };
@@ -0,0 +1,65 @@
+﻿// Georgy Treshchev 2023.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * A token bucket limiting the rate at which bytes may be downloaded
+ * Downloads reserve the size of each request before sending it and wait for the returned delay, so the average rate never exceeds the limit
+ * The limit can be changed at any time and is thread-safe, so it can be shared between several downloaders
+ */
+class RUNTIMEFILESDOWNLOADER_API FRuntimeDownloadThrottle
+{
+public:
+	FRuntimeDownloadThrottle();
+
+	/**
+	 * Set the maximum download rate
+	 *
+	 * @param InBytesPerSecond The maximum number of bytes downloaded per second. 0 or less removes the limit
+	 */
+	void SetRateLimit(int64 InBytesPerSecond);
+
+	/**
+	 * Get the maximum download rate
+	 *
+	 * @return The maximum number of bytes downloaded per second, or 0 if the rate is not limited
+	 */
+	int64 GetRateLimit() const;
+
+	/**
+	 * Reserve bandwidth for a request of the specified size
+	 *
+	 * @param NumOfBytes The number of bytes to be downloaded by the request
+	 * @return The delay in seconds to wait before sending the request
+	 */
+	double Reserve(int64 NumOfBytes);
+
+	/**
+	 * Get the throttle shared by all downloaders
+	 */
+	static FRuntimeDownloadThrottle& GetGlobal();
+
+	/** The number of seconds of bandwidth that can be accumulated while idle and then spent at once */
+	static constexpr double BurstDuration = 1.0;
+
+private:
+	/**
+	 * Add the tokens accumulated since the last refill
+	 */
+	void Refill(double CurrentTime);
+
+	/** Guards the bucket state, as a throttle can be shared between threads */
+	mutable FCriticalSection CriticalSection;
+
+	/** The maximum number of bytes downloaded per second, 0 if the rate is not limited */
+	int64 BytesPerSecond;
+
+	/** The number of bytes that can be downloaded without waiting. Negative if the bandwidth has been reserved in advance */
+	double Tokens;
+
+	/** The time the tokens were last refilled, in seconds */
+	double LastRefillTime;
+};